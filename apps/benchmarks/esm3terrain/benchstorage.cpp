@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/loadland.hpp>
+#include <components/esm3terrain/storage.hpp>
+#include <components/esm4/loadland.hpp>
+
+#include <osg/Array>
+#include <osg/Vec2f>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+    // Chunks of one cell at the centre of the grid have land on every side
+    constexpr int gridSize = 3;
+
+    template <class T, std::size_t size>
+    void generateValues(T (&values)[size], int min, int max, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<int> distribution(min, max);
+        for (T& value : values)
+            value = static_cast<T>(distribution(random));
+    }
+
+    void generateNormals(std::span<signed char> normals, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<int> horizontal(-40, 40);
+        std::uniform_int_distribution<int> vertical(60, 127);
+        for (std::size_t i = 0; i + 2 < normals.size(); i += 3)
+        {
+            normals[i] = static_cast<signed char>(horizontal(random));
+            normals[i + 1] = static_cast<signed char>(horizontal(random));
+            normals[i + 2] = static_cast<signed char>(vertical(random));
+        }
+    }
+
+    class TestStorage final : public ESMTerrain::Storage
+    {
+    public:
+        explicit TestStorage(ESM::RefId worldspace)
+            : ESMTerrain::Storage(nullptr)
+        {
+            constexpr int flags = ESM::Land::DATA_VHGT | ESM::Land::DATA_VNML | ESM::Land::DATA_VCLR;
+            std::minstd_rand random;
+            for (int x = 0; x < gridSize; ++x)
+            {
+                for (int y = 0; y < gridSize; ++y)
+                {
+                    osg::ref_ptr<const ESMTerrain::LandObject> land;
+                    if (ESM::isEsm4Ext(worldspace))
+                    {
+                        auto& record = *mEsm4Lands.emplace_back(std::make_unique<ESM4::Land>());
+                        record.mHeightMap.heightOffset = 0;
+                        generateValues(record.mHeightMap.gradientData, -8, 8, random);
+                        generateNormals(record.mVertNorm, random);
+                        generateValues(record.mVertColr, 0, 255, random);
+                        land = new ESMTerrain::LandObject(&record, flags);
+                    }
+                    else
+                    {
+                        auto& record = *mEsm3Lands.emplace_back(std::make_unique<ESM::Land>());
+                        record.blank();
+                        ESM::Land::LandData& data = *record.getLandData();
+                        generateValues(data.mHeights, -2000, 4000, random);
+                        generateNormals(data.mNormals, random);
+                        generateValues(data.mColours, 0, 255, random);
+                        land = new ESMTerrain::LandObject(&record, flags);
+                    }
+                    mLands.emplace(ESM::ExteriorCellLocation(x, y, worldspace), std::move(land));
+                }
+            }
+        }
+
+        osg::ref_ptr<const ESMTerrain::LandObject> getLand(ESM::ExteriorCellLocation cellLocation) override
+        {
+            const auto it = mLands.find(cellLocation);
+            if (it == mLands.end())
+                return nullptr;
+            return it->second;
+        }
+
+        const ESM::LandTexture* getLandTexture(int index, short plugin) override { return nullptr; }
+
+        void getBounds(float& minX, float& maxX, float& minY, float& maxY, ESM::RefId worldspace) override
+        {
+            minX = 0;
+            minY = 0;
+            maxX = gridSize;
+            maxY = gridSize;
+        }
+
+    private:
+        std::vector<std::unique_ptr<ESM::Land>> mEsm3Lands;
+        std::vector<std::unique_ptr<ESM4::Land>> mEsm4Lands;
+        std::map<ESM::ExteriorCellLocation, osg::ref_ptr<const ESMTerrain::LandObject>> mLands;
+    };
+
+    ESM::RefId getWorldspace(bool esm4)
+    {
+        return esm4 ? ESM::RefId::formIdRefId(ESM::FormId{ 0x3c, 0 }) : ESM::Cell::sDefaultWorldspaceId;
+    }
+
+    void fillVertexBuffers(benchmark::State& state, bool esm4)
+    {
+        const ESM::RefId worldspace = getWorldspace(esm4);
+        TestStorage storage(worldspace);
+        const int lod = static_cast<int>(state.range(0));
+        const osg::Vec2f center(gridSize / 2.f, gridSize / 2.f);
+        osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+        for (auto _ : state)
+        {
+            storage.fillVertexBuffers(lod, 1, center, worldspace, positions, normals, colours);
+            benchmark::DoNotOptimize(positions->getDataPointer());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * positions->size());
+    }
+
+    void getMinMaxHeights(benchmark::State& state, bool esm4)
+    {
+        const ESM::RefId worldspace = getWorldspace(esm4);
+        TestStorage storage(worldspace);
+        // Leaf chunks of the quad tree are up to one cell large
+        const float size = 1.f / static_cast<float>(state.range(0));
+        const osg::Vec2f center(gridSize / 2.f - 0.5f + size / 2, gridSize / 2.f - 0.5f + size / 2);
+        for (auto _ : state)
+        {
+            float min = 0;
+            float max = 0;
+            benchmark::DoNotOptimize(storage.getMinMaxHeights(size, center, worldspace, min, max));
+            benchmark::DoNotOptimize(min);
+            benchmark::DoNotOptimize(max);
+        }
+    }
+
+    void fillVertexBuffersEsm3(benchmark::State& state)
+    {
+        fillVertexBuffers(state, false);
+    }
+
+    void fillVertexBuffersEsm4(benchmark::State& state)
+    {
+        fillVertexBuffers(state, true);
+    }
+
+    void getMinMaxHeightsEsm3(benchmark::State& state)
+    {
+        getMinMaxHeights(state, false);
+    }
+
+    void getMinMaxHeightsEsm4(benchmark::State& state)
+    {
+        getMinMaxHeights(state, true);
+    }
+}
+
+// LOD levels from every vertex of the land record to the corners only
+BENCHMARK(fillVertexBuffersEsm3)->DenseRange(0, 6);
+BENCHMARK(fillVertexBuffersEsm4)->DenseRange(0, 5);
+BENCHMARK(getMinMaxHeightsEsm3)->RangeMultiplier(2)->Range(1, 8);
+BENCHMARK(getMinMaxHeightsEsm4)->RangeMultiplier(2)->Range(1, 8);
+
+BENCHMARK_MAIN();
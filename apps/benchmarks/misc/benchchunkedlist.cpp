@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+
+#include <components/misc/chunkedlist.hpp>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Similar in size and layout to MWWorld::LiveCellRef: a polymorphic object with a position, a few values used by
+    // a cell traversal and members owning heap memory allocated while the cell is loaded
+    struct Ref
+    {
+        virtual ~Ref() = default;
+
+        float mPosition[6];
+        int mCount;
+        bool mEnabled;
+        std::string mRefId;
+        std::string mOwner;
+        std::vector<int> mLocals;
+        char mOther[160];
+    };
+
+    template <class List>
+    void fillCell(List& list, std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> coordinate(0, 8192);
+        std::uniform_int_distribution<int> locals(0, 4);
+        // References are loaded one by one together with other objects of the cell so nodes of std::list are not
+        // allocated next to each other
+        std::vector<std::unique_ptr<std::string>> other;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Ref ref;
+            for (float& v : ref.mPosition)
+                v = coordinate(random);
+            ref.mCount = 1;
+            ref.mEnabled = i % 16 != 0;
+            ref.mRefId = "reference_id_" + std::to_string(i % 100);
+            ref.mLocals.resize(locals(random));
+            list.push_back(std::move(ref));
+            other.push_back(std::make_unique<std::string>(64, 'a'));
+        }
+    }
+
+    // Same as CellStore::forEach visiting every enabled reference
+    template <class List>
+    float walkCell(const List& list)
+    {
+        float result = 0;
+        for (const Ref& ref : list)
+            if (ref.mCount > 0 && ref.mEnabled)
+                result += ref.mPosition[0] + ref.mPosition[1];
+        return result;
+    }
+
+    template <class List>
+    void walk(benchmark::State& state)
+    {
+        const std::size_t count = static_cast<std::size_t>(state.range(0));
+        List list;
+        fillCell(list, count);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(walkCell(list));
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    template <class List>
+    void fill(benchmark::State& state)
+    {
+        const std::size_t count = static_cast<std::size_t>(state.range(0));
+        for (auto _ : state)
+        {
+            List list;
+            fillCell(list, count);
+            benchmark::DoNotOptimize(list);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    void walkStdList(benchmark::State& state)
+    {
+        walk<std::list<Ref>>(state);
+    }
+
+    void walkChunkedList(benchmark::State& state)
+    {
+        walk<Misc::ChunkedList<Ref>>(state);
+    }
+
+    void fillStdList(benchmark::State& state)
+    {
+        fill<std::list<Ref>>(state);
+    }
+
+    void fillChunkedList(benchmark::State& state)
+    {
+        fill<Misc::ChunkedList<Ref>>(state);
+    }
+}
+
+// From a few references of one type to the statics of a big exterior cell
+BENCHMARK(walkStdList)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(walkChunkedList)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(fillStdList)->RangeMultiplier(4)->Range(4, 4096);
+BENCHMARK(fillChunkedList)->RangeMultiplier(4)->Range(4, 4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <components/misc/spatialgrid.hpp>
+
+#include <osg/Vec3f>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Actors are spread over 3x3 exterior cells around the player similar to the loaded area of an exterior
+    constexpr float areaSize = 3 * 8192;
+    constexpr float cellSize = 512;
+    constexpr float collisionsRadius = 200;
+    constexpr float headTrackingRadius = 400;
+
+    std::vector<osg::Vec3f> generatePositions(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> coordinate(0, areaSize);
+        std::uniform_real_distribution<float> height(0, 512);
+        std::vector<osg::Vec3f> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result.emplace_back(coordinate(random), coordinate(random), height(random));
+        return result;
+    }
+
+    // Actors are clustered in a small area like in a town or a battle
+    std::vector<osg::Vec3f> generateCrowdPositions(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::normal_distribution<float> coordinate(areaSize / 2, 1024);
+        std::vector<osg::Vec3f> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result.emplace_back(coordinate(random), coordinate(random), 0);
+        return result;
+    }
+
+    std::size_t findNeighborsBruteForce(const std::vector<osg::Vec3f>& positions, float radius)
+    {
+        std::size_t result = 0;
+        for (const osg::Vec3f& position : positions)
+            for (const osg::Vec3f& other : positions)
+                if (&position != &other && (other - position).length2() <= radius * radius)
+                    ++result;
+        return result;
+    }
+
+    std::size_t findNeighborsWithGrid(const Misc::SpatialGrid<std::size_t>& grid,
+        const std::vector<osg::Vec3f>& positions, float radius)
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            grid.forEachInRange(positions[i], radius, [&](std::size_t j, const osg::Vec3f& /*position*/) {
+                if (i != j)
+                    ++result;
+                return true;
+            });
+        return result;
+    }
+
+    void bruteForce(benchmark::State& state, const std::vector<osg::Vec3f>& positions, float radius)
+    {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(findNeighborsBruteForce(positions, radius));
+        state.SetComplexityN(state.range(0));
+    }
+
+    // Includes the cost of the per frame grid update where every actor moves a bit
+    void grid(benchmark::State& state, std::vector<osg::Vec3f> positions, float radius)
+    {
+        Misc::SpatialGrid<std::size_t> grid(cellSize);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+            grid.update(i, positions[i]);
+        float step = 5;
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                positions[i].x() += step;
+                grid.update(i, positions[i]);
+            }
+            step = -step;
+            benchmark::DoNotOptimize(findNeighborsWithGrid(grid, positions, radius));
+        }
+        state.SetComplexityN(state.range(0));
+    }
+
+    void bruteForceCollisions(benchmark::State& state)
+    {
+        bruteForce(state, generatePositions(static_cast<std::size_t>(state.range(0))), collisionsRadius);
+    }
+
+    void gridCollisions(benchmark::State& state)
+    {
+        grid(state, generatePositions(static_cast<std::size_t>(state.range(0))), collisionsRadius);
+    }
+
+    void bruteForceCrowdHeadTracking(benchmark::State& state)
+    {
+        bruteForce(state, generateCrowdPositions(static_cast<std::size_t>(state.range(0))), headTrackingRadius);
+    }
+
+    void gridCrowdHeadTracking(benchmark::State& state)
+    {
+        grid(state, generateCrowdPositions(static_cast<std::size_t>(state.range(0))), headTrackingRadius);
+    }
+}
+
+BENCHMARK(bruteForceCollisions)->RangeMultiplier(2)->Range(32, 2048)->Complexity();
+BENCHMARK(gridCollisions)->RangeMultiplier(2)->Range(32, 2048)->Complexity();
+BENCHMARK(bruteForceCrowdHeadTracking)->RangeMultiplier(2)->Range(32, 2048)->Complexity();
+BENCHMARK(gridCrowdHeadTracking)->RangeMultiplier(2)->Range(32, 2048)->Complexity();
+
+BENCHMARK_MAIN();
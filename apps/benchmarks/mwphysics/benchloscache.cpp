@@ -0,0 +1,189 @@
+#include <benchmark/benchmark.h>
+
+#include "apps/openmw/mwphysics/loscache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Actor
+    {
+        float mPosition = 0;
+    };
+
+    // Stands in for a ray test against the collision world
+    bool hasLineOfSight(const Actor& first, const Actor& second)
+    {
+        float value = first.mPosition - second.mPosition;
+        for (int i = 0; i < 64; ++i)
+            value = std::sqrt(value * value + 1.0f);
+        return value > 10;
+    }
+
+    std::vector<std::shared_ptr<Actor>> makeActors(std::size_t count)
+    {
+        std::vector<std::shared_ptr<Actor>> result;
+        for (std::size_t i = 0; i < count; ++i)
+            result.push_back(std::make_shared<Actor>(Actor{ static_cast<float>(i) }));
+        return result;
+    }
+
+    // Every actor checks line of sight to each other actor like in a large battle
+    template <class F>
+    void forEachPair(const std::vector<std::shared_ptr<Actor>>& actors, F&& f)
+    {
+        for (std::size_t i = 0; i < actors.size(); ++i)
+            for (std::size_t j = 0; j < actors.size(); ++j)
+                if (i != j)
+                    f(actors[i], actors[j]);
+    }
+
+    // Reproduces the cache used before: a vector searched linearly under a single lock
+    class VectorCache
+    {
+    public:
+        bool get(const std::shared_ptr<Actor>& actor1, const std::shared_ptr<Actor>& actor2)
+        {
+            const std::lock_guard lock(mMutex);
+            Request request(actor1, actor2);
+            const auto it = std::find_if(mRequests.begin(), mRequests.end(),
+                [&](const Request& v) { return v.mRawActors == request.mRawActors; });
+            if (it != mRequests.end())
+            {
+                it->mAge = 0;
+                return it->mResult;
+            }
+            request.mResult = hasLineOfSight(*actor1, *actor2);
+            mRequests.push_back(request);
+            return request.mResult;
+        }
+
+        void refresh()
+        {
+            for (Request& request : mRequests)
+            {
+                const auto actor1 = request.mActors[0].lock();
+                const auto actor2 = request.mActors[1].lock();
+                if (request.mAge++ > 0 || actor1 == nullptr || actor2 == nullptr)
+                    request.mStale = true;
+                else
+                    request.mResult = hasLineOfSight(*actor1, *actor2);
+            }
+            mRequests.erase(
+                std::remove_if(mRequests.begin(), mRequests.end(), [](const Request& v) { return v.mStale; }),
+                mRequests.end());
+        }
+
+    private:
+        struct Request
+        {
+            std::array<std::weak_ptr<Actor>, 2> mActors;
+            std::array<const Actor*, 2> mRawActors;
+            bool mResult = false;
+            bool mStale = false;
+            int mAge = 0;
+
+            Request(const std::shared_ptr<Actor>& actor1, const std::shared_ptr<Actor>& actor2)
+            {
+                if (actor1.get() < actor2.get())
+                {
+                    mActors = { actor1, actor2 };
+                    mRawActors = { actor1.get(), actor2.get() };
+                }
+                else
+                {
+                    mActors = { actor2, actor1 };
+                    mRawActors = { actor2.get(), actor1.get() };
+                }
+            }
+        };
+
+        std::mutex mMutex;
+        std::vector<Request> mRequests;
+    };
+
+    bool getLineOfSight(MWPhysics::LOSCache<Actor>& cache, const std::shared_ptr<Actor>& actor1,
+        const std::shared_ptr<Actor>& actor2)
+    {
+        if (const std::optional<bool> result = cache.find(actor1.get(), actor2.get()))
+            return *result;
+        const bool result = hasLineOfSight(*actor1, *actor2);
+        cache.insert(actor1, actor2, result);
+        return result;
+    }
+
+    void refreshInParallel(MWPhysics::LOSCache<Actor>& cache, std::size_t threadsCount)
+    {
+        std::atomic<std::size_t> next{ 0 };
+        const auto refresh = [&] {
+            std::size_t shard = 0;
+            while ((shard = next.fetch_add(1, std::memory_order_relaxed)) < cache.getShardsCount())
+                cache.refresh(shard, 0, hasLineOfSight);
+        };
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < threadsCount; ++i)
+            threads.emplace_back(refresh);
+        refresh();
+        for (std::thread& thread : threads)
+            thread.join();
+        cache.advance();
+    }
+
+    void vectorLookup(benchmark::State& state)
+    {
+        const auto actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        VectorCache cache;
+        forEachPair(actors, [&](const auto& a, const auto& b) { cache.get(a, b); });
+        for (auto _ : state)
+            forEachPair(actors, [&](const auto& a, const auto& b) { benchmark::DoNotOptimize(cache.get(a, b)); });
+        state.SetComplexityN(state.range(0));
+    }
+
+    void shardedLookup(benchmark::State& state)
+    {
+        const auto actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        MWPhysics::LOSCache<Actor> cache;
+        forEachPair(actors, [&](const auto& a, const auto& b) { getLineOfSight(cache, a, b); });
+        for (auto _ : state)
+            forEachPair(
+                actors, [&](const auto& a, const auto& b) { benchmark::DoNotOptimize(getLineOfSight(cache, a, b)); });
+        state.SetComplexityN(state.range(0));
+    }
+
+    void vectorRefresh(benchmark::State& state)
+    {
+        const auto actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        VectorCache cache;
+        for (auto _ : state)
+        {
+            forEachPair(actors, [&](const auto& a, const auto& b) { cache.get(a, b); });
+            cache.refresh();
+        }
+    }
+
+    void shardedRefresh(benchmark::State& state)
+    {
+        const auto actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        MWPhysics::LOSCache<Actor> cache;
+        for (auto _ : state)
+        {
+            forEachPair(actors, [&](const auto& a, const auto& b) { getLineOfSight(cache, a, b); });
+            refreshInParallel(cache, static_cast<std::size_t>(state.range(1)));
+        }
+    }
+}
+
+BENCHMARK(vectorLookup)->RangeMultiplier(2)->Range(8, 128)->Complexity();
+BENCHMARK(shardedLookup)->RangeMultiplier(2)->Range(8, 128)->Complexity();
+BENCHMARK(vectorRefresh)->Arg(64)->UseRealTime();
+BENCHMARK(shardedRefresh)->Args({ 64, 1 })->Args({ 64, 2 })->Args({ 64, 4 })->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,237 @@
+#include <benchmark/benchmark.h>
+
+#include <components/compiler/context.hpp>
+#include <components/compiler/errorhandler.hpp>
+#include <components/compiler/extensions.hpp>
+#include <components/compiler/extensions0.hpp>
+#include <components/compiler/fileparser.hpp>
+#include <components/compiler/opcodes.hpp>
+#include <components/compiler/scanner.hpp>
+
+#include <components/interpreter/context.hpp>
+#include <components/interpreter/installopcodes.hpp>
+#include <components/interpreter/interpreter.hpp>
+#include <components/interpreter/opcodes.hpp>
+#include <components/interpreter/runtime.hpp>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Scripts follow the structure of typical vanilla local scripts: a state machine driven by a timer with
+    // local variables, arithmetic and nested conditions.
+    const std::string timerScript = R"mwscript(Begin bench_timer
+short state
+short doOnce
+float timer
+long counter
+
+if ( doOnce == 0 )
+    set doOnce to 1
+    set timer to 0
+endif
+
+set timer to ( timer + GetSecondsPassed )
+
+if ( state == 0 )
+    if ( timer > 5 )
+        set state to 1
+        set timer to 0
+    endif
+elseif ( state == 1 )
+    set counter to ( counter + 1 )
+    if ( counter >= 100 )
+        set state to 2
+    endif
+elseif ( state == 2 )
+    if ( timer > 0.5 )
+        set state to 0
+        set counter to 0
+        set timer to 0
+    endif
+endif
+
+End
+)mwscript";
+
+    const std::string loopScript = R"mwscript(Begin bench_loop
+short index
+float sum
+float value
+
+set index to 0
+set sum to 0
+while ( index < 32 )
+    set value to ( Random 100 )
+    if ( value > 50 )
+        set sum to ( sum + value * 0.5 )
+    else
+        set sum to ( sum - value / 4 )
+    endif
+    set index to ( index + 1 )
+endwhile
+
+End
+)mwscript";
+
+    class CompilerContext : public Compiler::Context
+    {
+    public:
+        bool canDeclareLocals() const override { return true; }
+        char getGlobalType(const std::string& name) const override { return ' '; }
+        std::pair<char, bool> getMemberType(const std::string& name, const ESM::RefId& id) const override
+        {
+            return { ' ', false };
+        }
+        bool isId(const ESM::RefId& name) const override { return false; }
+    };
+
+    class ErrorHandler : public Compiler::ErrorHandler
+    {
+        void report(const std::string& message, const Compiler::TokenLoc& loc, Type type) override
+        {
+            if (type == ErrorMessage)
+                throw std::runtime_error("Failed to compile benchmark script: " + message);
+        }
+
+        void report(const std::string& message, Type type) override { report(message, {}, type); }
+    };
+
+    class InterpreterContext : public Interpreter::Context
+    {
+        std::vector<int> mShorts = std::vector<int>(16);
+        std::vector<int> mLongs = std::vector<int>(16);
+        std::vector<float> mFloats = std::vector<float>(16);
+
+    public:
+        ESM::RefId getTarget() const override { return ESM::RefId(); }
+        int getLocalShort(int index) const override { return mShorts[index]; }
+        int getLocalLong(int index) const override { return mLongs[index]; }
+        float getLocalFloat(int index) const override { return mFloats[index]; }
+        void setLocalShort(int index, int value) override { mShorts[index] = value; }
+        void setLocalLong(int index, int value) override { mLongs[index] = value; }
+        void setLocalFloat(int index, float value) override { mFloats[index] = value; }
+        void messageBox(std::string_view message, const std::vector<std::string>& buttons) override {}
+        void report(const std::string& message) override {}
+        int getGlobalShort(std::string_view name) const override { return {}; }
+        int getGlobalLong(std::string_view name) const override { return {}; }
+        float getGlobalFloat(std::string_view name) const override { return {}; }
+        void setGlobalShort(std::string_view name, int value) override {}
+        void setGlobalLong(std::string_view name, int value) override {}
+        void setGlobalFloat(std::string_view name, float value) override {}
+        std::vector<std::string> getGlobals() const override { return {}; }
+        char getGlobalType(std::string_view name) const override { return ' '; }
+        std::string getActionBinding(std::string_view action) const override { return {}; }
+        std::string_view getActorName() const override { return {}; }
+        std::string_view getNPCRace() const override { return {}; }
+        std::string_view getNPCClass() const override { return {}; }
+        std::string_view getNPCFaction() const override { return {}; }
+        std::string_view getNPCRank() const override { return {}; }
+        std::string_view getPCName() const override { return {}; }
+        std::string_view getPCRace() const override { return {}; }
+        std::string_view getPCClass() const override { return {}; }
+        std::string_view getPCRank() const override { return {}; }
+        std::string_view getPCNextRank() const override { return {}; }
+        int getPCBounty() const override { return {}; }
+        std::string_view getCurrentCellName() const override { return {}; }
+        int getMemberShort(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+        int getMemberLong(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+        float getMemberFloat(ESM::RefId id, std::string_view name, bool global) const override { return {}; }
+        void setMemberShort(ESM::RefId id, std::string_view name, int value, bool global) override {}
+        void setMemberLong(ESM::RefId id, std::string_view name, int value, bool global) override {}
+        void setMemberFloat(ESM::RefId id, std::string_view name, float value, bool global) override {}
+    };
+
+    class OpGetSecondsPassed : public Interpreter::Opcode0
+    {
+    public:
+        void execute(Interpreter::Runtime& runtime) override { runtime.push(Interpreter::Type_Float(1.0f / 60)); }
+    };
+
+    class OpRandom : public Interpreter::Opcode0
+    {
+        unsigned int mSeed = 0;
+
+    public:
+        void execute(Interpreter::Runtime& runtime) override
+        {
+            const Interpreter::Type_Integer limit = runtime[0].mInteger;
+            runtime.pop();
+            mSeed = mSeed * 1103515245 + 12345;
+            runtime.push(static_cast<Interpreter::Type_Float>(limit > 0 ? (mSeed >> 16) % limit : 0));
+        }
+    };
+
+    Interpreter::Program compile(const std::string& script)
+    {
+        ErrorHandler errorHandler;
+        CompilerContext compilerContext;
+        Compiler::Extensions extensions;
+        Compiler::registerExtensions(extensions);
+        compilerContext.setExtensions(&extensions);
+        Compiler::FileParser parser(errorHandler, compilerContext);
+        std::istringstream input(script);
+        Compiler::Scanner scanner(errorHandler, input, compilerContext.getExtensions());
+        scanner.scan(parser);
+        return parser.getProgram();
+    }
+
+    void installBenchmarkOpcodes(Interpreter::Interpreter& interpreter)
+    {
+        Interpreter::installOpcodes(interpreter);
+        interpreter.installSegment5<OpGetSecondsPassed>(Compiler::Misc::opcodeGetSecondsPassed);
+        interpreter.installSegment5<OpRandom>(Compiler::Misc::opcodeRandom);
+    }
+
+    // Looks up opcode handler for each executed instruction
+    void runProgram(benchmark::State& state, const std::string& script)
+    {
+        const Interpreter::Program program = compile(script);
+        Interpreter::Interpreter interpreter;
+        installBenchmarkOpcodes(interpreter);
+        InterpreterContext context;
+        for (auto _ : state)
+            interpreter.run(program, context);
+    }
+
+    void runDecodedProgram(benchmark::State& state, const std::string& script)
+    {
+        const Interpreter::Program program = compile(script);
+        Interpreter::Interpreter interpreter;
+        installBenchmarkOpcodes(interpreter);
+        const Interpreter::DecodedProgram decoded = interpreter.decode(program);
+        InterpreterContext context;
+        for (auto _ : state)
+            interpreter.run(program, decoded, context);
+    }
+
+    void runTimerScript(benchmark::State& state)
+    {
+        runProgram(state, timerScript);
+    }
+
+    void runDecodedTimerScript(benchmark::State& state)
+    {
+        runDecodedProgram(state, timerScript);
+    }
+
+    void runLoopScript(benchmark::State& state)
+    {
+        runProgram(state, loopScript);
+    }
+
+    void runDecodedLoopScript(benchmark::State& state)
+    {
+        runDecodedProgram(state, loopScript);
+    }
+}
+
+BENCHMARK(runTimerScript);
+BENCHMARK(runDecodedTimerScript);
+BENCHMARK(runLoopScript);
+BENCHMARK(runDecodedLoopScript);
+
+BENCHMARK_MAIN();
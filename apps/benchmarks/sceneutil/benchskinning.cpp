@@ -0,0 +1,169 @@
+#include <benchmark/benchmark.h>
+
+#include <components/sceneutil/skinning.hpp>
+
+#include <osg/Matrixf>
+#include <osg/Vec3f>
+#include <osg/Vec4f>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t bonesCount = 40;
+    // Typical actor mesh has a few vertices per unique combination of bone weights
+    constexpr std::size_t verticesPerGroup = 8;
+
+    struct Mesh
+    {
+        std::vector<osg::Matrixf> mInvBindMatrices;
+        std::vector<osg::Matrixf> mBoneMatrices;
+        SceneUtil::SkinInfluences mInfluences;
+        std::vector<osg::Vec3f> mSourcePositions;
+        std::vector<osg::Vec3f> mSourceNormals;
+        std::vector<osg::Vec4f> mSourceTangents;
+        std::vector<osg::Vec3f> mPositions;
+        std::vector<osg::Vec3f> mNormals;
+        std::vector<osg::Vec4f> mTangents;
+    };
+
+    osg::Matrixf generateMatrix(std::minstd_rand& random)
+    {
+        std::uniform_real_distribution<float> angle(-osg::PI, osg::PI);
+        std::uniform_real_distribution<float> offset(-100, 100);
+        return osg::Matrixf::rotate(angle(random), osg::Vec3f(0, 0, 1))
+            * osg::Matrixf::rotate(angle(random), osg::Vec3f(1, 0, 0))
+            * osg::Matrixf::translate(offset(random), offset(random), offset(random));
+    }
+
+    osg::Vec3f generateVec3f(std::minstd_rand& random)
+    {
+        std::uniform_real_distribution<float> coordinate(-1, 1);
+        return osg::Vec3f(coordinate(random), coordinate(random), coordinate(random));
+    }
+
+    Mesh generateMesh(std::size_t verticesCount)
+    {
+        std::minstd_rand random;
+        Mesh mesh;
+        for (std::size_t i = 0; i < bonesCount; ++i)
+        {
+            mesh.mInvBindMatrices.push_back(generateMatrix(random));
+            mesh.mBoneMatrices.push_back(generateMatrix(random));
+        }
+        std::uniform_int_distribution<std::size_t> weightsCount(1, 4);
+        std::uniform_int_distribution<std::uint16_t> bone(0, bonesCount - 1);
+        std::uniform_real_distribution<float> weight(0.1f, 1);
+        SceneUtil::SkinInfluences& influences = mesh.mInfluences;
+        for (std::size_t begin = 0; begin < verticesCount; begin += verticesPerGroup)
+        {
+            const std::size_t count = weightsCount(random);
+            std::vector<float> weights(count);
+            float sum = 0;
+            for (float& v : weights)
+                sum += v = weight(random);
+            for (float v : weights)
+            {
+                influences.mBones.push_back(bone(random));
+                influences.mWeights.push_back(v / sum);
+            }
+            influences.mWeightOffsets.push_back(static_cast<std::uint32_t>(influences.mBones.size()));
+            for (std::size_t i = begin; i < std::min(begin + verticesPerGroup, verticesCount); ++i)
+                influences.mVertices.push_back(static_cast<std::uint16_t>(i));
+            influences.mVertexOffsets.push_back(static_cast<std::uint32_t>(influences.mVertices.size()));
+        }
+        for (std::size_t i = 0; i < verticesCount; ++i)
+        {
+            mesh.mSourcePositions.push_back(generateVec3f(random) * 100);
+            mesh.mSourceNormals.push_back(generateVec3f(random));
+            mesh.mSourceTangents.emplace_back(generateVec3f(random), 1);
+        }
+        // Vertices of a group are not adjacent in a real mesh
+        std::shuffle(influences.mVertices.begin(), influences.mVertices.end(), random);
+        mesh.mPositions = mesh.mSourcePositions;
+        mesh.mNormals = mesh.mSourceNormals;
+        mesh.mTangents = mesh.mSourceTangents;
+        return mesh;
+    }
+
+    // Skinning done by multiplying full matrices for each weight of each group
+    void skinWithMatrices(Mesh& mesh)
+    {
+        const SceneUtil::SkinInfluences& influences = mesh.mInfluences;
+        for (std::size_t group = 0; group < influences.getGroupsCount(); ++group)
+        {
+            osg::Matrixf result(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
+            for (std::uint32_t i = influences.mWeightOffsets[group]; i < influences.mWeightOffsets[group + 1]; ++i)
+            {
+                const std::uint16_t bone = influences.mBones[i];
+                const osg::Matrixf m = mesh.mInvBindMatrices[bone] * mesh.mBoneMatrices[bone];
+                const float weight = influences.mWeights[i];
+                for (int row = 0; row < 4; ++row)
+                    for (int column = 0; column < 3; ++column)
+                        result(row, column) += m(row, column) * weight;
+            }
+            for (std::uint32_t i = influences.mVertexOffsets[group]; i < influences.mVertexOffsets[group + 1]; ++i)
+            {
+                const std::uint16_t vertex = influences.mVertices[i];
+                mesh.mPositions[vertex] = result.preMult(mesh.mSourcePositions[vertex]);
+                mesh.mNormals[vertex] = osg::Matrixf::transform3x3(mesh.mSourceNormals[vertex], result);
+                const osg::Vec4f& tangent = mesh.mSourceTangents[vertex];
+                mesh.mTangents[vertex] = osg::Vec4f(
+                    osg::Matrixf::transform3x3(osg::Vec3f(tangent.x(), tangent.y(), tangent.z()), result),
+                    tangent.w());
+            }
+        }
+    }
+
+    void skinWithTransforms(Mesh& mesh, std::vector<SceneUtil::SkinTransform>& bones,
+        std::vector<SceneUtil::SkinTransform>& groups)
+    {
+        for (std::size_t i = 0; i < bonesCount; ++i)
+            bones[i] = SceneUtil::multiply(SceneUtil::makeSkinTransform(mesh.mInvBindMatrices[i]),
+                SceneUtil::makeSkinTransform(mesh.mBoneMatrices[i]));
+        SceneUtil::blendSkinTransforms(mesh.mInfluences, bones, groups);
+        SceneUtil::SkinVertices vertices;
+        vertices.mSourcePositions = mesh.mSourcePositions.data();
+        vertices.mPositions = mesh.mPositions.data();
+        vertices.mSourceNormals = mesh.mSourceNormals.data();
+        vertices.mNormals = mesh.mNormals.data();
+        vertices.mSourceTangents = mesh.mSourceTangents.data();
+        vertices.mTangents = mesh.mTangents.data();
+        SceneUtil::skinVertices(mesh.mInfluences, groups, vertices);
+    }
+
+    void matrices(benchmark::State& state)
+    {
+        Mesh mesh = generateMesh(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            skinWithMatrices(mesh);
+            benchmark::DoNotOptimize(mesh.mPositions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void transforms(benchmark::State& state)
+    {
+        Mesh mesh = generateMesh(static_cast<std::size_t>(state.range(0)));
+        std::vector<SceneUtil::SkinTransform> bones(bonesCount);
+        std::vector<SceneUtil::SkinTransform> groups(mesh.mInfluences.getGroupsCount());
+        for (auto _ : state)
+        {
+            skinWithTransforms(mesh, bones, groups);
+            benchmark::DoNotOptimize(mesh.mPositions.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(matrices)->RangeMultiplier(2)->Range(512, 8192);
+BENCHMARK(transforms)->RangeMultiplier(2)->Range(512, 8192);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include <components/vfs/archive.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct File : VFS::File
+    {
+        Files::IStreamPtr open() override { throw std::logic_error("Not implemented"); }
+
+        std::filesystem::path getPath() override { return {}; }
+    };
+
+    struct Archive : VFS::Archive
+    {
+        File mFile;
+        std::vector<std::string> mNames;
+
+        void listResources(std::map<std::string, VFS::File*>& out, char (*normalize)(char)) override
+        {
+            for (std::string name : mNames)
+            {
+                std::transform(name.begin(), name.end(), name.begin(), normalize);
+                out[name] = &mFile;
+            }
+        }
+
+        bool contains(const std::string& file, char (*normalize)(char)) const override { return false; }
+
+        std::string getDescription() const override { return "Archive"; }
+    };
+
+    // Names in the original case like they are referenced by NIF files and content records
+    std::vector<std::string> generateNames(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_int_distribution<int> letter('a', 'z');
+        std::uniform_int_distribution<std::size_t> length(4, 16);
+        const std::vector<std::string> directories
+            = { "Meshes\\f\\", "Meshes\\x\\", "Meshes\\i\\", "Textures\\", "Icons\\m\\", "Sound\\Fx\\" };
+        std::vector<std::string> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::string name = directories[i % directories.size()];
+            name += static_cast<char>(letter(random) - 'a' + 'A');
+            for (std::size_t j = length(random); j > 0; --j)
+                name += static_cast<char>(letter(random));
+            name += std::to_string(i);
+            name += ".dds";
+            result.push_back(std::move(name));
+        }
+        return result;
+    }
+
+    // About the number of files in Morrowind with expansions and a few big mods
+    constexpr std::size_t fileCount = 100000;
+
+    std::unique_ptr<VFS::Manager> makeManager(const std::vector<std::string>& names)
+    {
+        auto archive = std::make_unique<Archive>();
+        archive->mNames = names;
+        auto manager = std::make_unique<VFS::Manager>(false);
+        manager->addArchive(std::move(archive));
+        manager->buildIndex();
+        return manager;
+    }
+
+    void existsForPresentFile(benchmark::State& state)
+    {
+        const std::vector<std::string> names = generateNames(fileCount);
+        const std::unique_ptr<VFS::Manager> manager = makeManager(names);
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(manager->exists(names[i]));
+            i = (i + 1) % names.size();
+        }
+    }
+
+    // Like probing for normal maps and other optional textures
+    void existsForMissingFile(benchmark::State& state)
+    {
+        const std::vector<std::string> names = generateNames(fileCount);
+        const std::unique_ptr<VFS::Manager> manager = makeManager(names);
+        std::vector<std::string> missing = names;
+        for (std::string& name : missing)
+            name.insert(name.size() - 4, "_n");
+        std::size_t i = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(manager->exists(missing[i]));
+            i = (i + 1) % missing.size();
+        }
+    }
+
+    void getRecursiveDirectoryIterator(benchmark::State& state)
+    {
+        const std::vector<std::string> names = generateNames(fileCount);
+        const std::unique_ptr<VFS::Manager> manager = makeManager(names);
+        for (auto _ : state)
+        {
+            std::size_t count = 0;
+            for (const std::string& name : manager->getRecursiveDirectoryIterator("Meshes/x/Ab"))
+                count += name.size();
+            benchmark::DoNotOptimize(count);
+        }
+    }
+
+    void buildIndex(benchmark::State& state)
+    {
+        const std::vector<std::string> names = generateNames(fileCount);
+        for (auto _ : state)
+            benchmark::DoNotOptimize(makeManager(names));
+    }
+}
+
+BENCHMARK(existsForPresentFile);
+BENCHMARK(existsForMissingFile);
+BENCHMARK(getRecursiveDirectoryIterator);
+BENCHMARK(buildIndex)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
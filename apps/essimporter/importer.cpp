@@ -348,7 +348,7 @@ namespace ESSImport
 
         ESM::ESMWriter writer;
 
-        writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
+        writer.setFormatVersion(ESM::MaxUncompressedSaveGameFormatVersion);
 
         std::ofstream stream(mOutFile, std::ios::out | std::ios::binary);
         // all unused
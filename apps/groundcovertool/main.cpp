@@ -0,0 +1,180 @@
+#include <components/debug/debugging.hpp>
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/cellref.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+#include <components/esmloader/esmdata.hpp>
+#include <components/esmloader/load.hpp>
+#include <components/files/collections.hpp>
+#include <components/files/configurationmanager.hpp>
+#include <components/files/multidircollection.hpp>
+#include <components/groundcoverdb/cellrefs.hpp>
+#include <components/groundcoverdb/database.hpp>
+#include <components/platform/platform.hpp>
+#include <components/to_utf8/to_utf8.hpp>
+#include <components/version/version.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    namespace bpo = boost::program_options;
+
+    using StringsVector = std::vector<std::string>;
+
+    constexpr std::string_view applicationName = "GroundcoverTool";
+
+    bpo::options_description makeOptionsDescription()
+    {
+        bpo::options_description result;
+        auto addOption = result.add_options();
+        addOption("help", "print help message");
+
+        addOption("version", "print version information and quit");
+
+        addOption("data",
+            bpo::value<Files::MaybeQuotedPathContainer>()
+                ->default_value(Files::MaybeQuotedPathContainer(), "data")
+                ->multitoken()
+                ->composing(),
+            "set data directories (later directories have higher priority)");
+
+        addOption("data-local",
+            bpo::value<Files::MaybeQuotedPathContainer::value_type>()->default_value(
+                Files::MaybeQuotedPathContainer::value_type(), ""),
+            "set local data directory (highest priority)");
+
+        addOption("resources",
+            bpo::value<Files::MaybeQuotedPath>()->default_value(Files::MaybeQuotedPath(), "resources"),
+            "set resources directory");
+
+        addOption("groundcover",
+            bpo::value<StringsVector>()->default_value(StringsVector(), "")->multitoken()->composing(),
+            "groundcover content file(s): esm/esp, or omwgame/omwaddon");
+
+        addOption("fs-strict", bpo::value<bool>()->implicit_value(true)->default_value(false),
+            "strict file system handling (no case folding)");
+
+        addOption("encoding", bpo::value<std::string>()->default_value("win1252"),
+            "Character encoding used in OpenMW game messages:\n"
+            "\n\twin1250 - Central and Eastern European such as Polish, Czech, Slovak, Hungarian, Slovene, Bosnian, "
+            "Croatian, Serbian (Latin script), Romanian and Albanian languages\n"
+            "\n\twin1251 - Cyrillic alphabet such as Russian, Bulgarian, Serbian Cyrillic and other languages\n"
+            "\n\twin1252 - Western European (Latin) alphabet, used by default");
+
+        Files::ConfigurationManager::addCommonOptions(result);
+
+        return result;
+    }
+
+    int runGroundcoverTool(int argc, char* argv[])
+    {
+        Platform::init();
+
+        bpo::options_description desc = makeOptionsDescription();
+
+        bpo::parsed_options options = bpo::command_line_parser(argc, argv).options(desc).allow_unregistered().run();
+        bpo::variables_map variables;
+
+        bpo::store(options, variables);
+        bpo::notify(variables);
+
+        if (variables.find("help") != variables.end())
+        {
+            getRawStdout() << desc << std::endl;
+            return 0;
+        }
+
+        Files::ConfigurationManager config;
+        config.readConfiguration(variables, desc);
+
+        setupLogging(config.getLogPath(), applicationName);
+
+        const std::string encoding(variables["encoding"].as<std::string>());
+        Log(Debug::Info) << ToUTF8::encodingUsingMessage(encoding);
+        ToUTF8::Utf8Encoder encoder(ToUTF8::calculateEncoding(encoding));
+
+        Files::PathContainer dataDirs(asPathContainer(variables["data"].as<Files::MaybeQuotedPathContainer>()));
+
+        auto local = variables["data-local"].as<Files::MaybeQuotedPathContainer::value_type>();
+        if (!local.empty())
+            dataDirs.push_back(std::move(local));
+
+        config.filterOutNonExistingPaths(dataDirs);
+
+        const auto fsStrict = variables["fs-strict"].as<bool>();
+        const auto resDir = variables["resources"].as<Files::MaybeQuotedPath>();
+        const auto v = Version::getOpenmwVersion(resDir);
+        Log(Debug::Info) << v.describe();
+        dataDirs.insert(dataDirs.begin(), resDir / "vfs");
+        const auto fileCollections = Files::Collections(dataDirs, !fsStrict);
+        const auto groundcoverFiles = variables["groundcover"].as<StringsVector>();
+
+        const std::filesystem::path dbPath = config.getUserDataPath() / "groundcover.bin";
+
+        if (groundcoverFiles.empty())
+        {
+            Log(Debug::Info) << "No groundcover files are specified, removing " << dbPath;
+            std::filesystem::remove(dbPath);
+            return 0;
+        }
+
+        ESM::ReadersCache readers;
+        EsmLoader::Query query;
+        query.mLoadCells = true;
+        const EsmLoader::EsmData esmData
+            = EsmLoader::loadEsmData(query, groundcoverFiles, fileCollections, readers, &encoder);
+
+        std::vector<ESM::RefId> ids;
+        std::map<ESM::RefId, std::uint32_t> idIndices;
+        std::vector<GroundcoverDb::CellInstances> cells;
+        std::size_t instancesCount = 0;
+
+        for (const ESM::Cell& cell : esmData.mCells)
+        {
+            if (!cell.isExterior())
+                continue;
+
+            GroundcoverDb::CellInstances& cellInstances = cells.emplace_back();
+            cellInstances.mX = cell.getGridX();
+            cellInstances.mY = cell.getGridY();
+
+            for (const ESM::CellRef& ref : GroundcoverDb::readCellRefs(cell, readers))
+            {
+                const auto [it, inserted] = idIndices.emplace(ref.mRefID, static_cast<std::uint32_t>(ids.size()));
+                if (inserted)
+                    ids.push_back(ref.mRefID);
+                cellInstances.mInstances.push_back(GroundcoverDb::makeInstance(ref, it->second));
+            }
+
+            instancesCount += cellInstances.mInstances.size();
+        }
+
+        Log(Debug::Info) << "Writing " << instancesCount << " groundcover instances of " << ids.size()
+                         << " objects in " << cells.size() << " cells to " << dbPath;
+
+        std::filesystem::path tmpPath = dbPath;
+        tmpPath += ".tmp";
+        GroundcoverDb::writeDatabase(
+            tmpPath, GroundcoverDb::getContentFiles(fileCollections, groundcoverFiles), ids, cells);
+        std::filesystem::rename(tmpPath, dbPath);
+
+        Log(Debug::Info) << "Done";
+
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    return wrapApplication(runGroundcoverTool, argc, argv, applicationName);
+}
@@ -43,6 +43,7 @@
 #include <components/sceneutil/color.hpp>
 #include <components/sceneutil/depth.hpp>
 #include <components/sceneutil/screencapture.hpp>
+#include <components/sceneutil/skinningbatch.hpp>
 #include <components/sceneutil/unrefqueue.hpp>
 #include <components/sceneutil/util.hpp>
 
@@ -57,11 +58,13 @@
 #include "mwlua/worker.hpp"
 
 #include "mwscript/interpretercontext.hpp"
+#include "mwscript/scriptcache.hpp"
 #include "mwscript/scriptmanagerimp.hpp"
 
 #include "mwsound/soundmanagerimp.hpp"
 
 #include "mwworld/class.hpp"
+#include "mwworld/contentfilesfingerprint.hpp"
 #include "mwworld/worldimp.hpp"
 
 #include "mwrender/vismask.hpp"
@@ -306,6 +309,7 @@ bool OMW::Engine::frame(float frametime)
 
         stats->setAttribute(frameNumber, "WorkQueue", mWorkQueue->getNumItems());
         stats->setAttribute(frameNumber, "WorkThread", mWorkQueue->getNumActiveThreads());
+        mWorkQueue->reportStats(frameNumber, *stats);
 
         mMechanicsManager->reportStats(frameNumber, *stats);
         mWorld->reportStats(frameNumber, *stats);
@@ -631,7 +635,10 @@ void OMW::Engine::setWindowIcon()
 
 void OMW::Engine::prepareEngine()
 {
-    mStateManager = std::make_unique<MWState::StateManager>(mCfgMgr.getUserDataPath() / "saves", mContentFiles);
+    mWorkQueue = new SceneUtil::WorkQueue(Settings::cells().mPreloadNumThreads);
+
+    mStateManager
+        = std::make_unique<MWState::StateManager>(mCfgMgr.getUserDataPath() / "saves", mContentFiles, mWorkQueue.get());
     mEnvironment.setStateManager(*mStateManager);
 
     bool stereoEnabled
@@ -645,7 +652,8 @@ void OMW::Engine::prepareEngine()
 
     mVFS = std::make_unique<VFS::Manager>(mFSStrict);
 
-    VFS::registerArchives(mVFS.get(), mFileCollections, mArchives, true);
+    VFS::registerArchives(
+        mVFS.get(), mFileCollections, mArchives, true, Settings::general().mMemoryMapArchives);
 
     mResourceSystem = std::make_unique<Resource::ResourceSystem>(mVFS.get());
     mResourceSystem->getSceneManager()->getShaderManager().setMaxTextureUnits(mGlMaxTextureImageUnits);
@@ -654,11 +662,20 @@ void OMW::Engine::prepareEngine()
     mResourceSystem->getSceneManager()->setFilterSettings(Settings::Manager::getString("texture mag filter", "General"),
         Settings::Manager::getString("texture min filter", "General"),
         Settings::Manager::getString("texture mipmap", "General"), Settings::Manager::getInt("anisotropy", "General"));
+    if (Settings::models().mSceneFileCache)
+        mResourceSystem->getSceneManager()->setSceneFileCachePath(mCfgMgr.getCachePath() / "scenes");
     mEnvironment.setResourceSystem(*mResourceSystem);
 
-    mWorkQueue = new SceneUtil::WorkQueue(Settings::cells().mPreloadNumThreads);
     mUnrefQueue = std::make_unique<SceneUtil::UnrefQueue>();
 
+    if (const std::size_t skinningThreads = Settings::general().mSkinningThreads; skinningThreads > 0)
+    {
+        // RigGeometries add themselves to the batch during update traversal and update operations are run after it
+        osg::ref_ptr<SceneUtil::SkinningBatch> skinningBatch = new SceneUtil::SkinningBatch(skinningThreads);
+        mViewer->getUpdateVisitor()->setUserData(skinningBatch);
+        mViewer->addUpdateOperation(skinningBatch);
+    }
+
     mScreenCaptureOperation = new SceneUtil::AsyncScreenCaptureOperation(mWorkQueue,
         new SceneUtil::WriteScreenshotToFileOperation(mCfgMgr.getScreenshotPath(),
             Settings::Manager::getString("screenshot format", "General"),
@@ -792,8 +809,13 @@ void OMW::Engine::prepareEngine()
     mScriptContext = std::make_unique<MWScript::CompilerContext>(MWScript::CompilerContext::Type_Full);
     mScriptContext->setExtensions(&mExtensions);
 
+    const ToUTF8::StatelessUtf8Encoder statelessEncoder = mEncoder->getStatelessEncoder();
+    auto scriptCache = std::make_unique<MWScript::ScriptCache>(mCfgMgr.getUserDataPath() / "scripts.cache",
+        MWWorld::ContentFilesFingerprint(mFileCollections, mContentFiles, &statelessEncoder));
+    scriptCache->load();
+
     mScriptManager = std::make_unique<MWScript::ScriptManager>(mWorld->getStore(), *mScriptContext, mWarningsMode,
-        mScriptBlacklistUse ? mScriptBlacklist : std::vector<ESM::RefId>());
+        mScriptBlacklistUse ? mScriptBlacklist : std::vector<ESM::RefId>(), std::move(scriptCache));
     mEnvironment.setScriptManager(*mScriptManager);
 
     // Create game mechanics system
@@ -960,6 +982,7 @@ void OMW::Engine::go()
     }
 
     mLuaWorker->join();
+    mStateManager->finishPendingSave();
 
     // Save user settings
     Settings::Manager::saveUser(mCfgMgr.getUserConfigPath() / "settings.cfg");
@@ -1,5 +1,7 @@
 #include "nearbybindings.hpp"
 
+#include <limits>
+
 #include <components/detournavigator/navigator.hpp>
 #include <components/detournavigator/navigatorutils.hpp>
 #include <components/lua/luastate.hpp>
@@ -10,6 +12,7 @@
 #include "../mwphysics/raycasting.hpp"
 
 #include "luamanagerimp.hpp"
+#include "types/types.hpp"
 #include "worldview.hpp"
 
 namespace sol
@@ -22,6 +25,44 @@ namespace sol
 
 namespace MWLua
 {
+    namespace
+    {
+        MWPhysics::RayCastingRequest makeRayCastingRequest(
+            const osg::Vec3f& from, const osg::Vec3f& to, const sol::optional<sol::table>& options)
+        {
+            MWPhysics::RayCastingRequest request{ from, to };
+            if (options)
+            {
+                sol::optional<LObject> ignoreObj = options->get<sol::optional<LObject>>("ignore");
+                if (ignoreObj)
+                    request.mIgnore = ignoreObj->ptr();
+                request.mMask = options->get<sol::optional<int>>("collisionType").value_or(request.mMask);
+                request.mRadius = options->get<sol::optional<float>>("radius").value_or(0);
+            }
+            if (request.mRadius > 0 && !request.mIgnore.isEmpty())
+                throw std::logic_error("Currently castRay doesn't support `ignore` when radius > 0");
+            return request;
+        }
+
+        WorldView::ObjectFilter makeObjectFilter(lua_State* lua, const sol::optional<sol::table>& options)
+        {
+            WorldView::ObjectFilter filter;
+            if (!options)
+                return filter;
+            if (const auto type = options->get<sol::optional<sol::table>>("type"))
+            {
+                const auto recordTypes = getPackageToRecordTypesTable(lua).get<sol::optional<sol::table>>(*type);
+                if (!recordTypes)
+                    throw std::runtime_error("Incorrect type argument: " + LuaUtil::toString(*type));
+                for (std::size_t i = 1; i <= recordTypes->size(); ++i)
+                    filter.mTypes.push_back(recordTypes->get<unsigned>(i));
+            }
+            if (const auto ignore = options->get<sol::optional<LObject>>("ignore"))
+                filter.mIgnore = ignore->id();
+            return filter;
+        }
+    }
+
     sol::table initNearbyPackage(const Context& context)
     {
         sol::table api(context.mLua->sol(), sol::create);
@@ -67,43 +108,42 @@ namespace MWLua
             }));
 
         api["castRay"] = [](const osg::Vec3f& from, const osg::Vec3f& to, sol::optional<sol::table> options) {
-            MWWorld::Ptr ignore;
-            int collisionType = MWPhysics::CollisionType_Default;
-            float radius = 0;
-            if (options)
-            {
-                sol::optional<LObject> ignoreObj = options->get<sol::optional<LObject>>("ignore");
-                if (ignoreObj)
-                    ignore = ignoreObj->ptr();
-                collisionType = options->get<sol::optional<int>>("collisionType").value_or(collisionType);
-                radius = options->get<sol::optional<float>>("radius").value_or(0);
-            }
+            const MWPhysics::RayCastingRequest request = makeRayCastingRequest(from, to, options);
             const MWPhysics::RayCastingInterface* rayCasting = MWBase::Environment::get().getWorld()->getRayCasting();
-            if (radius <= 0)
-                return rayCasting->castRay(from, to, ignore, std::vector<MWWorld::Ptr>(), collisionType);
+            if (request.mRadius <= 0)
+                return rayCasting->castRay(from, to, request.mIgnore, std::vector<MWWorld::Ptr>(), request.mMask);
             else
+                return rayCasting->castSphere(from, to, request.mRadius, request.mMask);
+        };
+        // The callbacks are called by the physics from the main thread while Lua is not running
+        api["asyncCastRay"] = [context](const sol::table& callback, const osg::Vec3f& from, const osg::Vec3f& to,
+                                  sol::optional<sol::table> options) {
+            std::vector<MWPhysics::RayCastingRequest> requests{ makeRayCastingRequest(from, to, options) };
+            MWBase::Environment::get().getWorld()->getRayCasting()->asyncCastRays(std::move(requests),
+                [context, callback = LuaUtil::Callback::fromLua(callback)](
+                    std::vector<MWPhysics::RayCastingResult> results) {
+                    context.mLuaManager->queueCallback(
+                        callback, sol::main_object(context.mLua->sol(), sol::in_place, results.front()));
+                });
+        };
+        api["asyncCastRays"] = [context](const sol::table& callback, const sol::table& rays) {
+            std::vector<MWPhysics::RayCastingRequest> requests;
+            requests.reserve(rays.size());
+            for (std::size_t i = 1; i <= rays.size(); ++i)
             {
-                if (!ignore.isEmpty())
-                    throw std::logic_error("Currently castRay doesn't support `ignore` when radius > 0");
-                return rayCasting->castSphere(from, to, radius, collisionType);
+                const sol::table ray = rays[i];
+                requests.push_back(
+                    makeRayCastingRequest(ray.get<osg::Vec3f>("from"), ray.get<osg::Vec3f>("to"), ray));
             }
+            MWBase::Environment::get().getWorld()->getRayCasting()->asyncCastRays(std::move(requests),
+                [context, callback = LuaUtil::Callback::fromLua(callback)](
+                    std::vector<MWPhysics::RayCastingResult> results) {
+                    sol::table list(context.mLua->sol(), sol::create);
+                    for (std::size_t i = 0; i < results.size(); ++i)
+                        list[i + 1] = std::move(results[i]);
+                    context.mLuaManager->queueCallback(callback, sol::main_object(list));
+                });
         };
-        // TODO: async raycasting
-        /*api["asyncCastRay"] = [luaManager = context.mLuaManager](
-            const Callback& luaCallback, const osg::Vec3f& from, const osg::Vec3f& to, sol::optional<sol::table>
-        options)
-        {
-            std::function<void(MWPhysics::RayCastingResult)> callback =
-                luaManager->wrapLuaCallback<MWPhysics::RayCastingResult>(luaCallback);
-            MWPhysics::RayCastingInterface* rayCasting = MWBase::Environment::get().getWorld()->getRayCasting();
-
-            // Handle options the same way as in `castRay`.
-
-            // NOTE: `callback` is not thread safe. If MWPhysics works in separate thread, it must put results to a
-        queue
-            //       and use this callback from the main thread at the beginning of the next frame processing.
-            rayCasting->asyncCastRay(callback, from, to, ignore, std::vector<MWWorld::Ptr>(), collisionType);
-        };*/
         api["castRenderingRay"] = [manager = context.mLuaManager](const osg::Vec3f& from, const osg::Vec3f& to) {
             if (!manager->isProcessingInputEvents())
             {
@@ -138,6 +178,24 @@ namespace MWLua
         api["items"] = LObjectList{ worldView->getItemsInScene() };
         api["players"] = LObjectList{ worldView->getPlayers() };
 
+        api["findInRadius"] = [worldView, lua = context.mLua](const osg::Vec3f& position, float radius,
+                                  const sol::optional<sol::table>& options) {
+            return LObjectList{ worldView->findObjectsInRange(
+                position, radius, makeObjectFilter(lua->sol(), options)) };
+        };
+        api["findInBox"] = [worldView, lua = context.mLua](
+                               const osg::Vec3f& min, const osg::Vec3f& max, const sol::optional<sol::table>& options) {
+            return LObjectList{ worldView->findObjectsInBox(min, max, makeObjectFilter(lua->sol(), options)) };
+        };
+        api["findNearest"] = [worldView, lua = context.mLua](const osg::Vec3f& position, std::size_t count,
+                                 const sol::optional<sol::table>& options) {
+            float maxDistance = std::numeric_limits<float>::max();
+            if (options)
+                maxDistance = options->get<sol::optional<float>>("maxDistance").value_or(maxDistance);
+            return LObjectList{ worldView->findNearestObjects(
+                position, count, maxDistance, makeObjectFilter(lua->sol(), options)) };
+        };
+
         api["NAVIGATOR_FLAGS"]
             = LuaUtil::makeStrictReadOnly(context.mLua->tableFromPairs<std::string_view, DetourNavigator::Flag>({
                 { "Walk", DetourNavigator::Flag_walk },
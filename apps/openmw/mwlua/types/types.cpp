@@ -153,10 +153,20 @@ namespace MWLua
         return lua[key];
     }
 
+    sol::table getPackageToRecordTypesTable(lua_State* L)
+    {
+        constexpr std::string_view key = "packageToRecordTypes";
+        sol::state_view lua(L);
+        if (lua[key] == sol::nil)
+            lua[key] = sol::table(lua, sol::create);
+        return lua[key];
+    }
+
     sol::table initTypesPackage(const Context& context)
     {
         auto* lua = context.mLua;
         sol::table types(lua->sol(), sol::create);
+        sol::table packageToRecordTypes = getPackageToRecordTypesTable(lua->sol());
         auto addType = [&](std::string_view name, std::vector<ESM::RecNameInts> recTypes,
                            std::optional<std::string_view> base = std::nullopt) -> sol::table {
             sol::table t(lua->sol(), sol::create);
@@ -177,6 +187,10 @@ namespace MWLua
                         return true;
                 return false;
             };
+            sol::table recordTypes(lua->sol(), sol::create);
+            for (ESM::RecNameInts recType : recTypes)
+                recordTypes.add(recType);
+            packageToRecordTypes[ro] = recordTypes;
             types[name] = ro;
             return t;
         };
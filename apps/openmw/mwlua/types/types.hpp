@@ -39,6 +39,8 @@ namespace MWLua
 
     sol::table getTypeToPackageTable(lua_State* L);
     sol::table getPackageToTypeTable(lua_State* L);
+    // Maps each type package (including base types like `types.Actor`) to a list of the matching record types.
+    sol::table getPackageToRecordTypesTable(lua_State* L);
 
     sol::table initTypesPackage(const Context& context);
 
@@ -1,5 +1,7 @@
 #include "worldview.hpp"
 
+#include <algorithm>
+
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/esmwriter.hpp>
 #include <components/esm3/loadcell.hpp>
@@ -14,8 +16,11 @@
 #include "../mwworld/timestamp.hpp"
 #include "../mwworld/worldmodel.hpp"
 
+#include "types/types.hpp"
+
 namespace MWLua
 {
+    static constexpr float OBJECTS_GRID_CELL_SIZE = 1024.f;
 
     void WorldView::update()
     {
@@ -24,6 +29,7 @@ namespace MWLua
         mContainersInScene.updateList();
         mDoorsInScene.updateList();
         mItemsInScene.updateList();
+        mGridPositionsChanged = true;
         mPaused = MWBase::Environment::get().getWindowManager()->isGuiMode();
     }
 
@@ -34,6 +40,7 @@ namespace MWLua
         mContainersInScene.clear();
         mDoorsInScene.clear();
         mItemsInScene.clear();
+        mGrids.clear();
     }
 
     WorldView::ObjectGroup* WorldView::chooseGroup(const MWWorld::Ptr& ptr)
@@ -71,6 +78,81 @@ namespace MWLua
             removeFromGroup(*group, ptr);
     }
 
+    void WorldView::updateGridPositions()
+    {
+        if (!mGridPositionsChanged)
+            return;
+        mGridPositionsChanged = false;
+        const MWWorld::WorldModel& worldModel = *MWBase::Environment::get().getWorldModel();
+        for (auto& [type, grid] : mGrids)
+        {
+            grid.updatePositions([&](const ObjectId& id, const osg::Vec3f& position) {
+                const MWWorld::Ptr ptr = worldModel.getPtr(id);
+                return ptr.isEmpty() ? position : ptr.getRefData().getPosition().asVec3();
+            });
+        }
+    }
+
+    template <class F>
+    void WorldView::forEachGrid(const ObjectFilter& filter, F&& f)
+    {
+        updateGridPositions();
+        if (filter.mTypes.empty())
+        {
+            for (const auto& [type, grid] : mGrids)
+                f(grid);
+            return;
+        }
+        for (unsigned type : filter.mTypes)
+            if (const auto grid = mGrids.find(type); grid != mGrids.end())
+                f(grid->second);
+    }
+
+    ObjectIdList WorldView::findObjectsInRange(const osg::Vec3f& position, float radius, const ObjectFilter& filter)
+    {
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        forEachGrid(filter, [&](const ObjectGrid& grid) {
+            grid.forEachInRange(position, radius, [&](const ObjectId& id, const osg::Vec3f& /*position*/) {
+                if (filter.mIgnore != id)
+                    result->push_back(id);
+                return true;
+            });
+        });
+        return result;
+    }
+
+    ObjectIdList WorldView::findObjectsInBox(const osg::Vec3f& min, const osg::Vec3f& max, const ObjectFilter& filter)
+    {
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        forEachGrid(filter, [&](const ObjectGrid& grid) {
+            grid.forEachInBox(min, max, [&](const ObjectId& id, const osg::Vec3f& /*position*/) {
+                if (filter.mIgnore != id)
+                    result->push_back(id);
+                return true;
+            });
+        });
+        return result;
+    }
+
+    ObjectIdList WorldView::findNearestObjects(
+        const osg::Vec3f& position, std::size_t count, float maxDistance, const ObjectFilter& filter)
+    {
+        std::vector<std::pair<float, ObjectId>> nearest;
+        forEachGrid(filter, [&](const ObjectGrid& grid) {
+            const std::vector<std::pair<float, ObjectId>> found = grid.findNearest(
+                position, count, maxDistance, [&](const ObjectId& id) { return filter.mIgnore != id; });
+            nearest.insert(nearest.end(), found.begin(), found.end());
+        });
+        // Each grid gives up to `count` nearest objects of its type
+        const auto middle = nearest.begin() + std::min(count, nearest.size());
+        std::partial_sort(nearest.begin(), middle, nearest.end());
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        result->reserve(middle - nearest.begin());
+        for (auto it = nearest.begin(); it != middle; ++it)
+            result->push_back(it->second);
+        return result;
+    }
+
     double WorldView::getGameTime() const
     {
         MWBase::World* world = MWBase::Environment::get().getWorld();
@@ -112,11 +194,16 @@ namespace MWLua
     {
         group.mSet.insert(getId(ptr));
         group.mChanged = true;
+        const auto grid = mGrids.try_emplace(getLiveCellRefType(ptr.mRef), OBJECTS_GRID_CELL_SIZE).first;
+        grid->second.update(getId(ptr), ptr.getRefData().getPosition().asVec3());
     }
 
     void WorldView::removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
         group.mSet.erase(getId(ptr));
         group.mChanged = true;
+        if (const auto grid = mGrids.find(getLiveCellRefType(ptr.mRef)); grid != mGrids.end())
+            grid->second.remove(getId(ptr));
     }
+
 }
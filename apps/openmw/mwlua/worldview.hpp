@@ -8,7 +8,12 @@
 
 #include "../mwworld/globals.hpp"
 
+#include <components/misc/spatialgrid.hpp>
+
+#include <map>
+#include <optional>
 #include <set>
+#include <vector>
 
 namespace ESM
 {
@@ -53,6 +58,21 @@ namespace MWLua
         ObjectIdList getItemsInScene() const { return mItemsInScene.mList; }
         ObjectIdList getPlayers() const { return mPlayers; }
 
+        struct ObjectFilter
+        {
+            // Types as returned by `getLiveCellRefType`. Any type if empty.
+            std::vector<unsigned> mTypes;
+            std::optional<ObjectId> mIgnore;
+        };
+
+        // Spatial queries over the objects of the lists above. The objects are indexed by position and the positions
+        // are refreshed on the first query of each frame.
+        ObjectIdList findObjectsInRange(const osg::Vec3f& position, float radius, const ObjectFilter& filter);
+        ObjectIdList findObjectsInBox(const osg::Vec3f& min, const osg::Vec3f& max, const ObjectFilter& filter);
+        // Returns up to `count` objects sorted by distance.
+        ObjectIdList findNearestObjects(
+            const osg::Vec3f& position, std::size_t count, float maxDistance, const ObjectFilter& filter);
+
         void objectAddedToScene(const MWWorld::Ptr& ptr);
         void objectRemovedFromScene(const MWWorld::Ptr& ptr);
 
@@ -72,9 +92,14 @@ namespace MWLua
             std::set<ObjectId> mSet;
         };
 
+        using ObjectGrid = Misc::SpatialGrid<ObjectId>;
+
         ObjectGroup* chooseGroup(const MWWorld::Ptr& ptr);
         void addToGroup(ObjectGroup& group, const MWWorld::Ptr& ptr);
         void removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr);
+        void updateGridPositions();
+        template <class F>
+        void forEachGrid(const ObjectFilter& filter, F&& f);
 
         ObjectGroup mActivatorsInScene;
         ObjectGroup mActorsInScene;
@@ -82,6 +107,9 @@ namespace MWLua
         ObjectGroup mDoorsInScene;
         ObjectGroup mItemsInScene;
         ObjectIdList mPlayers = std::make_shared<std::vector<ObjectId>>();
+        // Objects of all groups by type
+        std::map<unsigned, ObjectGrid> mGrids;
+        bool mGridPositionsChanged = false;
 
         double mSimulationTime = 0;
         bool mPaused = false;
@@ -115,7 +115,7 @@ namespace
 
     template <class T>
     void forEachFollowingPackage(
-        const std::list<MWMechanics::Actor>& actors, const MWWorld::Ptr& actorPtr, const MWWorld::Ptr& player, T&& func)
+        const MWMechanics::ActorsTable& actors, const MWWorld::Ptr& actorPtr, const MWWorld::Ptr& player, T&& func)
     {
         for (const MWMechanics::Actor& actor : actors)
         {
@@ -240,6 +240,12 @@ namespace MWMechanics
 
     namespace
     {
+        template <class F>
+        bool forEachActorInRange(const ActorsGrid<const Actor*>& grid, const osg::Vec3f& position, float radius, F&& f)
+        {
+            return grid.forEachInRange(position, radius, [&](const Actor* actor) { return f(*actor); });
+        }
+
         float getTimeToDestination(const AiPackage& package, const osg::Vec3f& position, float speed, float duration,
             const osg::Vec3f& halfExtents)
         {
@@ -248,19 +254,8 @@ namespace MWMechanics
             return (distanceToNextPathPoint - package.getNextPathPointTolerance(speed, duration, halfExtents)) / speed;
         }
 
-        void updateHeadTracking(const MWWorld::Ptr& actor, const MWWorld::Ptr& targetActor,
-            MWWorld::Ptr& headTrackTarget, float& sqrHeadTrackDistance, bool inCombatOrPursue)
+        float getMaxHeadTrackDistance(const MWWorld::Ptr& actor)
         {
-            const auto& actorRefData = actor.getRefData();
-            if (!actorRefData.getBaseNode())
-                return;
-
-            if (targetActor.getClass().getCreatureStats(targetActor).isDead())
-                return;
-
-            if (isTargetMagicallyHidden(targetActor))
-                return;
-
             static const float fMaxHeadTrackDistance = MWBase::Environment::get()
                                                            .getESMStore()
                                                            ->get<ESM::GameSetting>()
@@ -275,6 +270,23 @@ namespace MWMechanics
             auto currentCell = actor.getCell()->getCell();
             if (!currentCell->isExterior() && !(currentCell->isQuasiExterior()))
                 maxDistance *= fInteriorHeadTrackMult;
+            return maxDistance;
+        }
+
+        void updateHeadTracking(const MWWorld::Ptr& actor, const MWWorld::Ptr& targetActor,
+            MWWorld::Ptr& headTrackTarget, float& sqrHeadTrackDistance, bool inCombatOrPursue)
+        {
+            const auto& actorRefData = actor.getRefData();
+            if (!actorRefData.getBaseNode())
+                return;
+
+            if (targetActor.getClass().getCreatureStats(targetActor).isDead())
+                return;
+
+            if (isTargetMagicallyHidden(targetActor))
+                return;
+
+            const float maxDistance = getMaxHeadTrackDistance(actor);
 
             const osg::Vec3f actor1Pos(actorRefData.getPosition().asVec3());
             const osg::Vec3f actor2Pos(targetActor.getRefData().getPosition().asVec3());
@@ -299,7 +311,7 @@ namespace MWMechanics
         }
 
         void updateHeadTracking(
-            const MWWorld::Ptr& ptr, const std::list<Actor>& actors, bool isPlayer, CharacterController& ctrl)
+            const MWWorld::Ptr& ptr, const ActorsGrid<const Actor*>& actors, bool isPlayer, CharacterController& ctrl)
         {
             float sqrHeadTrackDistance = std::numeric_limits<float>::max();
             MWWorld::Ptr headTrackTarget;
@@ -326,14 +338,13 @@ namespace MWMechanics
                 else
                 {
                     // Find something nearby.
-                    for (const Actor& otherActor : actors)
-                    {
-                        if (otherActor.getPtr() == ptr)
-                            continue;
-
-                        updateHeadTracking(
-                            ptr, otherActor.getPtr(), headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
-                    }
+                    forEachActorInRange(actors, ptr.getRefData().getPosition().asVec3(),
+                        getMaxHeadTrackDistance(ptr), [&](const Actor& otherActor) {
+                            if (otherActor.getPtr() != ptr)
+                                updateHeadTracking(
+                                    ptr, otherActor.getPtr(), headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
+                            return true;
+                        });
                 }
             }
 
@@ -1193,11 +1204,12 @@ namespace MWMechanics
         MWRender::Animation* anim = MWBase::Environment::get().getWorld()->getAnimation(ptr);
         if (!anim)
             return;
-        const auto it = mActors.emplace(mActors.end(), ptr, anim);
-        mIndex.emplace(ptr.mRef, it);
+        Actor& actor = mActors.emplace(ptr, anim);
+        mIndex.emplace(ptr.mRef, &actor);
+        mGrid.update(&actor, ptr.getRefData().getPosition().asVec3());
 
         if (updateImmediately)
-            it->getCharacterController().update(0);
+            actor.getCharacterController().update(0);
 
         // We should initially hide actors outside of processing range.
         // Note: since we update player after other actors, distance will be incorrect during teleportation.
@@ -1205,7 +1217,7 @@ namespace MWMechanics
         if (MWBase::Environment::get().getWorld()->getPlayer().wasTeleported())
             return;
 
-        updateVisibility(ptr, it->getCharacterController());
+        updateVisibility(ptr, actor.getCharacterController());
     }
 
     void Actors::updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const
@@ -1244,7 +1256,8 @@ namespace MWMechanics
         {
             if (!keepActive)
                 removeTemporaryEffects(iter->second->getPtr());
-            mActors.erase(iter->second);
+            mGrid.remove(iter->second);
+            mActors.erase(*iter->second);
             mIndex.erase(iter);
         }
     }
@@ -1287,25 +1300,34 @@ namespace MWMechanics
         return false;
     }
 
-    void Actors::updateActor(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr) const
+    void Actors::updateActor(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr)
     {
         const auto iter = mIndex.find(old.mRef);
         if (iter != mIndex.end())
+        {
             iter->second->updatePtr(ptr);
+            mGrid.update(iter->second, ptr.getRefData().getPosition().asVec3());
+        }
+    }
+
+    void Actors::updatePosition(const MWWorld::Ptr& ptr)
+    {
+        const auto iter = mIndex.find(ptr.mRef);
+        if (iter != mIndex.end())
+            mGrid.update(iter->second, ptr.getRefData().getPosition().asVec3());
     }
 
     void Actors::dropActors(const MWWorld::CellStore* cellStore, const MWWorld::Ptr& ignore)
     {
-        for (auto iter = mActors.begin(); iter != mActors.end();)
+        for (auto iter = mActors.begin(); iter != mActors.end(); ++iter)
         {
             if ((iter->getPtr().isInCell() && iter->getPtr().getCell() == cellStore) && iter->getPtr() != ignore)
             {
                 removeTemporaryEffects(iter->getPtr());
                 mIndex.erase(iter->getPtr().mRef);
-                iter = mActors.erase(iter);
+                mGrid.remove(&*iter);
+                mActors.erase(iter);
             }
-            else
-                ++iter;
         }
     }
 
@@ -1428,12 +1450,11 @@ namespace MWMechanics
             osg::Vec2f movementCorrection(0, 0);
             float angleToApproachingActor = 0;
 
-            // Iterate through all other actors and predict collisions.
-            for (const Actor& otherActor : mActors)
-            {
+            // Iterate through nearby actors and predict collisions.
+            forEachActorInRange(mGrid, basePos, maxDistToCheck, [&](const Actor& otherActor) {
                 const MWWorld::Ptr& otherPtr = otherActor.getPtr();
                 if (otherPtr == ptr || otherPtr == currentTarget)
-                    continue;
+                    return true;
 
                 const osg::Vec3f otherHalfExtents = world->getHalfExtents(otherPtr);
                 const osg::Vec3f deltaPos = otherPtr.getRefData().getPosition().asVec3() - basePos;
@@ -1442,11 +1463,11 @@ namespace MWMechanics
 
                 // Ignore actors which are not close enough or come from behind.
                 if (dist > maxDistToCheck || relPos.y() < 0)
-                    continue;
+                    return true;
 
                 // Don't check for a collision if vertical distance is greater then the actor's height.
                 if (deltaPos.z() > halfExtents.z() * 2 || deltaPos.z() < -otherHalfExtents.z() * 2)
-                    continue;
+                    return true;
 
                 const osg::Vec3f speed = otherPtr.getClass().getMovementSettings(otherPtr).asVec3()
                     * otherPtr.getClass().getMaxSpeed(otherPtr);
@@ -1462,17 +1483,17 @@ namespace MWMechanics
                 const float v2 = relSpeed.length2();
                 const float Dh = vr * vr - v2 * (relPos.length2() - collisionDist * collisionDist);
                 if (Dh <= 0 || v2 == 0)
-                    continue; // No solution; distance is always >= collisionDist.
+                    return true; // No solution; distance is always >= collisionDist.
                 const float t = (-vr - std::sqrt(Dh)) / v2;
 
                 if (t < 0 || t > timeToCollision)
-                    continue;
+                    return true;
 
                 // Check visibility and awareness last as it's expensive.
                 if (!MWBase::Environment::get().getWorld()->getLOS(otherPtr, ptr))
-                    continue;
+                    return true;
                 if (!MWBase::Environment::get().getMechanicsManager()->awarenessCheck(otherPtr, ptr))
-                    continue;
+                    return true;
 
                 timeToCollision = t;
                 angleToApproachingActor = std::atan2(deltaPos.x(), deltaPos.y());
@@ -1486,7 +1507,9 @@ namespace MWMechanics
                 if (otherPtr.getClass().getCreatureStats(otherPtr).isDead())
                     // In case of dead body still try to go around (it looks natural), but reduce the correction twice.
                     movementCorrection.y() *= 0.5f;
-            }
+
+                return true;
+            });
 
             if (timeToCollision < timeToCheck)
             {
@@ -1508,6 +1531,8 @@ namespace MWMechanics
 
     void Actors::update(float duration, bool paused)
     {
+        mActors.compact();
+
         if (!paused)
         {
             const float updateEquippedLightInterval = 1.0f;
@@ -1533,6 +1558,8 @@ namespace MWMechanics
 
             /// \todo move update logic to Actor class where appropriate
 
+            mActors.updateFrameState(playerPos, mActorsProcessingRange);
+
             std::map<const MWWorld::Ptr, const std::set<MWWorld::Ptr>>
                 cachedAllies; // will be filled as engageCombat iterates
 
@@ -1548,16 +1575,16 @@ namespace MWMechanics
             const bool godmode = MWBase::Environment::get().getWorld()->getGodModeState();
 
             // AI and magic effects update
-            for (Actor& actor : mActors)
+            for (auto it = mActors.begin(), end = mActors.end(); it != end; ++it)
             {
+                Actor& actor = *it;
                 const bool isPlayer = actor.getPtr() == player;
                 CharacterController& ctrl = actor.getCharacterController();
                 MWBase::LuaManager::ActorControls* luaControls
                     = MWBase::Environment::get().getLuaManager()->getActorControls(actor.getPtr());
 
-                const float distSqr = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length2();
                 // AI processing is only done within given distance to the player.
-                const bool inProcessingRange = distSqr <= mActorsProcessingRange * mActorsProcessingRange;
+                const bool inProcessingRange = mActors.isInProcessingRange(it.getIndex());
 
                 // If dead or no longer in combat, no longer store any actors who attempted to hit us. Also remove for
                 // the player.
@@ -1609,16 +1636,21 @@ namespace MWMechanics
                             if (!isPlayer)
                                 adjustCommandedActor(actor.getPtr());
 
-                            for (const Actor& otherActor : mActors)
+                            // player is not AI-controlled
+                            if (!isPlayer)
                             {
-                                if (otherActor.getPtr() == actor.getPtr() || isPlayer) // player is not AI-controlled
-                                    continue;
-                                engageCombat(
-                                    actor.getPtr(), otherActor.getPtr(), cachedAllies, otherActor.getPtr() == player);
+                                // engageCombat ignores actors outside of processing range
+                                forEachActorInRange(mGrid, actor.getPtr().getRefData().getPosition().asVec3(),
+                                    mActorsProcessingRange, [&](const Actor& otherActor) {
+                                        if (otherActor.getPtr() != actor.getPtr())
+                                            engageCombat(actor.getPtr(), otherActor.getPtr(), cachedAllies,
+                                                otherActor.getPtr() == player);
+                                        return true;
+                                    });
                             }
                         }
                         if (mTimerUpdateHeadTrack == 0)
-                            updateHeadTracking(actor.getPtr(), mActors, isPlayer, ctrl);
+                            updateHeadTracking(actor.getPtr(), mGrid, isPlayer, ctrl);
 
                         if (actor.getPtr().getClass().isNpc() && !isPlayer)
                             updateCrimePursuit(actor.getPtr(), duration);
@@ -1667,9 +1699,9 @@ namespace MWMechanics
 
             // Animation/movement update
             CharacterController* playerCharacter = nullptr;
-            for (Actor& actor : mActors)
+            for (auto it = mActors.begin(), end = mActors.end(); it != end; ++it)
             {
-                const float dist = (playerPos - actor.getPtr().getRefData().getPosition().asVec3()).length();
+                Actor& actor = *it;
                 const bool isPlayer = actor.getPtr() == player;
                 CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
                 // Actors with active AI should be able to move.
@@ -1679,7 +1711,7 @@ namespace MWMechanics
                     MWMechanics::AiSequence& seq = stats.getAiSequence();
                     alwaysActive = !seq.isEmpty() && seq.getActivePackage().alwaysActive();
                 }
-                const bool inRange = isPlayer || dist <= mActorsProcessingRange || alwaysActive;
+                const bool inRange = isPlayer || mActors.isInProcessingRange(it.getIndex()) || alwaysActive;
                 const int activeFlag = isPlayer ? 2 : 1; // Can be changed back to '2' to keep updating bounding boxes
                                                          // off screen (more accurate, but slower)
                 const int active = inRange ? activeFlag : 0;
@@ -2069,22 +2101,15 @@ namespace MWMechanics
 
     void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
     {
-        for (const Actor& actor : mActors)
-        {
-            if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius)
-                out.push_back(actor.getPtr());
-        }
+        forEachActorInRange(mGrid, position, radius, [&](const Actor& actor) {
+            out.push_back(actor.getPtr());
+            return true;
+        });
     }
 
     bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius) const
     {
-        for (const Actor& actor : mActors)
-        {
-            if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius)
-                return true;
-        }
-
-        return false;
+        return !forEachActorInRange(mGrid, position, radius, [](const Actor&) { return false; });
     }
 
     std::vector<MWWorld::Ptr> Actors::getActorsSidingWith(const MWWorld::Ptr& actorPtr, bool excludeInfighting) const
@@ -2308,6 +2333,7 @@ namespace MWMechanics
     void Actors::clear()
     {
         mIndex.clear();
+        mGrid.clear();
         mActors.clear();
         mDeathCount.clear();
     }
@@ -2385,7 +2411,7 @@ namespace MWMechanics
         if (!MWBase::Environment::get().getMechanicsManager()->isAIActive())
             return;
 
-        for (auto it = mActors.begin(); it != mActors.end();)
+        for (auto it = mActors.begin(), end = mActors.end(); it != end;)
         {
             const MWWorld::Ptr ptr = it->getPtr();
             ++it;
@@ -1,13 +1,14 @@
 #ifndef GAME_MWMECHANICS_ACTORS_H
 #define GAME_MWMECHANICS_ACTORS_H
 
-#include <list>
 #include <map>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "actor.hpp"
+#include "actorsgrid.hpp"
+#include "actorstable.hpp"
 
 namespace ESM
 {
@@ -42,8 +43,8 @@ namespace MWMechanics
     public:
         Actors();
 
-        std::list<Actor>::const_iterator begin() const { return mActors.begin(); }
-        std::list<Actor>::const_iterator end() const { return mActors.end(); }
+        ActorsTable::const_iterator begin() const { return mActors.begin(); }
+        ActorsTable::const_iterator end() const { return mActors.end(); }
         std::size_t size() const { return mActors.size(); }
 
         void notifyDied(const MWWorld::Ptr& actor);
@@ -73,9 +74,12 @@ namespace MWMechanics
 
         void castSpell(const MWWorld::Ptr& ptr, const ESM::RefId& spellId, bool manualSpell = false) const;
 
-        void updateActor(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr) const;
+        void updateActor(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr);
         ///< Updates an actor with a new Ptr
 
+        void updatePosition(const MWWorld::Ptr& ptr);
+        ///< Updates the position of an actor used by proximity queries
+
         void dropActors(const MWWorld::CellStore* cellStore, const MWWorld::Ptr& ignore);
         ///< Deregister all actors (except for \a ignore) in the given cell.
 
@@ -178,8 +182,9 @@ namespace MWMechanics
         };
 
         std::map<ESM::RefId, int> mDeathCount;
-        std::list<Actor> mActors;
-        std::map<const MWWorld::LiveCellRefBase*, std::list<Actor>::iterator> mIndex;
+        ActorsTable mActors;
+        std::map<const MWWorld::LiveCellRefBase*, Actor*> mIndex;
+        ActorsGrid<const Actor*> mGrid;
         float mTimerDisposeSummonsCorpses;
         float mTimerUpdateHeadTrack = 0;
         float mTimerUpdateEquippedLight = 0;
@@ -0,0 +1,50 @@
+#ifndef OPENMW_MWMECHANICS_ACTORSGRID_H
+#define OPENMW_MWMECHANICS_ACTORSGRID_H
+
+#include <components/misc/spatialgrid.hpp>
+
+#include <osg/Vec3f>
+
+#include <cstddef>
+
+namespace MWMechanics
+{
+    /// \brief Positions of active actors for proximity queries
+    ///
+    /// Every position change of an actor has to be passed to update, including moves within a cell and teleportation,
+    /// so queries made later in the same frame find actors at their current positions.
+    template <class T>
+    class ActorsGrid
+    {
+    public:
+        static constexpr float sCellSize = 512.f;
+
+        ActorsGrid()
+            : mGrid(sCellSize)
+        {
+        }
+
+        std::size_t size() const { return mGrid.size(); }
+
+        /// Adds the actor or updates its position.
+        void update(const T& actor, const osg::Vec3f& position) { mGrid.update(actor, position); }
+
+        void remove(const T& actor) { mGrid.remove(actor); }
+
+        void clear() { mGrid.clear(); }
+
+        /// Calls f(actor) for each actor within the radius around the position. Iteration stops when f returns false.
+        /// \return Was iteration completed?
+        template <class F>
+        bool forEachInRange(const osg::Vec3f& position, float radius, F&& f) const
+        {
+            return mGrid.forEachInRange(
+                position, radius, [&](const T& actor, const osg::Vec3f& /*position*/) { return f(actor); });
+        }
+
+    private:
+        Misc::SpatialGrid<T> mGrid;
+    };
+}
+
+#endif
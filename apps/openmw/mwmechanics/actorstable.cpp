@@ -0,0 +1,88 @@
+#include "actorstable.hpp"
+
+#include <cassert>
+
+#include "../mwworld/ptr.hpp"
+
+#include "actor.hpp"
+
+namespace MWMechanics
+{
+    ActorsTable::ActorsTable() = default;
+
+    ActorsTable::~ActorsTable() = default;
+
+    Actor& ActorsTable::emplace(const MWWorld::Ptr& ptr, MWRender::Animation* animation)
+    {
+        Actor& actor = *mSlots.emplace_back(std::make_unique<Actor>(ptr, animation));
+        mSlotIndices.emplace(&actor, mSlots.size() - 1);
+        const osg::Vec3f position = ptr.getRefData().getPosition().asVec3();
+        mPositions.push_back(position);
+        mInProcessingRange.push_back(isNearPlayer(position));
+        ++mSize;
+        return actor;
+    }
+
+    void ActorsTable::erase(const_iterator it)
+    {
+        assert(mSlots[it.getIndex()] != nullptr);
+        mSlotIndices.erase(mSlots[it.getIndex()].get());
+        mSlots[it.getIndex()].reset();
+        --mSize;
+    }
+
+    void ActorsTable::erase(const Actor& actor)
+    {
+        const auto it = mSlotIndices.find(&actor);
+        assert(it != mSlotIndices.end());
+        mSlots[it->second].reset();
+        mSlotIndices.erase(it);
+        --mSize;
+    }
+
+    void ActorsTable::clear()
+    {
+        mSlots.clear();
+        mSlotIndices.clear();
+        mSize = 0;
+        mPositions.clear();
+        mInProcessingRange.clear();
+    }
+
+    void ActorsTable::compact()
+    {
+        if (mSize == mSlots.size())
+            return;
+
+        std::size_t end = 0;
+        for (std::size_t i = 0; i < mSlots.size(); ++i)
+        {
+            if (mSlots[i] == nullptr)
+                continue;
+            if (i != end)
+            {
+                mSlotIndices[mSlots[i].get()] = end;
+                mSlots[end] = std::move(mSlots[i]);
+                mPositions[end] = mPositions[i];
+                mInProcessingRange[end] = mInProcessingRange[i];
+            }
+            ++end;
+        }
+
+        mSlots.resize(end);
+        mPositions.resize(end);
+        mInProcessingRange.resize(end);
+    }
+
+    void ActorsTable::updateFrameState(const osg::Vec3f& playerPosition, float processingRange)
+    {
+        for (std::size_t i = 0; i < mSlots.size(); ++i)
+            if (mSlots[i] != nullptr)
+                mPositions[i] = mSlots[i]->getPtr().getRefData().getPosition().asVec3();
+
+        mPlayerPosition = playerPosition;
+        mSqrProcessingRange = processingRange * processingRange;
+        for (std::size_t i = 0; i < mPositions.size(); ++i)
+            mInProcessingRange[i] = isNearPlayer(mPositions[i]);
+    }
+}
@@ -0,0 +1,156 @@
+#ifndef OPENMW_MWMECHANICS_ACTORSTABLE_H
+#define OPENMW_MWMECHANICS_ACTORSTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <osg/Vec3f>
+
+namespace MWRender
+{
+    class Animation;
+}
+
+namespace MWWorld
+{
+    class Ptr;
+}
+
+namespace MWMechanics
+{
+    class Actor;
+
+    /// \brief Actors addressed by index with hot per-frame state kept in packed arrays
+    ///
+    /// Actor objects keep their addresses while they are in the table because character controllers are registered
+    /// as animation listeners. Removing an actor only clears its slot, slots are packed by compact. So actors can be
+    /// added and removed during iteration, iterators skip empty slots and visit actors added during iteration like
+    /// iterators of std::list did.
+    class ActorsTable
+    {
+        using Slots = std::vector<std::unique_ptr<Actor>>;
+
+    public:
+        template <class T>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<T>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T*;
+            using reference = T&;
+
+            Iterator() = default;
+
+            Iterator(const Slots& slots, std::size_t index)
+                : mSlots(&slots)
+                , mIndex(index)
+            {
+                skipEmpty();
+            }
+
+            reference operator*() const { return *(*mSlots)[mIndex]; }
+
+            pointer operator->() const { return (*mSlots)[mIndex].get(); }
+
+            Iterator& operator++()
+            {
+                ++mIndex;
+                skipEmpty();
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            operator Iterator<const T>() const { return Iterator<const T>(*mSlots, mIndex); }
+
+            /// Index of the actor in the packed arrays
+            std::size_t getIndex() const { return mIndex; }
+
+            /// End iterators compare equal to any iterator past the slots added so far, so a copy of end made before
+            /// adding actors still ends iteration after them.
+            friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+            {
+                if (lhs.isEnd() || rhs.isEnd())
+                    return lhs.isEnd() == rhs.isEnd();
+                return lhs.mIndex == rhs.mIndex;
+            }
+
+            friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+
+        private:
+            const Slots* mSlots = nullptr;
+            std::size_t mIndex = 0;
+
+            bool isEnd() const { return mSlots == nullptr || mIndex >= mSlots->size(); }
+
+            void skipEmpty()
+            {
+                while (mIndex < mSlots->size() && (*mSlots)[mIndex] == nullptr)
+                    ++mIndex;
+            }
+        };
+
+        using iterator = Iterator<Actor>;
+        using const_iterator = Iterator<const Actor>;
+
+        ActorsTable();
+
+        ~ActorsTable();
+
+        iterator begin() { return iterator(mSlots, 0); }
+        iterator end() { return iterator(mSlots, mSlots.size()); }
+        const_iterator begin() const { return const_iterator(mSlots, 0); }
+        const_iterator end() const { return const_iterator(mSlots, mSlots.size()); }
+
+        /// Number of actors, not slots
+        std::size_t size() const { return mSize; }
+
+        Actor& emplace(const MWWorld::Ptr& ptr, MWRender::Animation* animation);
+
+        void erase(const_iterator it);
+
+        void erase(const Actor& actor);
+
+        void clear();
+
+        /// Removes empty slots keeping the order of actors. Invalidates indices and iterators.
+        void compact();
+
+        /// Refreshes positions of all actors and their distances to the player. Actors added later are checked against
+        /// the same player position and processing range.
+        void updateFrameState(const osg::Vec3f& playerPosition, float processingRange);
+
+        /// Position of the actor at the last updateFrameState call
+        const osg::Vec3f& getPosition(std::size_t index) const { return mPositions[index]; }
+
+        bool isInProcessingRange(std::size_t index) const { return mInProcessingRange[index] != 0; }
+
+    private:
+        Slots mSlots;
+        std::unordered_map<const Actor*, std::size_t> mSlotIndices;
+        std::size_t mSize = 0;
+        std::vector<osg::Vec3f> mPositions;
+        std::vector<std::uint8_t> mInProcessingRange;
+        osg::Vec3f mPlayerPosition;
+        float mSqrProcessingRange = 0;
+
+        bool isNearPlayer(const osg::Vec3f& position) const
+        {
+            return (mPlayerPosition - position).length2() <= mSqrProcessingRange;
+        }
+    };
+}
+
+#endif
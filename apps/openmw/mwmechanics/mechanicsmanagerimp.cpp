@@ -293,6 +293,12 @@ namespace MWMechanics
             mObjects.updateObject(old, ptr);
     }
 
+    void MechanicsManager::updatePosition(const MWWorld::Ptr& ptr)
+    {
+        if (ptr.getClass().isActor())
+            mActors.updatePosition(ptr);
+    }
+
     void MechanicsManager::drop(const MWWorld::CellStore* cellStore)
     {
         mActors.dropActors(cellStore, getPlayer());
@@ -49,6 +49,9 @@ namespace MWMechanics
         void updateCell(const MWWorld::Ptr& old, const MWWorld::Ptr& ptr) override;
         ///< Moves an object to a new cell
 
+        void updatePosition(const MWWorld::Ptr& ptr) override;
+        ///< Notifies about a new position of an object, including moves within its cell
+
         void drop(const MWWorld::CellStore* cellStore) override;
         ///< Deregister all objects in the given cell.
 
@@ -0,0 +1,169 @@
+#ifndef OPENMW_MWPHYSICS_LOSCACHE_H
+#define OPENMW_MWPHYSICS_LOSCACHE_H
+
+#include <components/misc/hash.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace MWPhysics
+{
+    /// Line of sight results for pairs of objects. Entries are split into shards by the hash of the pair, each shard
+    /// has own lock so lookups take only a shared lock on a single shard and different shards can be refreshed
+    /// concurrently. Pairs are unordered: (a, b) and (b, a) share the same entry.
+    template <class T>
+    class LOSCache
+    {
+    public:
+        explicit LOSCache(std::size_t shardsCount = 16)
+            : mShards(shardsCount)
+        {
+            assert(shardsCount > 0);
+        }
+
+        std::size_t getShardsCount() const { return mShards.size(); }
+
+        /// Returns cached result and marks the entry as used by the current generation
+        std::optional<bool> find(const T* first, const T* second) const
+        {
+            const Key key = makeKey(first, second);
+            const Shard& shard = getShard(key);
+            const std::shared_lock lock(shard.mMutex);
+            const auto it = shard.mEntries.find(key);
+            if (it == shard.mEntries.end())
+                return std::nullopt;
+            it->second.mLastUse.store(mGeneration.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return it->second.mResult.load(std::memory_order_relaxed);
+        }
+
+        /// Adds result computed by the caller. Keeps the existing entry when the pair is already present.
+        void insert(const std::shared_ptr<T>& first, const std::shared_ptr<T>& second, bool result)
+        {
+            const Key key = makeKey(first.get(), second.get());
+            Shard& shard = getShard(key);
+            const std::lock_guard lock(shard.mMutex);
+            shard.mEntries.try_emplace(key, first, second, result, mGeneration.load(std::memory_order_relaxed));
+        }
+
+        /// Starts a new generation. Entries that are not used since are aged by one.
+        void advance() { mGeneration.fetch_add(1, std::memory_order_relaxed); }
+
+        /// Removes entries of the shard that are not used for more than maxAge generations or refer to destroyed
+        /// objects and updates results of the remaining ones with hasLineOfSight(const T&, const T&). Negative maxAge
+        /// removes all entries.
+        template <class F>
+        void refresh(std::size_t shardIndex, int maxAge, F&& hasLineOfSight)
+        {
+            Shard& shard = mShards[shardIndex];
+            const std::uint32_t generation = mGeneration.load(std::memory_order_relaxed);
+            {
+                const std::lock_guard lock(shard.mMutex);
+                std::erase_if(shard.mEntries, [&](const auto& v) {
+                    const std::uint32_t age = generation - v.second.mLastUse.load(std::memory_order_relaxed);
+                    return static_cast<std::int64_t>(age) > maxAge
+                        || v.second.mFirst.expired() || v.second.mSecond.expired();
+                });
+            }
+            const std::shared_lock lock(shard.mMutex);
+            for (auto& [key, entry] : shard.mEntries)
+            {
+                const std::shared_ptr<T> first = entry.mFirst.lock();
+                const std::shared_ptr<T> second = entry.mSecond.lock();
+                if (first == nullptr || second == nullptr)
+                    continue;
+                entry.mResult.store(hasLineOfSight(*first, *second), std::memory_order_relaxed);
+            }
+        }
+
+        std::size_t size() const
+        {
+            std::size_t result = 0;
+            for (const Shard& shard : mShards)
+            {
+                const std::shared_lock lock(shard.mMutex);
+                result += shard.mEntries.size();
+            }
+            return result;
+        }
+
+        void clear()
+        {
+            for (Shard& shard : mShards)
+            {
+                const std::lock_guard lock(shard.mMutex);
+                shard.mEntries.clear();
+            }
+        }
+
+    private:
+        using Key = std::pair<const T*, const T*>;
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const
+            {
+                std::size_t result = 0;
+                Misc::hashCombine(result, key.first);
+                Misc::hashCombine(result, key.second);
+                return result;
+            }
+        };
+
+        struct Entry
+        {
+            std::weak_ptr<T> mFirst;
+            std::weak_ptr<T> mSecond;
+            std::atomic<bool> mResult;
+            mutable std::atomic<std::uint32_t> mLastUse;
+
+            Entry(const std::shared_ptr<T>& first, const std::shared_ptr<T>& second, bool result,
+                std::uint32_t lastUse)
+                : mFirst(first)
+                , mSecond(second)
+                , mResult(result)
+                , mLastUse(lastUse)
+            {
+            }
+        };
+
+        struct Shard
+        {
+            mutable std::shared_mutex mMutex;
+            std::unordered_map<Key, Entry, KeyHash> mEntries;
+        };
+
+        std::vector<Shard> mShards;
+        std::atomic<std::uint32_t> mGeneration{ 0 };
+
+        static Key makeKey(const T* first, const T* second)
+        {
+            assert(first != second);
+            if (second < first)
+                std::swap(first, second);
+            return Key(first, second);
+        }
+
+        std::size_t getShardIndex(const Key& key) const
+        {
+            // Pointers are aligned so lower bits of their hash are mostly equal, use the upper bits of the product
+            // with a large odd constant instead
+            const std::uint64_t hash = static_cast<std::uint64_t>(KeyHash{}(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(hash >> 32) % mShards.size();
+        }
+
+        const Shard& getShard(const Key& key) const { return mShards[getShardIndex(key)]; }
+
+        Shard& getShard(const Key& key) { return mShards[getShardIndex(key)]; }
+    };
+}
+
+#endif
@@ -10,6 +10,7 @@
 
 #include <BulletCollision/BroadphaseCollision/btDbvtBroadphase.h>
 #include <BulletCollision/CollisionShapes/btCollisionShape.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
 #include <LinearMath/btThreads.h>
 
 #include <osg/Stats>
@@ -30,6 +31,7 @@
 #include "../mwbase/world.hpp"
 
 #include "actor.hpp"
+#include "closestnotmerayresultcallback.hpp"
 #include "contacttestwrapper.h"
 #include "movementsolver.hpp"
 #include "object.hpp"
@@ -411,6 +413,7 @@ namespace MWPhysics
         , mAdvanceSimulation(false)
         , mNextJob(0)
         , mNextLOS(0)
+        , mNextRayCast(0)
         , mFrameNumber(0)
         , mTimer(osg::Timer::instance())
         , mPrevStepCount(1)
@@ -507,9 +510,13 @@ namespace MWPhysics
         assert(mSimulations != &simulations);
 
         waitForWorkers();
+        finishRayCasts();
         prepareWork(timeAccum, simulations, frameStart, frameNumber, stats);
         if (mWorkersSync != nullptr)
             mWorkersSync->wakeUpWorkers();
+        // Without workers the casts are done by prepareWork, don't hold the results until the next frame
+        if (mNumThreads == 0)
+            finishRayCasts();
     }
 
     void PhysicsTaskScheduler::prepareWork(float& timeAccum, std::vector<Simulation>& simulations,
@@ -549,8 +556,16 @@ namespace MWPhysics
         mAdvanceSimulation = (mRemainingSteps != 0);
         mNumJobs = mSimulations->size();
         mNextLOS.store(0, std::memory_order_relaxed);
+        mNextRayCast.store(0, std::memory_order_relaxed);
         mNextJob.store(0, std::memory_order_release);
 
+        {
+            const std::lock_guard lock(mQueuedRayCastsMutex);
+            mRayCasts.swap(mQueuedRayCasts);
+            mRayCastBatches.swap(mQueuedRayCastBatches);
+        }
+        mRayCastHits.assign(mRayCasts.size(), RayCastHit{});
+
         if (mAdvanceSimulation)
             mWorldFrameData = std::make_unique<WorldFrameData>();
 
@@ -589,6 +604,13 @@ namespace MWPhysics
         }
     }
 
+    void PhysicsTaskScheduler::queueRayCasts(std::vector<RayCast> rayCasts, RayCastsCallback callback)
+    {
+        const std::lock_guard lock(mQueuedRayCastsMutex);
+        mQueuedRayCasts.insert(mQueuedRayCasts.end(), rayCasts.begin(), rayCasts.end());
+        mQueuedRayCastBatches.push_back(RayCastBatch{ rayCasts.size(), std::move(callback) });
+    }
+
     void PhysicsTaskScheduler::rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld,
         btCollisionWorld::RayResultCallback& resultCallback) const
     {
@@ -678,36 +700,73 @@ namespace MWPhysics
     bool PhysicsTaskScheduler::getLineOfSight(
         const std::shared_ptr<Actor>& actor1, const std::shared_ptr<Actor>& actor2)
     {
-        MaybeExclusiveLock lock(mLOSCacheMutex, mLockingPolicy);
+        if (const std::optional<bool> result = mLOSCache.find(actor1.get(), actor2.get()))
+            return *result;
+        const bool result = hasLineOfSight(actor1.get(), actor2.get());
+        mLOSCache.insert(actor1, actor2, result);
+        return result;
+    }
+
+    void PhysicsTaskScheduler::refreshLOSCache()
+    {
+        std::size_t shard = 0;
+        while ((shard = mNextLOS.fetch_add(1, std::memory_order_relaxed)) < mLOSCache.getShardsCount())
+            mLOSCache.refresh(shard, mLOSCacheExpiry,
+                [this](const Actor& actor1, const Actor& actor2) { return hasLineOfSight(&actor1, &actor2); });
+    }
+
+    PhysicsTaskScheduler::RayCastHit PhysicsTaskScheduler::castRay(const RayCast& rayCast) const
+    {
+        RayCastHit hit;
+        if (rayCast.mRadius > 0)
+        {
+            btCollisionWorld::ClosestConvexResultCallback callback(rayCast.mFrom, rayCast.mTo);
+            callback.m_collisionFilterGroup = rayCast.mGroup;
+            callback.m_collisionFilterMask = rayCast.mMask;
 
-        auto req = LOSRequest(actor1, actor2);
-        auto result = std::find(mLOSCache.begin(), mLOSCache.end(), req);
-        if (result == mLOSCache.end())
+            const btSphereShape shape(rayCast.mRadius);
+            const btTransform from(btQuaternion::getIdentity(), rayCast.mFrom);
+            const btTransform to(btQuaternion::getIdentity(), rayCast.mTo);
+            convexSweepTest(&shape, from, to, callback);
+
+            if (callback.hasHit())
+                hit = RayCastHit{ true, callback.m_hitPointWorld, callback.m_hitNormalWorld,
+                    callback.m_hitCollisionObject };
+        }
+        else if (rayCast.mFrom != rayCast.mTo)
         {
-            req.mResult = hasLineOfSight(actor1.get(), actor2.get());
-            mLOSCache.push_back(req);
-            return req.mResult;
+            ClosestNotMeRayResultCallback callback(rayCast.mIgnore, {}, rayCast.mFrom, rayCast.mTo);
+            callback.m_collisionFilterGroup = rayCast.mGroup;
+            callback.m_collisionFilterMask = rayCast.mMask;
+
+            rayTest(rayCast.mFrom, rayCast.mTo, callback);
+
+            if (callback.hasHit())
+                hit = RayCastHit{ true, callback.m_hitPointWorld, callback.m_hitNormalWorld,
+                    callback.m_collisionObject };
         }
-        result->mAge = 0;
-        return result->mResult;
+        return hit;
     }
 
-    void PhysicsTaskScheduler::refreshLOSCache()
+    void PhysicsTaskScheduler::castRays()
     {
-        MaybeSharedLock lock(mLOSCacheMutex, mLockingPolicy);
-        int job = 0;
-        int numLOS = mLOSCache.size();
-        while ((job = mNextLOS.fetch_add(1, std::memory_order_relaxed)) < numLOS)
-        {
-            auto& req = mLOSCache[job];
-            auto actorPtr1 = req.mActors[0].lock();
-            auto actorPtr2 = req.mActors[1].lock();
+        std::size_t rayCast = 0;
+        while ((rayCast = mNextRayCast.fetch_add(1, std::memory_order_relaxed)) < mRayCasts.size())
+            mRayCastHits[rayCast] = castRay(mRayCasts[rayCast]);
+    }
 
-            if (req.mAge++ > mLOSCacheExpiry || !actorPtr1 || !actorPtr2)
-                req.mStale = true;
-            else
-                req.mResult = hasLineOfSight(actorPtr1.get(), actorPtr2.get());
+    void PhysicsTaskScheduler::finishRayCasts()
+    {
+        // This function run in the main thread after the workers are done with the casts.
+        std::span<const RayCastHit> hits = mRayCastHits;
+        for (const RayCastBatch& batch : mRayCastBatches)
+        {
+            batch.mCallback(hits.first(batch.mSize));
+            hits = hits.subspan(batch.mSize);
         }
+        mRayCasts.clear();
+        mRayCastHits.clear();
+        mRayCastBatches.clear();
     }
 
     void PhysicsTaskScheduler::updateAabbs()
@@ -789,6 +848,7 @@ namespace MWPhysics
             mPostStepBarrier->wait([this] { afterPostStep(); });
         }
 
+        castRays();
         refreshLOSCache();
         mPostSimBarrier->wait([this] { afterPostSim(); });
     }
@@ -825,13 +885,18 @@ namespace MWPhysics
     void PhysicsTaskScheduler::releaseSharedStates()
     {
         waitForWorkers();
-        std::scoped_lock lock(mSimulationMutex, mUpdateAabbMutex);
+        std::scoped_lock lock(mSimulationMutex, mUpdateAabbMutex, mQueuedRayCastsMutex);
         if (mSimulations != nullptr)
         {
             mSimulations->clear();
             mSimulations = nullptr;
         }
         mUpdateAabb.clear();
+        mQueuedRayCasts.clear();
+        mQueuedRayCastBatches.clear();
+        mRayCasts.clear();
+        mRayCastHits.clear();
+        mRayCastBatches.clear();
     }
 
     void PhysicsTaskScheduler::afterPreStep()
@@ -858,12 +923,7 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::afterPostSim()
     {
-        {
-            MaybeExclusiveLock lock(mLOSCacheMutex, mLockingPolicy);
-            mLOSCache.erase(
-                std::remove_if(mLOSCache.begin(), mLOSCache.end(), [](const LOSRequest& req) { return req.mStale; }),
-                mLOSCache.end());
-        }
+        mLOSCache.advance();
         mTimeEnd = mTimer->tick();
         if (mWorkersSync != nullptr)
             mWorkersSync->workIsDone();
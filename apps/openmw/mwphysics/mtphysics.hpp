@@ -3,8 +3,11 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
+#include <span>
 #include <thread>
 #include <unordered_set>
 
@@ -13,6 +16,7 @@
 #include <osg/Timer>
 
 #include "components/misc/budgetmeasurement.hpp"
+#include "loscache.hpp"
 #include "physicssystem.hpp"
 #include "ptrholder.hpp"
 
@@ -38,6 +42,28 @@ namespace MWPhysics
     class PhysicsTaskScheduler
     {
     public:
+        struct RayCast
+        {
+            btVector3 mFrom;
+            btVector3 mTo;
+            /// Sweep a sphere of this radius instead of casting a ray if positive
+            btScalar mRadius;
+            /// Ignored by rays only
+            const btCollisionObject* mIgnore;
+            int mGroup;
+            int mMask;
+        };
+
+        struct RayCastHit
+        {
+            bool mHit = false;
+            btVector3 mPoint;
+            btVector3 mNormal;
+            const btCollisionObject* mObject = nullptr;
+        };
+
+        using RayCastsCallback = std::function<void(std::span<const RayCastHit>)>;
+
         PhysicsTaskScheduler(float physicsDt, btCollisionWorld* collisionWorld, MWRender::DebugDrawer* debugDrawer);
         ~PhysicsTaskScheduler();
 
@@ -51,6 +77,12 @@ namespace MWPhysics
 
         void resetSimulation(const ActorMap& actors);
 
+        /// @brief queue casts to run on the worker threads along with the next simulation
+        /// @param callback is called from applyQueuedMovements with hits in the order of rayCasts once they are done:
+        /// by the next call without worker threads and by the one after it otherwise
+        /// @note can be called while the workers are running
+        void queueRayCasts(std::vector<RayCast> rayCasts, RayCastsCallback callback);
+
         // Thread safe wrappers
         void rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld,
             btCollisionWorld::RayResultCallback& resultCallback) const;
@@ -73,11 +105,20 @@ namespace MWPhysics
     private:
         class WorkersSync;
 
+        struct RayCastBatch
+        {
+            std::size_t mSize;
+            RayCastsCallback mCallback;
+        };
+
         void doSimulation();
         void worker();
         void updateActorsPositions();
         bool hasLineOfSight(const Actor* actor1, const Actor* actor2);
         void refreshLOSCache();
+        RayCastHit castRay(const RayCast& rayCast) const;
+        void castRays();
+        void finishRayCasts();
         void updateAabbs();
         void updatePtrAabb(const std::shared_ptr<PtrHolder>& ptr);
         void updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats);
@@ -98,8 +139,13 @@ namespace MWPhysics
         float mTimeAccum;
         btCollisionWorld* mCollisionWorld;
         MWRender::DebugDrawer* mDebugDrawer;
-        std::vector<LOSRequest> mLOSCache;
+        LOSCache<Actor> mLOSCache;
         std::set<std::weak_ptr<PtrHolder>, std::owner_less<std::weak_ptr<PtrHolder>>> mUpdateAabb;
+        std::vector<RayCast> mQueuedRayCasts;
+        std::vector<RayCastBatch> mQueuedRayCastBatches;
+        std::vector<RayCast> mRayCasts;
+        std::vector<RayCastHit> mRayCastHits;
+        std::vector<RayCastBatch> mRayCastBatches;
 
         // TODO: use std::experimental::flex_barrier or std::barrier once it becomes a thing
         std::unique_ptr<Misc::Barrier> mPreStepBarrier;
@@ -113,13 +159,14 @@ namespace MWPhysics
         int mLOSCacheExpiry;
         bool mAdvanceSimulation;
         std::atomic<int> mNextJob;
-        std::atomic<int> mNextLOS;
+        std::atomic<std::size_t> mNextLOS;
+        std::atomic<std::size_t> mNextRayCast;
         std::vector<std::thread> mThreads;
 
         mutable std::shared_mutex mSimulationMutex;
         mutable std::shared_mutex mCollisionWorldMutex;
-        mutable std::shared_mutex mLOSCacheMutex;
         mutable std::mutex mUpdateAabbMutex;
+        std::mutex mQueuedRayCastsMutex;
 
         unsigned int mFrameNumber;
         const osg::Timer* mTimer;
@@ -88,7 +88,6 @@ namespace
         }
         ptr.getClass().getMovementSettings(ptr).mPosition[2] = 0;
     }
-
 }
 
 namespace MWPhysics
@@ -292,22 +291,9 @@ namespace MWPhysics
         btVector3 btFrom = Misc::Convert::toBullet(from);
         btVector3 btTo = Misc::Convert::toBullet(to);
 
-        const btCollisionObject* me = nullptr;
+        const btCollisionObject* me = getCollisionObject(ignore);
         std::vector<const btCollisionObject*> targetCollisionObjects;
 
-        if (!ignore.isEmpty())
-        {
-            const Actor* actor = getActor(ignore);
-            if (actor)
-                me = actor->getCollisionObject();
-            else
-            {
-                const Object* object = getObject(ignore);
-                if (object)
-                    me = object->getCollisionObject();
-            }
-        }
-
         if (!targets.empty())
         {
             for (const MWWorld::Ptr& target : targets)
@@ -336,6 +322,36 @@ namespace MWPhysics
         return result;
     }
 
+    void PhysicsSystem::asyncCastRays(std::vector<RayCastingRequest> requests,
+        std::function<void(std::vector<RayCastingResult>)> callback) const
+    {
+        std::vector<PhysicsTaskScheduler::RayCast> rayCasts;
+        rayCasts.reserve(requests.size());
+        for (const RayCastingRequest& request : requests)
+            rayCasts.push_back(PhysicsTaskScheduler::RayCast{ Misc::Convert::toBullet(request.mFrom),
+                Misc::Convert::toBullet(request.mTo), request.mRadius, getCollisionObject(request.mIgnore),
+                request.mGroup, request.mMask });
+
+        mTaskScheduler->queueRayCasts(std::move(rayCasts),
+            [this, callback = std::move(callback)](std::span<const PhysicsTaskScheduler::RayCastHit> hits) {
+                std::vector<RayCastingResult> results;
+                results.reserve(hits.size());
+                for (const PhysicsTaskScheduler::RayCastHit& hit : hits)
+                {
+                    RayCastingResult& result = results.emplace_back();
+                    result.mHit = hit.mHit;
+                    if (!hit.mHit)
+                        continue;
+                    result.mHitPos = Misc::Convert::toOsg(hit.mPoint);
+                    result.mHitNormal = Misc::Convert::toOsg(hit.mNormal);
+                    // The object may have been removed since the cast
+                    if (auto* ptrHolder = static_cast<PtrHolder*>(mTaskScheduler->getUserPointer(hit.mObject)))
+                        result.mHitObject = ptrHolder->getPtr();
+                }
+                callback(std::move(results));
+            });
+    }
+
     RayCastingResult PhysicsSystem::castSphere(
         const osg::Vec3f& from, const osg::Vec3f& to, float radius, int mask, int group) const
     {
@@ -780,6 +796,17 @@ namespace MWPhysics
         }
     }
 
+    const btCollisionObject* PhysicsSystem::getCollisionObject(const MWWorld::ConstPtr& ptr) const
+    {
+        if (ptr.isEmpty())
+            return nullptr;
+        if (const Actor* actor = getActor(ptr))
+            return actor->getCollisionObject();
+        if (const Object* object = getObject(ptr))
+            return object->getCollisionObject();
+        return nullptr;
+    }
+
     void PhysicsSystem::stepSimulation(
         float dt, bool skipSimulation, osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats)
     {
@@ -1023,32 +1050,4 @@ namespace MWPhysics
         , mStormDirection(MWBase::Environment::get().getWorld()->getStormDirection())
     {
     }
-
-    LOSRequest::LOSRequest(const std::weak_ptr<Actor>& a1, const std::weak_ptr<Actor>& a2)
-        : mResult(false)
-        , mStale(false)
-        , mAge(0)
-    {
-        // we use raw actor pointer pair to uniquely identify request
-        // sort the pointer value in ascending order to not duplicate equivalent requests, eg. getLOS(A, B) and
-        // getLOS(B, A)
-        auto* raw1 = a1.lock().get();
-        auto* raw2 = a2.lock().get();
-        assert(raw1 != raw2);
-        if (raw1 < raw2)
-        {
-            mActors = { a1, a2 };
-            mRawActors = { raw1, raw2 };
-        }
-        else
-        {
-            mActors = { a2, a1 };
-            mRawActors = { raw2, raw1 };
-        }
-    }
-
-    bool operator==(const LOSRequest& lhs, const LOSRequest& rhs) noexcept
-    {
-        return lhs.mRawActors == rhs.mRawActors;
-    }
 }
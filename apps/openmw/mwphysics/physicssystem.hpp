@@ -67,17 +67,6 @@ namespace MWPhysics
         osg::Vec3f mNormal;
     };
 
-    struct LOSRequest
-    {
-        LOSRequest(const std::weak_ptr<Actor>& a1, const std::weak_ptr<Actor>& a2);
-        std::array<std::weak_ptr<Actor>, 2> mActors;
-        std::array<const Actor*, 2> mRawActors;
-        bool mResult;
-        bool mStale;
-        int mAge;
-    };
-    bool operator==(const LOSRequest& lhs, const LOSRequest& rhs) noexcept;
-
     struct ActorFrameData
     {
         ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel);
@@ -228,6 +217,9 @@ namespace MWPhysics
         RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius,
             int mask = CollisionType_Default, int group = 0xff) const override;
 
+        void asyncCastRays(std::vector<RayCastingRequest> requests,
+            std::function<void(std::vector<RayCastingResult>)> callback) const override;
+
         /// Return true if actor1 can see actor2.
         bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const override;
 
@@ -300,6 +292,8 @@ namespace MWPhysics
     private:
         void updateWater();
 
+        const btCollisionObject* getCollisionObject(const MWWorld::ConstPtr& ptr) const;
+
         void prepareSimulation(bool willSimulate, std::vector<Simulation>& simulations);
 
         std::unique_ptr<btBroadphaseInterface> mBroadphase;
@@ -1,6 +1,9 @@
 #ifndef OPENMW_MWPHYSICS_RAYCASTING_H
 #define OPENMW_MWPHYSICS_RAYCASTING_H
 
+#include <functional>
+#include <vector>
+
 #include <osg/Vec3f>
 
 #include "../mwworld/ptr.hpp"
@@ -18,6 +21,18 @@ namespace MWPhysics
         MWWorld::Ptr mHitObject;
     };
 
+    struct RayCastingRequest
+    {
+        osg::Vec3f mFrom;
+        osg::Vec3f mTo;
+        /// Cast a sphere of this radius instead of a ray if positive.
+        float mRadius = 0;
+        /// Optional, a Ptr to ignore in the results. Not supported for spheres.
+        MWWorld::ConstPtr mIgnore;
+        int mMask = CollisionType_Default;
+        int mGroup = 0xff;
+    };
+
     class RayCastingInterface
     {
     public:
@@ -44,6 +59,12 @@ namespace MWPhysics
         virtual RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius,
             int mask = CollisionType_Default, int group = 0xff) const = 0;
 
+        /// Cast the rays and spheres on the physics threads along with the next simulation. \a callback is called from
+        /// the main thread with the results in the order of \a requests once the physics results are applied, usually
+        /// during the next frame.
+        virtual void asyncCastRays(std::vector<RayCastingRequest> requests,
+            std::function<void(std::vector<RayCastingResult>)> callback) const = 0;
+
         /// Return true if actor1 can see actor2.
         virtual bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const = 0;
     };
@@ -0,0 +1,137 @@
+#include "cellrefcache.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+#include <osg/Stats>
+
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+
+#include "apps/openmw/mwworld/esmstore.hpp"
+
+namespace MWRender
+{
+    CellRefCache::CellRefCache(std::size_t maxSize)
+        : mMaxSize(maxSize)
+    {
+    }
+
+    std::shared_ptr<const CachedCellRefs> CellRefCache::get(
+        const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers)
+    {
+        const CellIndex index(cell.getGridX(), cell.getGridY());
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ++mGetCount;
+            const auto it = mIndex.find(index);
+            if (it != mIndex.end())
+            {
+                ++mHitCount;
+                mEntries.splice(mEntries.begin(), mEntries, it->second);
+                return it->second->mRefs;
+            }
+        }
+
+        // Read without holding the lock so other workers are not blocked by the file access. If two workers miss
+        // the same cell at once both read it and the first result is kept.
+        auto refs = std::make_shared<const CachedCellRefs>(read(cell, store, readers));
+
+        if (mMaxSize == 0)
+            return refs;
+
+        const std::size_t size = getSize(*refs);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        const auto it = mIndex.find(index);
+        if (it != mIndex.end())
+            return it->second->mRefs;
+        mEntries.push_front(Entry{ index, refs, size });
+        mIndex.emplace(index, mEntries.begin());
+        mSize += size;
+        // A single cell larger than the limit is not kept either
+        while (mSize > mMaxSize)
+        {
+            mSize -= mEntries.back().mSize;
+            mIndex.erase(mEntries.back().mCellIndex);
+            mEntries.pop_back();
+        }
+        return refs;
+    }
+
+    void CellRefCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIndex.clear();
+        mEntries.clear();
+        mSize = 0;
+    }
+
+    void CellRefCache::reportStats(unsigned int frameNumber, osg::Stats* stats) const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        stats->setAttribute(frameNumber, "Object Paging Cells", static_cast<double>(mEntries.size()));
+        stats->setAttribute(frameNumber, "Object Paging Cells Get", static_cast<double>(mGetCount));
+        stats->setAttribute(frameNumber, "Object Paging Cells Hit", static_cast<double>(mHitCount));
+    }
+
+    std::size_t CellRefCache::getSize(const CachedCellRefs& refs)
+    {
+        // Ref ids are interned, so only strings longer than the small string buffer add memory on top of the array
+        const auto getStringSize = [](const std::string& value) {
+            return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+        };
+        // List node, index node and control block of the shared pointer
+        constexpr std::size_t entryOverhead = 128;
+        std::size_t result = entryOverhead + refs.capacity() * sizeof(CachedCellRef);
+        for (const CachedCellRef& ref : refs)
+            result += getStringSize(ref.mRef.mGlobalVariable) + getStringSize(ref.mRef.mDestCell);
+        return result;
+    }
+
+    CachedCellRefs CellRefCache::read(
+        const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers)
+    {
+        std::map<ESM::RefNum, CachedCellRef> refs;
+        for (std::size_t i = 0; i < cell.mContextList.size(); ++i)
+        {
+            try
+            {
+                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                const ESM::ReadersCache::BusyItem reader = readers.get(index);
+                cell.restore(*reader, i);
+                ESM::CellRef ref;
+                ESM::MovedCellRef cMRef;
+                bool deleted = false;
+                bool moved = false;
+                while (ESM::Cell::getNextRef(
+                    *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
+                {
+                    if (moved)
+                        continue;
+
+                    if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum)
+                        != cell.mMovedRefs.end())
+                        continue;
+
+                    const int type = store.findStatic(ref.mRefID);
+                    const ESM::RefNum refNum = ref.mRefNum;
+                    refs.insert_or_assign(refNum, CachedCellRef{ std::move(ref), type, deleted });
+                }
+            }
+            catch (const std::exception&)
+            {
+                continue;
+            }
+        }
+
+        CachedCellRefs result;
+        result.reserve(refs.size());
+        for (auto& [refNum, ref] : refs)
+            result.push_back(std::move(ref));
+        return result;
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef OPENMW_MWRENDER_CELLREFCACHE_H
+#define OPENMW_MWRENDER_CELLREFCACHE_H
+
+#include <components/esm3/cellref.hpp>
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace osg
+{
+    class Stats;
+}
+
+namespace ESM
+{
+    struct Cell;
+    class ReadersCache;
+}
+
+namespace MWWorld
+{
+    class ESMStore;
+}
+
+namespace MWRender
+{
+    struct CachedCellRef
+    {
+        ESM::CellRef mRef;
+        int mType;
+        bool mDeleted;
+    };
+
+    /// References of a single exterior cell as stored in the content files, ordered by RefNum.
+    /// Each RefNum appears only once with the last state found in the load order.
+    using CachedCellRefs = std::vector<CachedCellRef>;
+
+    /// @brief Thread-safe LRU cache of decoded exterior cell references shared by object paging workers, bounded by
+    /// the estimated memory used by the references.
+    /// @note Content files are not modified while the game is running, so cached references never become stale.
+    /// Dynamic state (leased and disabled references) must be applied by the caller on top of the cached list.
+    class CellRefCache
+    {
+    public:
+        /// @param maxSize Maximum estimated size of the cached references in bytes, 0 disables caching
+        explicit CellRefCache(std::size_t maxSize);
+
+        /// Return references of the given exterior cell, reading them from the content files if they are not cached
+        std::shared_ptr<const CachedCellRefs> get(
+            const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers);
+
+        void clear();
+
+        void reportStats(unsigned int frameNumber, osg::Stats* stats) const;
+
+    private:
+        using CellIndex = std::pair<int, int>;
+
+        struct Entry
+        {
+            CellIndex mCellIndex;
+            std::shared_ptr<const CachedCellRefs> mRefs;
+            std::size_t mSize;
+        };
+
+        const std::size_t mMaxSize;
+        mutable std::mutex mMutex;
+        std::size_t mSize = 0;
+        std::list<Entry> mEntries; // Most recently used first
+        std::map<CellIndex, std::list<Entry>::iterator> mIndex;
+        std::size_t mGetCount = 0;
+        std::size_t mHitCount = 0;
+
+        static std::size_t getSize(const CachedCellRefs& refs);
+
+        static CachedCellRefs read(const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers);
+    };
+}
+
+#endif
@@ -311,7 +311,7 @@ namespace MWRender
 
         mWorkItem
             = new CreateMapWorkItem(mWidth, mHeight, mMinX, mMinY, mMaxX, mMaxY, mCellSize, esmStore.get<ESM::Land>());
-        mWorkQueue->addWorkItem(mWorkItem);
+        mWorkQueue->addWorkItem(mWorkItem, SceneUtil::WorkCategory::GlobalMap, SceneUtil::WorkPriority::Low);
     }
 
     void GlobalMap::worldPosToImageSpace(float x, float z, float& imageX, float& imageY)
@@ -651,6 +651,6 @@ namespace MWRender
             return;
         // Use deep copy to avoid any sychronization
         mWritePng = new WritePng(new osg::Image(*mOverlayImage, osg::CopyOp::DEEP_COPY_ALL));
-        mWorkQueue->addWorkItem(mWritePng, /*front=*/true);
+        mWorkQueue->addWorkItem(mWritePng, SceneUtil::WorkCategory::GlobalMap, SceneUtil::WorkPriority::High);
     }
 }
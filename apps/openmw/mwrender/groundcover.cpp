@@ -7,7 +7,6 @@
 #include <osg/Program>
 #include <osg/VertexAttribDivisor>
 
-#include <components/esm3/esmreader.hpp>
 #include <components/esm3/loadland.hpp>
 #include <components/esm3/readerscache.hpp>
 #include <components/sceneutil/lightmanager.hpp>
@@ -121,13 +120,13 @@ namespace MWRender
         osg::BoundingBox mBox;
     };
 
-    inline bool isInChunkBorders(ESM::CellRef& ref, osg::Vec2f& minBound, osg::Vec2f& maxBound)
+    inline bool isInChunkBorders(const ESM::Position& position, const osg::Vec2f& minBound, const osg::Vec2f& maxBound)
     {
         osg::Vec2f size = maxBound - minBound;
         if (size.x() >= 1 && size.y() >= 1)
             return true;
 
-        osg::Vec3f pos = ref.mPos.asVec3();
+        osg::Vec3f pos = position.asVec3();
         osg::Vec3f cellPos = pos / ESM::Land::REAL_SIZE;
         if ((minBound.x() > std::floor(minBound.x()) && cellPos.x() < minBound.x())
             || (minBound.y() > std::floor(minBound.y()) && cellPos.y() < minBound.y())
@@ -193,47 +192,25 @@ namespace MWRender
         osg::Vec2f maxBound = (center + osg::Vec2f(size / 2.f, size / 2.f));
         DensityCalculator calculator(mDensity);
         ESM::ReadersCache readers;
+        std::vector<MWWorld::GroundcoverInstance> cellInstances;
         osg::Vec2i startCell = osg::Vec2i(std::floor(center.x() - size / 2.f), std::floor(center.y() - size / 2.f));
         for (int cellX = startCell.x(); cellX < startCell.x() + size; ++cellX)
         {
             for (int cellY = startCell.y(); cellY < startCell.y() + size; ++cellY)
             {
-                ESM::Cell cell;
-                mGroundcoverStore.initCell(cell, cellX, cellY);
-                if (cell.mContextList.empty())
-                    continue;
+                cellInstances.clear();
+                mGroundcoverStore.getInstances(cellX, cellY, readers, cellInstances);
 
                 calculator.reset();
-                std::map<ESM::RefNum, ESM::CellRef> refs;
-                for (size_t i = 0; i < cell.mContextList.size(); ++i)
+                for (const MWWorld::GroundcoverInstance& instance : cellInstances)
                 {
-                    const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-                    const ESM::ReadersCache::BusyItem reader = readers.get(index);
-                    cell.restore(*reader, i);
-                    ESM::CellRef ref;
-                    bool deleted = false;
-                    while (cell.getNextRef(*reader, ref, deleted))
-                    {
-                        if (!deleted && refs.find(ref.mRefNum) == refs.end() && !calculator.isInstanceEnabled())
-                            deleted = true;
-                        if (!deleted && !isInChunkBorders(ref, minBound, maxBound))
-                            deleted = true;
-
-                        if (deleted)
-                        {
-                            refs.erase(ref.mRefNum);
-                            continue;
-                        }
-                        refs[ref.mRefNum] = std::move(ref);
-                    }
-                }
-
-                for (auto& pair : refs)
-                {
-                    ESM::CellRef& ref = pair.second;
-                    const std::string& model = mGroundcoverStore.getGroundcoverModel(ref.mRefID);
-                    if (!model.empty())
-                        instances[model].emplace_back(std::move(ref));
+                    if (!calculator.isInstanceEnabled() || !isInChunkBorders(instance.mPos, minBound, maxBound)
+                        || instance.mModel.empty())
+                        continue;
+                    auto it = instances.find(instance.mModel);
+                    if (it == instances.end())
+                        it = instances.emplace(std::string(instance.mModel), std::vector<GroundcoverEntry>()).first;
+                    it->second.push_back(GroundcoverEntry{ instance.mPos, instance.mScale });
                 }
             }
         }
@@ -280,6 +257,6 @@ namespace MWRender
 
     void Groundcover::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Groundcover Chunk", mCache->getCacheSize());
+        Resource::reportStats("Groundcover Chunk", frameNumber, mCache->getStats(), *stats);
     }
 }
@@ -37,12 +37,6 @@ namespace MWRender
         {
             ESM::Position mPos;
             float mScale;
-
-            GroundcoverEntry(const ESM::CellRef& ref)
-                : mPos(ref.mPos)
-                , mScale(ref.mScale)
-            {
-            }
         };
 
     private:
@@ -52,7 +46,7 @@ namespace MWRender
         osg::ref_ptr<osg::Program> mProgramTemplate;
         const MWWorld::GroundcoverStore& mGroundcoverStore;
 
-        typedef std::map<std::string, std::vector<GroundcoverEntry>> InstanceMap;
+        typedef std::map<std::string, std::vector<GroundcoverEntry>, std::less<>> InstanceMap;
         osg::ref_ptr<osg::Node> createChunk(InstanceMap& instances, const osg::Vec2f& center);
         void collectInstances(InstanceMap& instances, float size, const osg::Vec2f& center);
     };
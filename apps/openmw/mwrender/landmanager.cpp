@@ -52,7 +52,7 @@ namespace MWRender
 
     void LandManager::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Land", mCache->getCacheSize());
+        Resource::reportStats("Land", frameNumber, mCache->getStats(), *stats);
     }
 
 }
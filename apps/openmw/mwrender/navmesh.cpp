@@ -179,7 +179,7 @@ namespace MWRender
         if (mEnabled)
             disable();
         for (const auto& workItem : mWorkItems)
-            workItem->abort();
+            workItem->cancel();
     }
 
     bool NavMesh::toggle()
@@ -218,7 +218,8 @@ namespace MWRender
                     std::swap(latestCandidate, *it);
                 }
                 if (*it != nullptr)
-                    mWorkQueue->addWorkItem(new DeallocateCreateNavMeshTileGroups(std::move(*it)));
+                    mWorkQueue->addWorkItem(new DeallocateCreateNavMeshTileGroups(std::move(*it)),
+                        SceneUtil::WorkCategory::NavMesh, SceneUtil::WorkPriority::Low);
                 it = mWorkItems.erase(it);
             }
 
@@ -248,11 +249,12 @@ namespace MWRender
                     }
                 }
 
-                mWorkQueue->addWorkItem(new DeallocateCreateNavMeshTileGroups(std::move(latestCandidate)));
+                mWorkQueue->addWorkItem(new DeallocateCreateNavMeshTileGroups(std::move(latestCandidate)),
+                    SceneUtil::WorkCategory::NavMesh, SceneUtil::WorkPriority::Low);
             }
         }
 
-        const auto version = navMesh->lock()->getVersion();
+        const auto version = navMesh->lockConst()->getVersion();
 
         if (!mTiles.empty() && mId == id && mVersion == version)
             return;
@@ -285,14 +287,14 @@ namespace MWRender
 
         osg::ref_ptr<CreateNavMeshTileGroups> workItem = new CreateNavMeshTileGroups(
             id, version, navMesh, mGroupStateSet, mDebugDrawStateSet, settings, mTiles, mMode);
-        mWorkQueue->addWorkItem(workItem);
+        mWorkQueue->addWorkItem(workItem, SceneUtil::WorkCategory::NavMesh, SceneUtil::WorkPriority::Low);
         mWorkItems.push_back(std::move(workItem));
     }
 
     void NavMesh::reset()
     {
         for (auto& workItem : mWorkItems)
-            workItem->abort();
+            workItem->cancel();
         mWorkItems.clear();
         for (auto& [position, tile] : mTiles)
             mRootNode->removeChild(tile.mGroup);
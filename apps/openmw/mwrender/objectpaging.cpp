@@ -34,6 +34,7 @@
 #include <components/sceneutil/riggeometry.hpp>
 #include <components/sceneutil/riggeometryosgaextension.hpp>
 #include <components/settings/settings.hpp>
+#include <components/settings/values.hpp>
 
 #include "apps/openmw/mwbase/environment.hpp"
 #include "apps/openmw/mwbase/world.hpp"
@@ -457,6 +458,7 @@ namespace MWRender
         : GenericResourceManager<ChunkId>(nullptr)
         , mSceneManager(sceneManager)
         , mRefTrackerLocked(false)
+        , mCellRefCache(static_cast<std::size_t>(Settings::terrain().mObjectPagingReferenceCacheSize) * 1024 * 1024)
     {
         mActiveGrid = Settings::Manager::getBool("object paging active grid", "Terrain");
         mDebugBatches = Settings::Manager::getBool("debug chunks", "Terrain");
@@ -486,42 +488,17 @@ namespace MWRender
                 const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
                 if (!cell)
                     continue;
-                for (size_t i = 0; i < cell->mContextList.size(); ++i)
+                const std::shared_ptr<const CachedCellRefs> cellRefs = mCellRefCache.get(*cell, store, readers);
+                for (const CachedCellRef& cached : *cellRefs)
                 {
-                    try
-                    {
-                        const std::size_t index = static_cast<std::size_t>(cell->mContextList[i].index);
-                        const ESM::ReadersCache::BusyItem reader = readers.get(index);
-                        cell->restore(*reader, i);
-                        ESM::CellRef ref;
-                        ESM::MovedCellRef cMRef;
-                        bool deleted = false;
-                        bool moved = false;
-                        while (ESM::Cell::getNextRef(
-                            *reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                        {
-                            if (moved)
-                                continue;
-
-                            if (std::find(cell->mMovedRefs.begin(), cell->mMovedRefs.end(), ref.mRefNum)
-                                != cell->mMovedRefs.end())
-                                continue;
-
-                            int type = store.findStatic(ref.mRefID);
-                            if (!typeFilter(type, size >= 2))
-                                continue;
-                            if (deleted)
-                            {
-                                refs.erase(ref.mRefNum);
-                                continue;
-                            }
-                            refs[ref.mRefNum] = std::move(ref);
-                        }
-                    }
-                    catch (std::exception&)
+                    if (!typeFilter(cached.mType, size >= 2))
+                        continue;
+                    if (cached.mDeleted)
                     {
+                        refs.erase(cached.mRef.mRefNum);
                         continue;
                     }
+                    refs[cached.mRef.mRefNum] = cached.mRef;
                 }
                 for (auto [ref, deleted] : cell->mLeasedRefs)
                 {
@@ -993,7 +970,8 @@ namespace MWRender
 
     void ObjectPaging::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Object Chunk", mCache->getCacheSize());
+        Resource::reportStats("Object Chunk", frameNumber, mCache->getStats(), *stats);
+        mCellRefCache.reportStats(frameNumber, stats);
     }
 
 }
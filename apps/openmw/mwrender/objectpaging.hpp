@@ -7,6 +7,8 @@
 
 #include <mutex>
 
+#include "cellrefcache.hpp"
+
 namespace Resource
 {
     class SceneManager;
@@ -86,6 +88,8 @@ namespace MWRender
         typedef std::pair<std::string, unsigned char> LODNameCacheKey; // Key: mesh name, lod level
         typedef std::map<LODNameCacheKey, std::string> LODNameCache; // Cache: key, mesh name to use
         LODNameCache mLODNameCache;
+
+        CellRefCache mCellRefCache;
     };
 
     class RefnumMarker : public osg::Object
@@ -50,6 +50,7 @@
 #include <components/terrain/terraingrid.hpp>
 
 #include <components/esm3/loadcell.hpp>
+#include <components/esm3terrain/chunkcache.hpp>
 #include <components/esm4/loadcell.hpp>
 
 #include <components/debug/debugdraw.hpp>
@@ -305,7 +306,7 @@ namespace MWRender
     RenderingManager::RenderingManager(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode,
         Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
         DetourNavigator::Navigator& navigator, const MWWorld::GroundcoverStore& groundcoverStore,
-        SceneUtil::UnrefQueue& unrefQueue)
+        SceneUtil::UnrefQueue& unrefQueue, const std::filesystem::path& userDataPath)
         : mSkyBlending(Settings::fog().mSkyBlending)
         , mViewer(viewer)
         , mRootNode(rootNode)
@@ -459,6 +460,13 @@ namespace MWRender
         mTerrainStorage = std::make_unique<TerrainStorage>(mResourceSystem, normalMapPattern, heightMapPattern,
             useTerrainNormalMaps, specularMapPattern, useTerrainSpecularMaps);
 
+        if (const int chunkCacheSize = Settings::terrain().mChunkCacheSize; chunkCacheSize > 0)
+        {
+            mTerrainChunkCache = std::make_unique<ESMTerrain::ChunkCache>(
+                userDataPath / "terrain.bin", static_cast<std::size_t>(chunkCacheSize) * 1024 * 1024);
+            mTerrainStorage->setChunkCache(mTerrainChunkCache.get());
+        }
+
         WorldspaceChunkMgr& chunkMgr = getWorldspaceChunkMgr(ESM::Cell::sDefaultWorldspaceId);
         mTerrain = chunkMgr.mTerrain.get();
         mGroundcover = chunkMgr.mGroundcover.get();
@@ -575,6 +583,18 @@ namespace MWRender
     {
         // let background loading thread finish before we delete anything else
         mWorkQueue = nullptr;
+
+        if (mTerrainChunkCache != nullptr)
+        {
+            try
+            {
+                mTerrainChunkCache->save();
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "Failed to save terrain chunk cache: " << e.what();
+            }
+        }
     }
 
     osgUtil::IncrementalCompileOperation* RenderingManager::getIncrementalCompileOperation()
@@ -620,7 +640,7 @@ namespace MWRender
 
         workItem->mTextures.emplace_back("textures/_land_default.dds");
 
-        mWorkQueue->addWorkItem(std::move(workItem));
+        mWorkQueue->addWorkItem(std::move(workItem), SceneUtil::WorkCategory::CellPreload);
     }
 
     double RenderingManager::getReferenceTime() const
@@ -15,6 +15,7 @@
 #include "rendermode.hpp"
 
 #include <deque>
+#include <filesystem>
 #include <memory>
 #include <unordered_map>
 
@@ -52,6 +53,11 @@ namespace Terrain
     class World;
 }
 
+namespace ESMTerrain
+{
+    class ChunkCache;
+}
+
 namespace Fallback
 {
     class Map;
@@ -112,7 +118,7 @@ namespace MWRender
         RenderingManager(osgViewer::Viewer* viewer, osg::ref_ptr<osg::Group> rootNode,
             Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
             DetourNavigator::Navigator& navigator, const MWWorld::GroundcoverStore& groundcoverStore,
-            SceneUtil::UnrefQueue& unrefQueue);
+            SceneUtil::UnrefQueue& unrefQueue, const std::filesystem::path& userDataPath);
         ~RenderingManager();
 
         osgUtil::IncrementalCompileOperation* getIncrementalCompileOperation();
@@ -324,6 +330,7 @@ namespace MWRender
         std::unique_ptr<Water> mWater;
         std::unordered_map<ESM::RefId, WorldspaceChunkMgr> mWorldspaceChunks;
         Terrain::World* mTerrain;
+        std::unique_ptr<ESMTerrain::ChunkCache> mTerrainChunkCache;
         std::unique_ptr<TerrainStorage> mTerrainStorage;
         ObjectPaging* mObjectPaging;
         Groundcover* mGroundcover;
@@ -52,6 +52,9 @@ namespace MWScript
 
     std::pair<char, bool> CompilerContext::getMemberType(const std::string& name, const ESM::RefId& id) const
     {
+        // Scripts are compiled in parallel by ScriptManager::compileAll, locals of other scripts are parsed on demand
+        const std::lock_guard lock(mMemberTypeMutex);
+
         ESM::RefId script;
         bool reference = false;
 
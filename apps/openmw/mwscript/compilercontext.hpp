@@ -3,6 +3,8 @@
 
 #include <components/compiler/context.hpp>
 
+#include <mutex>
+
 namespace ESM
 {
     class RefId;
@@ -22,6 +24,7 @@ namespace MWScript
 
     private:
         Type mType;
+        mutable std::mutex mMemberTypeMutex;
 
     public:
         CompilerContext(Type type);
@@ -0,0 +1,191 @@
+#include "scriptcache.hpp"
+
+#include <components/compiler/opcodes.hpp>
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace MWScript
+{
+    namespace
+    {
+        constexpr ESM::NAME sHeaderRecord = "CSHD";
+        constexpr ESM::NAME sScriptRecord = "CSCR";
+
+        // Increment when the cache format changes
+        constexpr std::uint32_t sVersion = 1;
+
+        constexpr char sLocalTypes[] = { 's', 'l', 'f' };
+        constexpr ESM::NAME sLocalNames[] = { "LOCS", "LOCL", "LOCF" };
+
+        std::uint64_t getHash(std::string_view text)
+        {
+            // FNV-1a
+            std::uint64_t hash = 0xcbf29ce484222325ull;
+            for (char c : text)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x00000100000001B3ull;
+            }
+            return hash;
+        }
+
+        template <class T>
+        void writeArray(ESM::ESMWriter& writer, ESM::NAME name, const std::vector<T>& values)
+        {
+            writer.startSubRecord(name);
+            writer.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+            writer.endRecord(name);
+        }
+
+        template <class T>
+        void readArray(ESM::ESMReader& reader, ESM::NAME name, std::vector<T>& values)
+        {
+            reader.getSubNameIs(name);
+            reader.getSubHeader();
+            const std::size_t size = reader.getSubSize();
+            if (size % sizeof(T) != 0)
+                throw std::runtime_error("Invalid " + name.toString() + " subrecord size");
+            values.resize(size / sizeof(T));
+            reader.getExact(values.data(), size);
+        }
+    }
+
+    ScriptCache::ScriptCache(std::filesystem::path path, MWWorld::ContentFilesFingerprint contentFiles)
+        : mPath(std::move(path))
+        , mContentFiles(std::move(contentFiles))
+    {
+    }
+
+    void ScriptCache::load()
+    {
+        if (!std::filesystem::exists(mPath))
+            return;
+
+        try
+        {
+            ESM::ESMReader reader;
+            reader.open(mPath);
+
+            if (!reader.hasMoreRecs() || reader.getRecName() != sHeaderRecord)
+                return;
+            reader.getRecHeader();
+            std::uint32_t version = 0;
+            std::int32_t codeVersion = 0;
+            reader.getHNT(version, "VERS");
+            reader.getHNT(codeVersion, "CODE");
+            if (version != sVersion || codeVersion != Compiler::codeVersion || !mContentFiles.matches(reader))
+                return;
+
+            std::unordered_map<ESM::RefId, Entry> entries;
+            while (reader.hasMoreRecs())
+            {
+                const ESM::NAME name = reader.getRecName();
+                reader.getRecHeader();
+                if (name != sScriptRecord)
+                {
+                    reader.skipRecord();
+                    continue;
+                }
+
+                ESM::RefId id = reader.getHNRefId("NAME");
+                Entry entry;
+                reader.getHNT(entry.mHash, "HASH");
+                readArray(reader, "INST", entry.mProgram.mInstructions);
+                readArray(reader, "INTV", entry.mProgram.mIntegers);
+                readArray(reader, "FLTV", entry.mProgram.mFloats);
+                while (reader.isNextSub("STRV"))
+                    entry.mProgram.mStrings.push_back(reader.getHString());
+                for (std::size_t i = 0; i < std::size(sLocalTypes); ++i)
+                    while (reader.isNextSub(sLocalNames[i]))
+                        entry.mLocals.declare(sLocalTypes[i], reader.getHString());
+                entries.emplace(std::move(id), std::move(entry));
+            }
+
+            mEntries = std::move(entries);
+            mChanged = false;
+            Log(Debug::Verbose) << "Loaded " << mEntries.size() << " compiled scripts from " << mPath;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read compiled scripts cache " << mPath << ": " << e.what();
+        }
+    }
+
+    void ScriptCache::save()
+    {
+        if (!mChanged)
+            return;
+
+        std::filesystem::path tmpPath = mPath;
+        tmpPath += ".tmp";
+
+        try
+        {
+            {
+                std::ofstream stream(tmpPath, std::ios::binary);
+                stream.exceptions(std::ios::failbit | std::ios::badbit);
+
+                ESM::ESMWriter writer;
+                writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
+                writer.save(stream);
+
+                writer.startRecord(sHeaderRecord);
+                writer.writeHNT("VERS", sVersion);
+                writer.writeHNT("CODE", static_cast<std::int32_t>(Compiler::codeVersion));
+                mContentFiles.save(writer);
+                writer.endRecord(sHeaderRecord);
+
+                for (const auto& [id, entry] : mEntries)
+                {
+                    writer.startRecord(sScriptRecord);
+                    writer.writeHNRefId("NAME", id);
+                    writer.writeHNT("HASH", entry.mHash);
+                    writeArray(writer, "INST", entry.mProgram.mInstructions);
+                    writeArray(writer, "INTV", entry.mProgram.mIntegers);
+                    writeArray(writer, "FLTV", entry.mProgram.mFloats);
+                    for (const std::string& string : entry.mProgram.mStrings)
+                        writer.writeHNString("STRV", string);
+                    for (std::size_t i = 0; i < std::size(sLocalTypes); ++i)
+                        for (const std::string& local : entry.mLocals.get(sLocalTypes[i]))
+                            writer.writeHNString(sLocalNames[i], local);
+                    writer.endRecord(sScriptRecord);
+                }
+
+                writer.close();
+            }
+
+            std::filesystem::rename(tmpPath, mPath);
+            mChanged = false;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to write compiled scripts cache " << mPath << ": " << e.what();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+        }
+    }
+
+    bool ScriptCache::get(const ESM::RefId& name, std::string_view scriptText, Interpreter::Program& program,
+        Compiler::Locals& locals) const
+    {
+        const auto it = mEntries.find(name);
+        if (it == mEntries.end() || it->second.mHash != getHash(scriptText))
+            return false;
+        program = it->second.mProgram;
+        locals = it->second.mLocals;
+        return true;
+    }
+
+    void ScriptCache::add(const ESM::RefId& name, std::string_view scriptText, const Interpreter::Program& program,
+        const Compiler::Locals& locals)
+    {
+        mEntries.insert_or_assign(name, Entry{ getHash(scriptText), program, locals });
+        mChanged = true;
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef GAME_SCRIPT_SCRIPTCACHE_H
+#define GAME_SCRIPT_SCRIPTCACHE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <unordered_map>
+
+#include <components/compiler/locals.hpp>
+#include <components/esm/refid.hpp>
+#include <components/interpreter/program.hpp>
+
+#include "../mwworld/contentfilesfingerprint.hpp"
+
+namespace MWScript
+{
+    /// \brief Compiled scripts stored on disk between game sessions
+    ///
+    /// Entries are keyed by script id and a hash of the script source. Compilation also depends on other records
+    /// (ids, global variables and locals of other scripts), so the whole cache is discarded when the content files
+    /// fingerprint or the compiler code version changes.
+    class ScriptCache
+    {
+    public:
+        ScriptCache(std::filesystem::path path, MWWorld::ContentFilesFingerprint contentFiles);
+
+        void load();
+        ///< Read cached scripts, does nothing if the cache is missing or outdated.
+
+        void save();
+        ///< Write the cache if scripts were added since it was loaded.
+
+        bool get(const ESM::RefId& name, std::string_view scriptText, Interpreter::Program& program,
+            Compiler::Locals& locals) const;
+        ///< \return Has compiled script with the same source?
+
+        void add(const ESM::RefId& name, std::string_view scriptText, const Interpreter::Program& program,
+            const Compiler::Locals& locals);
+
+    private:
+        struct Entry
+        {
+            std::uint64_t mHash;
+            Interpreter::Program mProgram;
+            Compiler::Locals mLocals;
+        };
+
+        std::filesystem::path mPath;
+        MWWorld::ContentFilesFingerprint mContentFiles;
+        std::unordered_map<ESM::RefId, Entry> mEntries;
+        bool mChanged = false;
+    };
+}
+
+#endif
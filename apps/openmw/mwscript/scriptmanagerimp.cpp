@@ -1,9 +1,11 @@
 #include "scriptmanagerimp.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <exception>
 #include <sstream>
+#include <thread>
 
 #include <components/debug/debuglog.hpp>
 
@@ -21,44 +23,29 @@
 
 #include "extensions.hpp"
 #include "interpretercontext.hpp"
+#include "scriptcache.hpp"
 
 namespace MWScript
 {
-    ScriptManager::ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
-        const std::vector<ESM::RefId>& scriptBlacklist)
-        : mErrorHandler()
-        , mStore(store)
-        , mCompilerContext(compilerContext)
-        , mParser(mErrorHandler, mCompilerContext)
-        , mOpcodesInstalled(false)
-        , mGlobalScripts(store)
-    {
-        mErrorHandler.setWarningsMode(warningsMode);
-
-        mScriptBlacklist.resize(scriptBlacklist.size());
-
-        std::sort(mScriptBlacklist.begin(), mScriptBlacklist.end());
-    }
-
-    bool ScriptManager::compile(const ESM::RefId& name)
+    namespace
     {
-        mParser.reset();
-        mErrorHandler.reset();
-
-        if (const ESM::Script* script = mStore.get<ESM::Script>().find(name))
+        bool compileScript(const ESM::Script& script, Compiler::StreamErrorHandler& errorHandler,
+            Compiler::FileParser& parser, Compiler::Context& compilerContext)
         {
-            mErrorHandler.setContext(script->mId.getRefIdString());
+            parser.reset();
+            errorHandler.reset();
+            errorHandler.setContext(script.mId.getRefIdString());
 
             bool Success = true;
             try
             {
-                std::istringstream input(script->mScriptText);
+                std::istringstream input(script.mScriptText);
 
-                Compiler::Scanner scanner(mErrorHandler, input, mCompilerContext.getExtensions());
+                Compiler::Scanner scanner(errorHandler, input, compilerContext.getExtensions());
 
-                scanner.scan(mParser);
+                scanner.scan(parser);
 
-                if (!mErrorHandler.isGood())
+                if (!errorHandler.isGood())
                     Success = false;
             }
             catch (const Compiler::SourceException&)
@@ -74,12 +61,66 @@ namespace MWScript
 
             if (!Success)
             {
-                Log(Debug::Error) << "Error: script compiling failed: " << name;
+                Log(Debug::Error) << "Error: script compiling failed: " << script.mId;
             }
 
-            if (Success)
+            return Success;
+        }
+    }
+
+    ScriptManager::ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
+        const std::vector<ESM::RefId>& scriptBlacklist, std::unique_ptr<ScriptCache> cache)
+        : mErrorHandler()
+        , mStore(store)
+        , mCompilerContext(compilerContext)
+        , mParser(mErrorHandler, mCompilerContext)
+        , mOpcodesInstalled(false)
+        , mWarningsMode(warningsMode)
+        , mCache(std::move(cache))
+        , mGlobalScripts(store)
+    {
+        mErrorHandler.setWarningsMode(warningsMode);
+
+        mScriptBlacklist.resize(scriptBlacklist.size());
+
+        std::sort(mScriptBlacklist.begin(), mScriptBlacklist.end());
+    }
+
+    ScriptManager::~ScriptManager()
+    {
+        // Keep scripts compiled during the game for the next start
+        if (mCache != nullptr)
+            mCache->save();
+    }
+
+    bool ScriptManager::compileCached(const ESM::Script& script)
+    {
+        if (mCache == nullptr)
+            return false;
+
+        Interpreter::Program program;
+        Compiler::Locals locals;
+        if (!mCache->get(script.mId, script.mScriptText, program, locals))
+            return false;
+
+        mScripts.emplace(script.mId, CompiledScript(std::move(program), locals));
+        return true;
+    }
+
+    bool ScriptManager::compile(const ESM::RefId& name)
+    {
+        if (const ESM::Script* script = mStore.get<ESM::Script>().find(name))
+        {
+            if (compileCached(*script))
+                return true;
+
+            if (compileScript(*script, mErrorHandler, mParser, mCompilerContext))
             {
-                mScripts.emplace(name, CompiledScript(mParser.getProgram(), mParser.getLocals()));
+                const auto& compiled
+                    = mScripts.emplace(name, CompiledScript(mParser.getProgram(), mParser.getLocals())).first->second;
+
+                if (mCache != nullptr)
+                    mCache->add(name, script->mScriptText, compiled.mProgram, compiled.mLocals);
 
                 return true;
             }
@@ -118,7 +159,11 @@ namespace MWScript
                     mOpcodesInstalled = true;
                 }
 
-                mInterpreter.run(iter->second.mProgram, interpreterContext);
+                // Opcode handlers are resolved only once per script
+                if (iter->second.mDecodedProgram.empty())
+                    iter->second.mDecodedProgram = mInterpreter.decode(iter->second.mProgram);
+
+                mInterpreter.run(iter->second.mProgram, iter->second.mDecodedProgram, interpreterContext);
                 return true;
             }
             catch (const MissingImplicitRefError& e)
@@ -149,17 +194,67 @@ namespace MWScript
         int count = 0;
         int success = 0;
 
+        std::vector<const ESM::Script*> scripts;
         for (auto& script : mStore.get<ESM::Script>())
         {
             if (!std::binary_search(mScriptBlacklist.begin(), mScriptBlacklist.end(), script.mId))
             {
                 ++count;
 
-                if (compile(script.mId))
+                if (compileCached(script))
                     ++success;
+                else
+                    scripts.push_back(&script);
             }
         }
 
+        struct Compiled
+        {
+            Interpreter::Program mProgram;
+            Compiler::Locals mLocals;
+            bool mSuccess = false;
+        };
+
+        // Each thread uses own parser and error handler, the compiler context is shared
+        std::vector<Compiled> compiled(scripts.size());
+        std::atomic_size_t next{ 0 };
+        const auto compileScripts = [&] {
+            Compiler::StreamErrorHandler errorHandler;
+            errorHandler.setWarningsMode(mWarningsMode);
+            Compiler::FileParser parser(errorHandler, mCompilerContext);
+            for (std::size_t i = next++; i < scripts.size(); i = next++)
+            {
+                if (compileScript(*scripts[i], errorHandler, parser, mCompilerContext))
+                    compiled[i] = Compiled{ parser.getProgram(), parser.getLocals(), true };
+            }
+        };
+
+        const std::size_t threadsCount
+            = std::min<std::size_t>(scripts.size(), std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < threadsCount; ++i)
+            threads.emplace_back(compileScripts);
+        compileScripts();
+        for (std::thread& thread : threads)
+            thread.join();
+
+        for (std::size_t i = 0; i < scripts.size(); ++i)
+        {
+            if (!compiled[i].mSuccess)
+                continue;
+
+            ++success;
+
+            const ESM::Script& script = *scripts[i];
+            if (mCache != nullptr)
+                mCache->add(script.mId, script.mScriptText, compiled[i].mProgram, compiled[i].mLocals);
+            mScripts.insert_or_assign(
+                script.mId, CompiledScript(std::move(compiled[i].mProgram), compiled[i].mLocals));
+        }
+
+        if (mCache != nullptr)
+            mCache->save();
+
         return std::make_pair(count, success);
     }
 
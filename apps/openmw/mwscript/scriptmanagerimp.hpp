@@ -2,6 +2,7 @@
 #define GAME_SCRIPT_SCRIPTMANAGER_H
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -22,6 +23,11 @@ namespace MWWorld
     class ESMStore;
 }
 
+namespace ESM
+{
+    class Script;
+}
+
 namespace Compiler
 {
     class Context;
@@ -35,6 +41,8 @@ namespace Interpreter
 
 namespace MWScript
 {
+    class ScriptCache;
+
     class ScriptManager : public MWBase::ScriptManager
     {
         Compiler::StreamErrorHandler mErrorHandler;
@@ -43,10 +51,13 @@ namespace MWScript
         Compiler::FileParser mParser;
         Interpreter::Interpreter mInterpreter;
         bool mOpcodesInstalled;
+        int mWarningsMode;
+        std::unique_ptr<ScriptCache> mCache;
 
         struct CompiledScript
         {
             Interpreter::Program mProgram;
+            Interpreter::DecodedProgram mDecodedProgram;
             Compiler::Locals mLocals;
             std::set<ESM::RefId> mInactive;
 
@@ -62,9 +73,14 @@ namespace MWScript
         std::unordered_map<ESM::RefId, Compiler::Locals> mOtherLocals;
         std::vector<ESM::RefId> mScriptBlacklist;
 
+        bool compileCached(const ESM::Script& script);
+        ///< Take compiled script from the cache if it is up to date.
+
     public:
         ScriptManager(const MWWorld::ESMStore& store, Compiler::Context& compilerContext, int warningsMode,
-            const std::vector<ESM::RefId>& scriptBlacklist);
+            const std::vector<ESM::RefId>& scriptBlacklist, std::unique_ptr<ScriptCache> cache = nullptr);
+
+        ~ScriptManager();
 
         void clear() override;
 
@@ -76,7 +92,7 @@ namespace MWScript
         /// \return Success?
 
         std::pair<int, int> compileAll() override;
-        ///< Compile all scripts
+        ///< Compile all scripts using all available cores
         /// \return count, success
 
         const Compiler::Locals& getLocals(const ESM::RefId& name) override;
@@ -166,6 +166,27 @@ const MWState::Slot* MWState::Character::updateSlot(const Slot* slot, const ESM:
     return &mSlots.back();
 }
 
+const MWState::Slot* MWState::Character::findSlot(const std::filesystem::path& path) const
+{
+    const auto it = std::find_if(mSlots.begin(), mSlots.end(), [&](const Slot& slot) { return slot.mPath == path; });
+    if (it == mSlots.end())
+        return nullptr;
+    return &*it;
+}
+
+void MWState::Character::setScreenshot(const Slot* slot, const std::vector<char>& screenshot)
+{
+    int index = slot - mSlots.data();
+
+    if (index < 0 || index >= static_cast<int>(mSlots.size()))
+    {
+        // sanity check; not entirely reliable
+        throw std::logic_error("slot not found");
+    }
+
+    mSlots[index].mProfile.mScreenshot = screenshot;
+}
+
 MWState::Character::SlotIterator MWState::Character::begin() const
 {
     return mSlots.rbegin();
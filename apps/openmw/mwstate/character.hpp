@@ -52,6 +52,14 @@ namespace MWState
         ///
         /// \attention The \a slot pointer will be invalidated by this call.
 
+        const Slot* findSlot(const std::filesystem::path& path) const;
+        ///< Return the slot with the given file path or nullptr.
+
+        void setScreenshot(const Slot* slot, const std::vector<char>& screenshot);
+        ///< Replace the screenshot of the slot profile.
+        ///
+        /// \note Slot must belong to this character. Unlike updateSlot, does not invalidate the \a slot pointer.
+
         SlotIterator begin() const;
         ///<  Any call to createSlot and updateSlot can invalidate the returned iterator.
 
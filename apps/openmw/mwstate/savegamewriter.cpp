@@ -0,0 +1,203 @@
+#include "savegamewriter.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+#include <osgDB/Registry>
+
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/compressedstream.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/files/conversion.hpp>
+
+namespace MWState
+{
+    namespace
+    {
+        // Large enough to keep the number of system calls low and small enough to report the progress smoothly
+        constexpr std::size_t sChunkSize = 1024 * 1024;
+    }
+
+    SaveGameWriter::SaveGameWriter(const std::filesystem::path& path, const std::vector<std::string>& contentFiles,
+        int recordCount, const ESM::SavedGame& profile, osg::ref_ptr<osg::Image> screenshot, std::string&& data,
+        std::size_t bodyOffset, bool compress)
+        : mPath(path)
+        , mContentFiles(contentFiles)
+        , mRecordCount(recordCount)
+        , mProfile(profile)
+        , mScreenshot(std::move(screenshot))
+        , mData(std::move(data))
+        , mBodyOffset(bodyOffset)
+        , mCompress(compress && mData.size() > mBodyOffset)
+    {
+    }
+
+    ESM::FormatVersion SaveGameWriter::getFormatVersion(bool compress)
+    {
+        return compress ? ESM::CurrentSaveGameFormatVersion : ESM::MaxUncompressedSaveGameFormatVersion;
+    }
+
+    void SaveGameWriter::doWork()
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::filesystem::path tmpPath = mPath;
+        tmpPath += ".tmp";
+
+        try
+        {
+            writeScreenshot();
+            writeFile(writeHeader());
+        }
+        catch (const std::exception& e)
+        {
+            mError = e.what();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+        }
+
+        mData.clear();
+        mData.shrink_to_fit();
+
+        mDuration = std::chrono::steady_clock::now() - start;
+    }
+
+    float SaveGameWriter::getProgress() const
+    {
+        const std::size_t total = mTotal.load(std::memory_order_relaxed);
+        if (total == 0)
+            return 0;
+        return static_cast<float>(mWritten.load(std::memory_order_relaxed)) / static_cast<float>(total);
+    }
+
+    void SaveGameWriter::writeScreenshot()
+    {
+        if (mScreenshot == nullptr)
+            return;
+
+        osgDB::ReaderWriter* readerwriter = osgDB::Registry::instance()->getReaderWriterForExtension("jpg");
+        if (!readerwriter)
+        {
+            Log(Debug::Error) << "Error: Unable to write screenshot, can't find a jpg ReaderWriter";
+            return;
+        }
+
+        std::ostringstream ostream;
+        osgDB::ReaderWriter::WriteResult result = readerwriter->writeImage(*mScreenshot, ostream);
+        if (!result.success())
+        {
+            Log(Debug::Error) << "Error: Unable to write screenshot: " << result.message() << " code "
+                              << result.status();
+            return;
+        }
+
+        const std::string data = ostream.str();
+        mProfile.mScreenshot = std::vector<char>(data.begin(), data.end());
+        mScreenshot = nullptr;
+    }
+
+    std::string SaveGameWriter::writeHeader() const
+    {
+        std::ostringstream stream;
+
+        ESM::ESMWriter writer;
+
+        for (const std::string& contentFile : mContentFiles)
+            writer.addMaster(contentFile, 0); // not using the size information anyway -> use value of 0
+
+        writer.setFormatVersion(getFormatVersion(mCompress));
+
+        // all unused
+        writer.setVersion(0);
+        writer.setType(0);
+        writer.setAuthor("");
+        writer.setDescription("");
+
+        writer.setRecordCount(mRecordCount);
+
+        writer.save(stream);
+
+        writer.startRecord(ESM::REC_SAVE);
+        mProfile.save(writer);
+        writer.endRecord(ESM::REC_SAVE);
+
+        writer.close();
+
+        if (stream.fail())
+            throw std::runtime_error("Write operation failed (memory stream)");
+
+        return std::move(stream).str();
+    }
+
+    void SaveGameWriter::writeFile(const std::string& header)
+    {
+        const std::string_view body = std::string_view(mData).substr(mBodyOffset);
+
+        mTotal.store(header.size() + body.size(), std::memory_order_relaxed);
+
+        std::filesystem::path tmpPath = mPath;
+        tmpPath += ".tmp";
+
+        {
+            Platform::File::ScopedHandle handle = Platform::File::create(tmpPath);
+
+            Platform::File::write(handle, header.data(), header.size());
+            mWritten.store(header.size(), std::memory_order_relaxed);
+
+            if (mCompress)
+                writeCompressed(handle, body, header.size());
+            else
+            {
+                for (std::size_t offset = 0; offset < body.size(); offset += sChunkSize)
+                {
+                    const std::size_t size = std::min(sChunkSize, body.size() - offset);
+                    Platform::File::write(handle, body.data() + offset, size);
+                    mWritten.fetch_add(size, std::memory_order_relaxed);
+                }
+            }
+
+            // Make sure the content is on the disk before the old file is replaced, otherwise a crash or power loss
+            // right after the rename may leave an empty file in place of both saves
+            Platform::File::sync(handle);
+        }
+
+        std::filesystem::rename(tmpPath, mPath);
+    }
+
+    void SaveGameWriter::writeCompressed(Platform::File::Handle handle, std::string_view body, std::size_t offset)
+    {
+        // Record name, size, unused and flags. The size is known only when the body is compressed.
+        std::uint32_t recordHeader[4] = { ESM::REC_LZ4C, 0, 0, 0 };
+        Platform::File::write(handle, recordHeader, sizeof(recordHeader));
+
+        const std::uint64_t uncompressedSize = body.size();
+        Platform::File::write(handle, &uncompressedSize, sizeof(uncompressedSize));
+
+        std::size_t recordSize = sizeof(uncompressedSize);
+        const auto write = [&](std::string_view data) {
+            Platform::File::write(handle, data.data(), data.size());
+            recordSize += data.size();
+        };
+
+        ESM::Lz4FrameCompressor compressor;
+        write(compressor.begin());
+        for (std::size_t position = 0; position < body.size(); position += sChunkSize)
+        {
+            const std::size_t size = std::min(sChunkSize, body.size() - position);
+            write(compressor.update(body.substr(position, size)));
+            mWritten.fetch_add(size, std::memory_order_relaxed);
+        }
+        write(compressor.end());
+
+        if (recordSize > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("Compressed saved game is too large: " + std::to_string(recordSize) + " bytes");
+
+        recordHeader[1] = static_cast<std::uint32_t>(recordSize);
+        Platform::File::seek(handle, offset);
+        Platform::File::write(handle, recordHeader, sizeof(recordHeader));
+    }
+}
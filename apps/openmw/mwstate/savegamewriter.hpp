@@ -0,0 +1,78 @@
+#ifndef GAME_STATE_SAVEGAMEWRITER_H
+#define GAME_STATE_SAVEGAMEWRITER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <osg/Image>
+#include <osg/ref_ptr>
+
+#include <components/esm3/formatversion.hpp>
+#include <components/esm3/savedgame.hpp>
+#include <components/platform/file.hpp>
+#include <components/sceneutil/workqueue.hpp>
+
+namespace MWState
+{
+    class SaveGameWriter final : public SceneUtil::WorkItem
+    {
+        std::filesystem::path mPath;
+        std::vector<std::string> mContentFiles;
+        int mRecordCount;
+        ESM::SavedGame mProfile;
+        osg::ref_ptr<osg::Image> mScreenshot;
+        std::string mData;
+        std::size_t mBodyOffset;
+        bool mCompress;
+        std::atomic<std::size_t> mWritten{ 0 };
+        std::atomic<std::size_t> mTotal{ 0 };
+        std::string mError;
+        std::chrono::steady_clock::duration mDuration{};
+
+        void writeScreenshot();
+
+        std::string writeHeader() const;
+
+        void writeFile(const std::string& header);
+
+        void writeCompressed(Platform::File::Handle handle, std::string_view body, std::size_t offset);
+
+    public:
+        SaveGameWriter(const std::filesystem::path& path, const std::vector<std::string>& contentFiles,
+            int recordCount, const ESM::SavedGame& profile, osg::ref_ptr<osg::Image> screenshot, std::string&& data,
+            std::size_t bodyOffset, bool compress);
+        ///< Second phase of saving a game.
+        ///
+        /// \param recordCount Number of records including the saved game header but not the TES3 record.
+        /// \param data Memory stream content of the first phase, the body of the file starts at \a bodyOffset.
+        /// \param compress Store the body as a single LZ4 compressed record, see ESM::REC_LZ4C.
+
+        static ESM::FormatVersion getFormatVersion(bool compress);
+        ///< Compressed saved games can't be loaded by versions not supporting ESM::REC_LZ4C, so the newest format
+        /// version is used only for them.
+
+        void doWork() override;
+        ///< Encodes the screenshot, writes the file header and the body to a temporary file, flushes it to the disk
+        /// and replaces the target file.
+
+        const std::filesystem::path& getPath() const { return mPath; }
+
+        float getProgress() const;
+        ///< Returns the part of the file that is written, in the [0, 1] range.
+
+        const ESM::SavedGame& getProfile() const { return mProfile; }
+        ///< Includes the encoded screenshot once the work is done.
+
+        const std::string& getError() const { return mError; }
+        ///< Empty on success, valid once the work is done.
+
+        std::chrono::steady_clock::duration getDuration() const { return mDuration; }
+    };
+}
+
+#endif
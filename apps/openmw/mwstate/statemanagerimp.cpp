@@ -1,6 +1,7 @@
 #include "statemanagerimp.hpp"
 
 #include <filesystem>
+#include <thread>
 
 #include <components/debug/debuglog.hpp>
 
@@ -14,12 +15,12 @@
 #include <components/loadinglistener/loadinglistener.hpp>
 
 #include <components/files/conversion.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/settings/settings.hpp>
+#include <components/settings/values.hpp>
 
 #include <osg/Image>
 
-#include <osgDB/Registry>
-
 #include "../mwbase/dialoguemanager.hpp"
 #include "../mwbase/environment.hpp"
 #include "../mwbase/inputmanager.hpp"
@@ -44,9 +45,12 @@
 #include "../mwscript/globalscripts.hpp"
 
 #include "quicksavemanager.hpp"
+#include "savegamewriter.hpp"
 
 void MWState::StateManager::cleanup(bool force)
 {
+    finishPendingSave();
+
     if (mState != State_NoGame || force)
     {
         MWBase::Environment::get().getSoundManager()->clear();
@@ -90,13 +94,28 @@ std::map<int, int> MWState::StateManager::buildContentFileIndexMap(const ESM::ES
     return map;
 }
 
-MWState::StateManager::StateManager(const std::filesystem::path& saves, const std::vector<std::string>& contentFiles)
+MWState::StateManager::StateManager(
+    const std::filesystem::path& saves, const std::vector<std::string>& contentFiles, SceneUtil::WorkQueue* workQueue)
     : mQuitRequest(false)
     , mAskLoadRecent(false)
     , mState(State_NoGame)
     , mCharacterManager(saves, contentFiles)
     , mTimePlayed(0)
+    , mWorkQueue(workQueue)
+    , mPendingSaveCharacter(nullptr)
+    , mPendingSaveSlot(nullptr)
+{
+}
+
+MWState::StateManager::~StateManager()
 {
+    // Other managers may be already destroyed, so only make sure the file is complete
+    if (mPendingSave != nullptr)
+    {
+        mPendingSave->waitTillDone();
+        if (!mPendingSave->getError().empty())
+            Log(Debug::Error) << "Failed to save game: " << mPendingSave->getError();
+    }
 }
 
 void MWState::StateManager::requestQuit()
@@ -190,7 +209,14 @@ void MWState::StateManager::resumeGame()
 
 void MWState::StateManager::saveGame(const std::string& description, const Slot* slot)
 {
+    // A failed pending save deletes its slot, which invalidates pointers to the other slots of the character. So
+    // the given slot is looked up again by its path, and a new one is created if it was the deleted slot.
+    const std::filesystem::path slotPath = slot != nullptr ? slot->mPath : std::filesystem::path();
+    finishPendingSave();
+
     MWState::Character* character = getCurrentCharacter();
+    if (slot != nullptr)
+        slot = character != nullptr ? character->findSlot(slotPath) : nullptr;
 
     try
     {
@@ -230,8 +256,9 @@ void MWState::StateManager::saveGame(const std::string& description, const Slot*
         profile.mDescription = description;
 
         Log(Debug::Info) << "Making a screenshot for saved game '" << description << "'";
-        writeScreenshot(profile.mScreenshot);
+        osg::ref_ptr<osg::Image> screenshot = makeScreenshot();
 
+        // The screenshot is added to the slot once it is encoded
         if (!slot)
             slot = character->createSlot(profile);
         else
@@ -242,24 +269,18 @@ void MWState::StateManager::saveGame(const std::string& description, const Slot*
 
         Log(Debug::Info) << "Writing saved game '" << description << "' for character '" << profile.mPlayerName << "'";
 
-        // Write to a memory stream first. If there is an exception during the save process, we don't want to trash the
-        // existing save file we are overwriting.
+        // Serialize the game state to a memory stream first. The file header and the saved game record holding the
+        // screenshot are written later by SaveGameWriter, so the header written here is only needed to initialize the
+        // writer and is skipped.
         std::stringstream stream;
 
-        ESM::ESMWriter writer;
-
-        for (const std::string& contentFile : MWBase::Environment::get().getWorld()->getContentFiles())
-            writer.addMaster(contentFile, 0); // not using the size information anyway -> use value of 0
+        const bool compress = Settings::saves().mCompress;
 
-        writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
+        ESM::ESMWriter writer;
 
-        // all unused
-        writer.setVersion(0);
-        writer.setType(0);
-        writer.setAuthor("");
-        writer.setDescription("");
+        writer.setFormatVersion(SaveGameWriter::getFormatVersion(compress));
 
-        int recordCount = 1 // saved game header
+        const int recordCount = 1 // saved game header
             + MWBase::Environment::get().getJournal()->countSavedGameRecords()
             + MWBase::Environment::get().getLuaManager()->countSavedGameRecords()
             + MWBase::Environment::get().getWorld()->countSavedGameRecords()
@@ -268,57 +289,60 @@ void MWState::StateManager::saveGame(const std::string& description, const Slot*
             + MWBase::Environment::get().getMechanicsManager()->countSavedGameRecords()
             + MWBase::Environment::get().getInputManager()->countSavedGameRecords()
             + MWBase::Environment::get().getWindowManager()->countSavedGameRecords();
-        writer.setRecordCount(recordCount);
 
         writer.save(stream);
 
-        Loading::Listener& listener = *MWBase::Environment::get().getWindowManager()->getLoadingScreen();
-        // Using only Cells for progress information, since they typically have the largest records by far
-        listener.setProgressRange(MWBase::Environment::get().getWorld()->countSavedGameCells());
-        listener.setLabel("#{OMWEngine:SavingInProgress}", true);
+        const std::size_t bodyOffset = static_cast<std::size_t>(stream.tellp());
 
-        Loading::ScopedLoad load(&listener);
+        {
+            Loading::Listener& listener = *MWBase::Environment::get().getWindowManager()->getLoadingScreen();
+            // Using only Cells for progress information, since they typically have the largest records by far
+            listener.setProgressRange(MWBase::Environment::get().getWorld()->countSavedGameCells());
+            listener.setLabel("#{OMWEngine:SavingInProgress}", true);
+
+            Loading::ScopedLoad load(&listener);
+
+            MWBase::Environment::get().getJournal()->write(writer, listener);
+            MWBase::Environment::get().getDialogueManager()->write(writer, listener);
+            // LuaManager::write should be called before World::write because world also saves
+            // local scripts that depend on LuaManager.
+            MWBase::Environment::get().getLuaManager()->write(writer, listener);
+            MWBase::Environment::get().getWorld()->write(writer, listener);
+            MWBase::Environment::get().getScriptManager()->getGlobalScripts().write(writer, listener);
+            MWBase::Environment::get().getMechanicsManager()->write(writer, listener);
+            MWBase::Environment::get().getInputManager()->write(writer, listener);
+            MWBase::Environment::get().getWindowManager()->write(writer, listener);
+        }
 
-        writer.startRecord(ESM::REC_SAVE);
-        slot->mProfile.save(writer);
-        writer.endRecord(ESM::REC_SAVE);
-
-        MWBase::Environment::get().getJournal()->write(writer, listener);
-        MWBase::Environment::get().getDialogueManager()->write(writer, listener);
-        // LuaManager::write should be called before World::write because world also saves
-        // local scripts that depend on LuaManager.
-        MWBase::Environment::get().getLuaManager()->write(writer, listener);
-        MWBase::Environment::get().getWorld()->write(writer, listener);
-        MWBase::Environment::get().getScriptManager()->getGlobalScripts().write(writer, listener);
-        MWBase::Environment::get().getMechanicsManager()->write(writer, listener);
-        MWBase::Environment::get().getInputManager()->write(writer, listener);
-        MWBase::Environment::get().getWindowManager()->write(writer, listener);
-
-        // Ensure we have written the number of records that was estimated
-        if (writer.getRecordCount() != recordCount + 1) // 1 extra for TES3 record
+        // Ensure we have written the number of records that was estimated. 1 extra for TES3 record and 1 missing
+        // saved game header which is written by SaveGameWriter.
+        if (writer.getRecordCount() != recordCount)
             Log(Debug::Warning) << "Warning: number of written savegame records does not match. Estimated: "
-                                << recordCount + 1 << ", written: " << writer.getRecordCount();
+                                << recordCount + 1 << ", written: " << writer.getRecordCount() + 1;
 
         writer.close();
 
         if (stream.fail())
             throw std::runtime_error("Write operation failed (memory stream)");
 
-        // All good, write to file
-        std::ofstream filestream(slot->mPath, std::ios::binary);
-        filestream << stream.rdbuf();
+        mPendingSave = new SaveGameWriter(slot->mPath, profile.mContentFiles, recordCount, profile,
+            std::move(screenshot), std::move(stream).str(), bodyOffset, compress);
+        mPendingSaveCharacter = character;
+        mPendingSaveSlot = slot;
 
-        if (filestream.fail())
-            throw std::runtime_error("Write operation failed (file stream)");
-
-        Settings::Manager::setString(
-            "character", "Saves", Files::pathToUnicodeString(slot->mPath.parent_path().filename()));
+        if (mWorkQueue != nullptr)
+            mWorkQueue->addWorkItem(mPendingSave, SceneUtil::WorkCategory::Other, SceneUtil::WorkPriority::High);
+        else
+            mPendingSave->doWork();
 
         const auto finish = std::chrono::steady_clock::now();
 
-        Log(Debug::Info) << '\'' << description << "' is saved in "
+        Log(Debug::Info) << '\'' << description << "' is serialized in "
                          << std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(finish - start).count()
                          << "ms";
+
+        if (mWorkQueue == nullptr)
+            finishPendingSave();
     }
     catch (const std::exception& e)
     {
@@ -340,6 +364,69 @@ void MWState::StateManager::saveGame(const std::string& description, const Slot*
     }
 }
 
+void MWState::StateManager::finishPendingSave()
+{
+    if (mPendingSave == nullptr)
+        return;
+
+    if (!mPendingSave->isDone())
+    {
+        Loading::Listener& listener = *MWBase::Environment::get().getWindowManager()->getLoadingScreen();
+        constexpr std::size_t progressRange = 1000;
+        listener.setProgressRange(progressRange);
+        listener.setLabel("#{OMWEngine:SavingInProgress}", true);
+
+        Loading::ScopedLoad load(&listener);
+
+        while (!mPendingSave->isDone())
+        {
+            listener.setProgress(static_cast<std::size_t>(mPendingSave->getProgress() * progressRange));
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    handleFinishedSave();
+}
+
+void MWState::StateManager::handleFinishedSave()
+{
+    const osg::ref_ptr<SaveGameWriter> save = mPendingSave;
+    Character* const character = mPendingSaveCharacter;
+    const Slot* const slot = mPendingSaveSlot;
+    mPendingSave = nullptr;
+    mPendingSaveCharacter = nullptr;
+    mPendingSaveSlot = nullptr;
+
+    std::string error = save->getError();
+    if (error.empty() && save->isCancelled())
+        error = "writing is cancelled";
+
+    if (!error.empty())
+    {
+        Log(Debug::Error) << "Failed to save game: " << error;
+
+        std::vector<std::string> buttons;
+        buttons.emplace_back("#{Interface:OK}");
+        MWBase::Environment::get().getWindowManager()->interactiveMessageBox("Failed to save game: " + error, buttons);
+
+        // If no file was written, clean up the slot
+        if (!std::filesystem::exists(slot->mPath))
+        {
+            character->deleteSlot(slot);
+            character->cleanup();
+        }
+        return;
+    }
+
+    character->setScreenshot(slot, save->getProfile().mScreenshot);
+
+    Settings::Manager::setString(
+        "character", "Saves", Files::pathToUnicodeString(slot->mPath.parent_path().filename()));
+
+    const auto duration = std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(save->getDuration());
+    Log(Debug::Info) << '\'' << save->getProfile().mDescription << "' is saved in " << duration.count() << "ms";
+}
+
 void MWState::StateManager::quickSave(std::string name)
 {
     if (!(mState == State_Running
@@ -395,8 +482,11 @@ struct VersionMismatchError : public std::runtime_error
     using std::runtime_error::runtime_error;
 };
 
-void MWState::StateManager::loadGame(const Character* character, const std::filesystem::path& filepath)
+void MWState::StateManager::loadGame(const Character* character, const std::filesystem::path& path)
 {
+    // The path may belong to a slot that is deleted by cleanup when the pending save fails
+    const std::filesystem::path filepath = path;
+
     try
     {
         cleanup();
@@ -623,7 +713,12 @@ void MWState::StateManager::quickLoad()
 
 void MWState::StateManager::deleteGame(const MWState::Character* character, const MWState::Slot* slot)
 {
-    mCharacterManager.deleteSlot(character, slot);
+    // A failed pending save deletes its slot, which invalidates pointers to the other slots of the character
+    const std::filesystem::path slotPath = slot->mPath;
+    finishPendingSave();
+
+    if (const Slot* const current = character->findSlot(slotPath))
+        mCharacterManager.deleteSlot(character, current);
 }
 
 MWState::Character* MWState::StateManager::getCurrentCharacter()
@@ -645,6 +740,9 @@ void MWState::StateManager::update(float duration)
 {
     mTimePlayed += duration;
 
+    if (mPendingSave != nullptr && mPendingSave->isDone())
+        handleFinishedSave();
+
     // Note: It would be nicer to trigger this from InputManager, i.e. the very beginning of the frame update.
     if (mAskLoadRecent)
     {
@@ -693,7 +791,7 @@ bool MWState::StateManager::verifyProfile(const ESM::SavedGame& profile) const
     return true;
 }
 
-void MWState::StateManager::writeScreenshot(std::vector<char>& imageData) const
+osg::ref_ptr<osg::Image> MWState::StateManager::makeScreenshot() const
 {
     int screenshotW = 259 * 2, screenshotH = 133 * 2; // *2 to get some nice antialiasing
 
@@ -701,21 +799,5 @@ void MWState::StateManager::writeScreenshot(std::vector<char>& imageData) const
 
     MWBase::Environment::get().getWorld()->screenshot(screenshot.get(), screenshotW, screenshotH);
 
-    osgDB::ReaderWriter* readerwriter = osgDB::Registry::instance()->getReaderWriterForExtension("jpg");
-    if (!readerwriter)
-    {
-        Log(Debug::Error) << "Error: Unable to write screenshot, can't find a jpg ReaderWriter";
-        return;
-    }
-
-    std::ostringstream ostream;
-    osgDB::ReaderWriter::WriteResult result = readerwriter->writeImage(*screenshot, ostream);
-    if (!result.success())
-    {
-        Log(Debug::Error) << "Error: Unable to write screenshot: " << result.message() << " code " << result.status();
-        return;
-    }
-
-    std::string data = ostream.str();
-    imageData = std::vector<char>(data.begin(), data.end());
+    return screenshot;
 }
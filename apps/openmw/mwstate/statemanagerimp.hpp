@@ -4,12 +4,26 @@
 #include <filesystem>
 #include <map>
 
+#include <osg/ref_ptr>
+
 #include "../mwbase/statemanager.hpp"
 
 #include "charactermanager.hpp"
 
+namespace osg
+{
+    class Image;
+}
+
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWState
 {
+    class SaveGameWriter;
+
     class StateManager : public MWBase::StateManager
     {
         bool mQuitRequest;
@@ -17,18 +31,27 @@ namespace MWState
         State mState;
         CharacterManager mCharacterManager;
         double mTimePlayed;
+        SceneUtil::WorkQueue* mWorkQueue;
+        osg::ref_ptr<SaveGameWriter> mPendingSave;
+        Character* mPendingSaveCharacter;
+        const Slot* mPendingSaveSlot;
 
     private:
         void cleanup(bool force = false);
 
         bool verifyProfile(const ESM::SavedGame& profile) const;
 
-        void writeScreenshot(std::vector<char>& imageData) const;
+        osg::ref_ptr<osg::Image> makeScreenshot() const;
+
+        void handleFinishedSave();
 
         std::map<int, int> buildContentFileIndexMap(const ESM::ESMReader& reader) const;
 
     public:
-        StateManager(const std::filesystem::path& saves, const std::vector<std::string>& contentFiles);
+        StateManager(const std::filesystem::path& saves, const std::vector<std::string>& contentFiles,
+            SceneUtil::WorkQueue* workQueue);
+
+        ~StateManager() override;
 
         void requestQuit() override;
 
@@ -54,6 +77,9 @@ namespace MWState
         void saveGame(const std::string& description, const Slot* slot = nullptr) override;
         ///< Write a saved game to \a slot or create a new slot if \a slot == 0.
         ///
+        /// The game state is serialized immediately, encoding the screenshot and writing the file are done by the
+        /// work queue. The file appears on the disk later and replaces the old one only when it is complete.
+        ///
         /// \note Slot must belong to the current character.
 
         /// Saves a file, using supplied filename, overwritting if needed
@@ -83,6 +109,9 @@ namespace MWState
         CharacterIterator characterEnd() override;
 
         void update(float duration);
+
+        void finishPendingSave();
+        ///< Wait until the saved game being written in background is on the disk.
     };
 }
 
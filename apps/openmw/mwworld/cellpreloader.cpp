@@ -279,7 +279,7 @@ namespace MWWorld
 
             if (oldestTimestamp + threshold < timestamp)
             {
-                oldestCell->second.mWorkItem->abort();
+                oldestCell->second.mWorkItem->cancel();
                 mPreloadCells.erase(oldestCell);
             }
             else
@@ -288,7 +288,7 @@ namespace MWWorld
 
         osg::ref_ptr<PreloadItem> item(new PreloadItem(&cell, mResourceSystem->getSceneManager(), mBulletShapeManager,
             mResourceSystem->getKeyframeManager(), mTerrain, mLandManager, mPreloadInstances));
-        mWorkQueue->addWorkItem(item);
+        mWorkQueue->addWorkItem(item, SceneUtil::WorkCategory::CellPreload);
 
         mPreloadCells[&cell] = PreloadEntry(timestamp, item);
     }
@@ -300,7 +300,7 @@ namespace MWWorld
         {
             if (found->second.mWorkItem)
             {
-                found->second.mWorkItem->abort();
+                found->second.mWorkItem->cancel();
                 found->second.mWorkItem = nullptr;
             }
 
@@ -314,7 +314,7 @@ namespace MWWorld
         {
             if (it->second.mWorkItem)
             {
-                it->second.mWorkItem->abort();
+                it->second.mWorkItem->cancel();
                 it->second.mWorkItem = nullptr;
             }
 
@@ -330,7 +330,7 @@ namespace MWWorld
             {
                 if (it->second.mWorkItem)
                 {
-                    it->second.mWorkItem->abort();
+                    it->second.mWorkItem->cancel();
                     it->second.mWorkItem = nullptr;
                 }
                 mPreloadCells.erase(it++);
@@ -344,7 +344,8 @@ namespace MWWorld
             // the resource cache is cleared from the worker thread so that we're not holding up the main thread with
             // delete operations
             mUpdateCacheItem = new UpdateCacheItem(mResourceSystem, timestamp);
-            mWorkQueue->addWorkItem(mUpdateCacheItem, true);
+            mWorkQueue->addWorkItem(
+                mUpdateCacheItem, SceneUtil::WorkCategory::CellPreload, SceneUtil::WorkPriority::High);
             mLastResourceCacheUpdate = timestamp;
         }
 
@@ -397,7 +398,7 @@ namespace MWWorld
             return;
         if (mTerrainPreloadItem && !mTerrainPreloadItem->isDone())
         {
-            mTerrainPreloadItem->abort();
+            mTerrainPreloadItem->cancel();
             mTerrainPreloadItem->waitTillDone();
         }
         setTerrainPreloadPositions(std::vector<CellPreloader::PositionCellGrid>());
@@ -428,7 +429,9 @@ namespace MWWorld
             if (!positions.empty())
             {
                 mTerrainPreloadItem = new TerrainPreloadItem(mTerrainViews, mTerrain, positions);
-                mWorkQueue->addWorkItem(mTerrainPreloadItem);
+                // Terrain and object paging chunks for the view distance should not delay cells preloading
+                mWorkQueue->addWorkItem(
+                    mTerrainPreloadItem, SceneUtil::WorkCategory::TerrainPreload, SceneUtil::WorkPriority::Low);
             }
         }
     }
@@ -452,7 +455,7 @@ namespace MWWorld
     {
         if (mTerrainPreloadItem)
         {
-            mTerrainPreloadItem->abort();
+            mTerrainPreloadItem->cancel();
             mTerrainPreloadItem->waitTillDone();
             mTerrainPreloadItem = nullptr;
         }
@@ -464,7 +467,7 @@ namespace MWWorld
         }
 
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
-            it->second.mWorkItem->abort();
+            it->second.mWorkItem->cancel();
 
         for (PreloadMap::iterator it = mPreloadCells.begin(); it != mPreloadCells.end(); ++it)
             it->second.mWorkItem->waitTillDone();
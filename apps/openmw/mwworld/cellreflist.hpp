@@ -1,7 +1,7 @@
 #ifndef GAME_MWWORLD_CELLREFLIST_H
 #define GAME_MWWORLD_CELLREFLIST_H
 
-#include <list>
+#include <components/misc/chunkedlist.hpp>
 
 #include "livecellref.hpp"
 
@@ -16,7 +16,7 @@ namespace MWWorld
     struct CellRefList : public CellRefListBase
     {
         typedef LiveCellRef<X> LiveRef;
-        typedef std::list<LiveRef> List;
+        typedef Misc::ChunkedList<LiveRef> List;
         List mList;
 
         /// Search for the given reference in the given reclist from
@@ -32,8 +32,7 @@ namespace MWWorld
 
         LiveRef& insert(const LiveRef& item)
         {
-            mList.push_back(item);
-            return mList.back();
+            return mList.emplace_back(item);
         }
 
         /// Remove all references with the given refNum from this list.
@@ -42,7 +41,7 @@ namespace MWWorld
             for (typename List::iterator it = mList.begin(); it != mList.end();)
             {
                 if (*it == refNum)
-                    mList.erase(it++);
+                    it = mList.erase(it);
                 else
                     ++it;
             }
@@ -0,0 +1,97 @@
+#include "contentfilesfingerprint.hpp"
+
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/files/collections.hpp>
+#include <components/files/conversion.hpp>
+#include <components/to_utf8/to_utf8.hpp>
+
+namespace MWWorld
+{
+    namespace
+    {
+        std::string getEncodingFingerprint(const ToUTF8::StatelessUtf8Encoder* encoder)
+        {
+            if (encoder == nullptr)
+                return {};
+            std::string input;
+            for (int i = 0x80; i <= 0xff; ++i)
+                input.push_back(static_cast<char>(i));
+            std::string buffer;
+            return std::string(encoder->getUtf8(input, ToUTF8::BufferAllocationPolicy::FitToRequiredSize, buffer));
+        }
+
+        std::vector<std::filesystem::path> getPaths(
+            const Files::Collections& fileCollections, const std::vector<std::string>& content)
+        {
+            std::vector<std::filesystem::path> result;
+            for (auto& [index, path] : getContentFilePaths(fileCollections, content))
+                result.push_back(std::move(path));
+            return result;
+        }
+    }
+
+    std::vector<std::pair<int, std::filesystem::path>> getContentFilePaths(
+        const Files::Collections& fileCollections, const std::vector<std::string>& content)
+    {
+        std::vector<std::pair<int, std::filesystem::path>> result;
+        for (std::size_t i = 0; i < content.size(); ++i)
+        {
+            const Files::MultiDirCollection& col = fileCollections.getCollection(
+                Files::pathToUnicodeString(Files::pathFromUnicodeString(content[i]).extension()));
+            if (col.doesExist(content[i]))
+                result.emplace_back(static_cast<int>(i), col.getPath(content[i]));
+        }
+        return result;
+    }
+
+    ContentFilesFingerprint::ContentFilesFingerprint(
+        const std::vector<std::filesystem::path>& contentFiles, const ToUTF8::StatelessUtf8Encoder* encoder)
+        : mEncoding(getEncodingFingerprint(encoder))
+    {
+        mContentFiles.reserve(contentFiles.size());
+        for (const std::filesystem::path& contentFile : contentFiles)
+        {
+            ContentFile& file = mContentFiles.emplace_back();
+            file.mPath = Files::pathToUnicodeString(contentFile);
+            std::error_code ec;
+            file.mSize = std::filesystem::file_size(contentFile, ec);
+            file.mModificationTime = std::filesystem::last_write_time(contentFile, ec).time_since_epoch().count();
+        }
+    }
+
+    ContentFilesFingerprint::ContentFilesFingerprint(const Files::Collections& fileCollections,
+        const std::vector<std::string>& content, const ToUTF8::StatelessUtf8Encoder* encoder)
+        : ContentFilesFingerprint(getPaths(fileCollections, content), encoder)
+    {
+    }
+
+    void ContentFilesFingerprint::save(ESM::ESMWriter& writer) const
+    {
+        writer.writeHNString("ENCD", mEncoding);
+        for (const ContentFile& file : mContentFiles)
+        {
+            writer.writeHNString("FILE", file.mPath);
+            writer.writeHNT("SIZE", file.mSize);
+            writer.writeHNT("TIME", file.mModificationTime);
+        }
+    }
+
+    bool ContentFilesFingerprint::matches(ESM::ESMReader& reader) const
+    {
+        if (reader.getHNString("ENCD") != mEncoding)
+            return false;
+        for (const ContentFile& file : mContentFiles)
+        {
+            if (!reader.isNextSub("FILE") || reader.getHString() != file.mPath)
+                return false;
+            std::uint64_t size = 0;
+            std::int64_t modificationTime = 0;
+            reader.getHNT(size, "SIZE");
+            reader.getHNT(modificationTime, "TIME");
+            if (size != file.mSize || modificationTime != file.mModificationTime)
+                return false;
+        }
+        return !reader.isNextSub("FILE");
+    }
+}
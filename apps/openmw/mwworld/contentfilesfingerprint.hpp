@@ -0,0 +1,62 @@
+#ifndef OPENMW_MWWORLD_CONTENTFILESFINGERPRINT_H
+#define OPENMW_MWWORLD_CONTENTFILESFINGERPRINT_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ESM
+{
+    class ESMReader;
+    class ESMWriter;
+}
+
+namespace Files
+{
+    class Collections;
+}
+
+namespace ToUTF8
+{
+    class StatelessUtf8Encoder;
+}
+
+namespace MWWorld
+{
+    /// Returns paths of the existing content files with their indices in the content list
+    std::vector<std::pair<int, std::filesystem::path>> getContentFilePaths(
+        const Files::Collections& fileCollections, const std::vector<std::string>& content);
+
+    /// Identifies the list of loaded content files by their paths, sizes and modification times together with the
+    /// text encoding. Data derived from content files and cached on disk is valid only for the same fingerprint.
+    class ContentFilesFingerprint
+    {
+    public:
+        explicit ContentFilesFingerprint(
+            const std::vector<std::filesystem::path>& contentFiles, const ToUTF8::StatelessUtf8Encoder* encoder);
+
+        explicit ContentFilesFingerprint(const Files::Collections& fileCollections,
+            const std::vector<std::string>& content, const ToUTF8::StatelessUtf8Encoder* encoder);
+
+        /// Writes subrecords of the current record
+        void save(ESM::ESMWriter& writer) const;
+
+        /// Reads subrecords written by save and returns true when they match this fingerprint
+        bool matches(ESM::ESMReader& reader) const;
+
+    private:
+        struct ContentFile
+        {
+            std::string mPath;
+            std::uint64_t mSize = 0;
+            std::int64_t mModificationTime = 0;
+        };
+
+        std::vector<ContentFile> mContentFiles;
+        std::string mEncoding;
+    };
+}
+
+#endif
@@ -1,8 +1,14 @@
 #include "esmloader.hpp"
 #include "esmstore.hpp"
 
+#include <algorithm>
+#include <condition_variable>
 #include <fstream>
+#include <future>
+#include <mutex>
+#include <thread>
 
+#include <components/debug/debuglog.hpp>
 #include <components/esm/format.hpp>
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/readerscache.hpp>
@@ -16,6 +22,131 @@
 
 namespace MWWorld
 {
+    class EsmLoader::Decoder
+    {
+    public:
+        Decoder(ESMStore& store, const ToUTF8::Utf8Encoder* encoder,
+            std::vector<std::pair<int, std::filesystem::path>>&& files, std::size_t threadsNumber)
+            : mStore(store)
+            , mQueueLimit(threadsNumber + 1)
+        {
+            if (encoder != nullptr)
+                mEncoder.emplace(encoder->getStatelessEncoder());
+            mTasks.reserve(files.size());
+            for (auto& [index, path] : files)
+            {
+                Task& task = mTasks.emplace_back();
+                task.mIndex = index;
+                task.mPath = std::move(path);
+                task.mResult = task.mPromise.get_future();
+            }
+            for (std::size_t i = 0; i < std::min(threadsNumber, mTasks.size()); ++i)
+                mThreads.emplace_back([this] { run(); });
+        }
+
+        ~Decoder()
+        {
+            {
+                const std::lock_guard lock(mMutex);
+                mStop = true;
+            }
+            mHasQueueSpace.notify_all();
+            for (std::thread& thread : mThreads)
+                thread.join();
+        }
+
+        /// Wait until the file with given index is decoded. Returns no records for files that were not decoded.
+        /// Files are expected to be taken in the order they were given, results of the skipped ones are dropped.
+        DecodedRecords take(int index)
+        {
+            const auto it = std::find_if(
+                mTasks.begin(), mTasks.end(), [&](const Task& task) { return task.mIndex == index; });
+            if (it == mTasks.end() || !it->mResult.valid())
+                return {};
+            const std::size_t taskIndex = static_cast<std::size_t>(it - mTasks.begin());
+            setTaken(taskIndex);
+            DecodedRecords result = it->mResult.get();
+            setTaken(taskIndex + 1);
+            return result;
+        }
+
+    private:
+        struct Task
+        {
+            int mIndex = 0;
+            std::filesystem::path mPath;
+            std::promise<DecodedRecords> mPromise;
+            std::future<DecodedRecords> mResult;
+        };
+
+        ESMStore& mStore;
+        std::optional<ToUTF8::StatelessUtf8Encoder> mEncoder;
+        std::vector<Task> mTasks;
+        // Decoded records of a file stay in memory until it is loaded, so workers don't run more than
+        // mQueueLimit files ahead of the loading
+        const std::size_t mQueueLimit;
+        std::mutex mMutex;
+        std::condition_variable mHasQueueSpace;
+        std::size_t mNextTask = 0;
+        std::size_t mTaken = 0;
+        bool mStop = false;
+        std::vector<std::thread> mThreads;
+
+        void setTaken(std::size_t taken)
+        {
+            {
+                const std::lock_guard lock(mMutex);
+                if (taken <= mTaken)
+                    return;
+                mTaken = taken;
+            }
+            mHasQueueSpace.notify_all();
+        }
+
+        std::optional<std::size_t> getNextTask()
+        {
+            std::unique_lock lock(mMutex);
+            mHasQueueSpace.wait(lock, [&] {
+                return mStop || mNextTask >= mTasks.size() || mNextTask < mTaken + mQueueLimit;
+            });
+            if (mStop || mNextTask >= mTasks.size())
+                return std::nullopt;
+            return mNextTask++;
+        }
+
+        void run()
+        {
+            std::optional<ToUTF8::Utf8Encoder> encoder;
+            if (mEncoder.has_value())
+                encoder.emplace(*mEncoder);
+
+            while (const std::optional<std::size_t> taskIndex = getNextTask())
+            {
+                Task& task = mTasks[*taskIndex];
+                DecodedRecords result;
+                try
+                {
+                    auto stream = Files::openBinaryInputFileStream(task.mPath);
+                    if (ESM::readFormat(*stream) == ESM::Format::Tes3)
+                    {
+                        stream->seekg(0);
+                        ESM::ESMReader reader;
+                        reader.setEncoder(encoder.has_value() ? &*encoder : nullptr);
+                        reader.setIndex(task.mIndex);
+                        reader.open(std::move(stream), task.mPath);
+                        result = mStore.decodeRecords(reader);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    // Loading the file in order will report the error
+                    Log(Debug::Verbose) << "Failed to decode content file " << task.mPath << ": " << e.what();
+                    result.clear();
+                }
+                task.mPromise.set_value(std::move(result));
+            }
+        }
+    };
 
     EsmLoader::EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder,
         std::vector<int>& esmVersions)
@@ -28,6 +159,14 @@ namespace MWWorld
     {
     }
 
+    EsmLoader::~EsmLoader() = default;
+
+    void EsmLoader::startDecoding(
+        std::vector<std::pair<int, std::filesystem::path>> files, std::size_t threadsNumber)
+    {
+        mDecoder = std::make_unique<Decoder>(mStore, mEncoder, std::move(files), threadsNumber);
+    }
+
     void EsmLoader::load(const std::filesystem::path& filepath, int& index, Loading::Listener* listener)
     {
 
@@ -54,7 +193,8 @@ namespace MWWorld
                   "Please run the launcher to fix this issue.");
 
                 mESMVersions[index] = reader->getVer();
-                mStore.load(*reader, listener, mDialogue);
+                mStore.load(*reader, listener, mDialogue,
+                    mDecoder != nullptr ? mDecoder->take(index) : DecodedRecords());
 
                 if (!mMasterFileFormat.has_value()
                     && (Misc::StringUtils::ciEndsWith(reader->getName().u8string(), u8".esm")
@@ -1,8 +1,11 @@
 #ifndef ESMLOADER_HPP
 #define ESMLOADER_HPP
 
+#include <filesystem>
 #include <map>
+#include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "contentloader.hpp"
@@ -28,11 +31,21 @@ namespace MWWorld
         explicit EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder,
             std::vector<int>& esmVersions);
 
+        ~EsmLoader();
+
         std::optional<int> getMasterFileFormat() const { return mMasterFileFormat; }
 
+        /// Start decoding records of the given content files on worker threads. Each file is identified by the
+        /// index later passed to load(), which applies the decoded records in the load order. Workers decode at
+        /// most threadsNumber + 1 files ahead of the loaded one to bound the memory used by decoded records.
+        void startDecoding(std::vector<std::pair<int, std::filesystem::path>> files, std::size_t threadsNumber);
+
         void load(const std::filesystem::path& filepath, int& index, Loading::Listener* listener) override;
 
     private:
+        class Decoder;
+
+        std::unique_ptr<Decoder> mDecoder;
         ESM::ReadersCache& mReaders;
         MWWorld::ESMStore& mStore;
         ToUTF8::Utf8Encoder* mEncoder;
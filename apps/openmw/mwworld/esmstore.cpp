@@ -22,6 +22,8 @@
 
 #include "../mwmechanics/spelllist.hpp"
 
+#include "refcountcache.hpp"
+
 namespace
 {
     struct Ref
@@ -298,7 +300,8 @@ namespace MWWorld
         return false;
     }
 
-    void ESMStore::load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue)
+    void ESMStore::load(
+        ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue, DecodedRecords decoded)
     {
         if (listener != nullptr)
             listener->setProgressRange(::EsmLoader::fileProgress);
@@ -309,10 +312,14 @@ namespace MWWorld
         getWritable<ESM::LandTexture>().resize(esm.getIndex() + 1);
 
         // Loop through all records
+        std::size_t recordIndex = 0;
         while (esm.hasMoreRecs())
         {
             ESM::NAME n = esm.getRecName();
             esm.getRecHeader();
+            std::unique_ptr<DecodedRecord> decodedRecord
+                = recordIndex < decoded.size() ? std::move(decoded[recordIndex]) : nullptr;
+            ++recordIndex;
             if (esm.getRecordFlags() & ESM::FLAG_Ignored)
             {
                 esm.skipRecord();
@@ -323,7 +330,18 @@ namespace MWWorld
             ESM::RecNameInts recName = static_cast<ESM::RecNameInts>(n.toInt());
             const auto& it = mStoreImp->mRecNameToStore.find(recName);
 
-            if (it == mStoreImp->mRecNameToStore.end())
+            if (decodedRecord != nullptr)
+            {
+                esm.skipRecord();
+                RecordId id = decodedRecord->apply();
+                if (id.mIsDeleted)
+                {
+                    it->second->eraseStatic(id.mId);
+                    continue;
+                }
+                dialogue = nullptr;
+            }
+            else if (it == mStoreImp->mRecNameToStore.end())
             {
                 if (recName == ESM::REC_INFO)
                 {
@@ -385,6 +403,24 @@ namespace MWWorld
         }
     }
 
+    DecodedRecords ESMStore::decodeRecords(ESM::ESMReader& esm)
+    {
+        DecodedRecords result;
+        while (esm.hasMoreRecs())
+        {
+            const ESM::NAME n = esm.getRecName();
+            esm.getRecHeader();
+            const auto it = mStoreImp->mRecNameToStore.find(static_cast<ESM::RecNameInts>(n.toInt()));
+            std::unique_ptr<DecodedRecord> record;
+            if (!(esm.getRecordFlags() & ESM::FLAG_Ignored) && it != mStoreImp->mRecNameToStore.end())
+                record = it->second->decode(esm);
+            if (record == nullptr)
+                esm.skipRecord();
+            result.push_back(std::move(record));
+        }
+        return result;
+    }
+
     void ESMStore::loadESM4(ESM4::Reader& reader)
     {
         auto visitorRec = [this](ESM4::Reader& reader) { return ESMStoreImp::readRecord(reader, *this); };
@@ -459,37 +495,42 @@ namespace MWWorld
         }
     }
 
-    void ESMStore::validateRecords(ESM::ReadersCache& readers)
+    void ESMStore::validateRecords(ESM::ReadersCache& readers, const RefCountCache* refCountCache)
     {
         validate();
-        countAllCellRefsAndMarkKeys(readers);
+        countAllCellRefsAndMarkKeys(readers, refCountCache);
     }
 
-    void ESMStore::countAllCellRefsAndMarkKeys(ESM::ReadersCache& readers)
+    void ESMStore::countAllCellRefsAndMarkKeys(ESM::ReadersCache& readers, const RefCountCache* refCountCache)
     {
-        // TODO: We currently need to read entire files here again.
+        // TODO: We currently need to read entire files here again when there is no valid cache.
         // We should consider consolidating or deferring this reading.
         if (!mRefCount.empty())
             return;
-        std::vector<Ref> refs;
         std::set<ESM::RefId> keyIDs;
-        std::vector<ESM::RefId> refIDs;
-        Store<ESM::Cell> Cells = get<ESM::Cell>();
-        for (auto it = Cells.intBegin(); it != Cells.intEnd(); ++it)
-            readRefs(*it, refs, refIDs, keyIDs, readers);
-        for (auto it = Cells.extBegin(); it != Cells.extEnd(); ++it)
-            readRefs(*it, refs, refIDs, keyIDs, readers);
-        const auto lessByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum < r.mRefNum; };
-        std::stable_sort(refs.begin(), refs.end(), lessByRefNum);
-        const auto equalByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum == r.mRefNum; };
-        const auto incrementRefCount = [&](const Ref& value) {
-            if (value.mRefID != deletedRefID)
-            {
-                ESM::RefId& refId = refIDs[value.mRefID];
-                ++mRefCount[std::move(refId)];
-            }
-        };
-        Misc::forEachUnique(refs.rbegin(), refs.rend(), equalByRefNum, incrementRefCount);
+        if (refCountCache == nullptr || !refCountCache->read(mRefCount, keyIDs))
+        {
+            std::vector<Ref> refs;
+            std::vector<ESM::RefId> refIDs;
+            Store<ESM::Cell> Cells = get<ESM::Cell>();
+            for (auto it = Cells.intBegin(); it != Cells.intEnd(); ++it)
+                readRefs(*it, refs, refIDs, keyIDs, readers);
+            for (auto it = Cells.extBegin(); it != Cells.extEnd(); ++it)
+                readRefs(*it, refs, refIDs, keyIDs, readers);
+            const auto lessByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum < r.mRefNum; };
+            std::stable_sort(refs.begin(), refs.end(), lessByRefNum);
+            const auto equalByRefNum = [](const Ref& l, const Ref& r) { return l.mRefNum == r.mRefNum; };
+            const auto incrementRefCount = [&](const Ref& value) {
+                if (value.mRefID != deletedRefID)
+                {
+                    ESM::RefId& refId = refIDs[value.mRefID];
+                    ++mRefCount[std::move(refId)];
+                }
+            };
+            Misc::forEachUnique(refs.rbegin(), refs.rend(), equalByRefNum, incrementRefCount);
+            if (refCountCache != nullptr)
+                refCountCache->write(mRefCount, keyIDs);
+        }
         auto& store = getWritable<ESM::Miscellaneous>().mStatic;
         for (const auto& id : keyIDs)
         {
@@ -97,6 +97,7 @@ namespace ESM
 
 namespace MWWorld
 {
+    class RefCountCache;
     struct ESMStoreImp;
 
     class ESMStore
@@ -154,7 +155,7 @@ namespace MWWorld
         /// Validate entries in store after setup
         void validate();
 
-        void countAllCellRefsAndMarkKeys(ESM::ReadersCache& readers);
+        void countAllCellRefsAndMarkKeys(ESM::ReadersCache& readers, const RefCountCache* refCountCache);
 
         template <class T>
         void removeMissingObjects(Store<T>& store);
@@ -194,7 +195,14 @@ namespace MWWorld
         /// Validate entries in store after loading a save
         void validateDynamic();
 
-        void load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue);
+        /// Load all records from the reader. Records already decoded by decodeRecords() for the same file are
+        /// taken from @p decoded instead.
+        void load(ESM::ESMReader& esm, Loading::Listener* listener, ESM::Dialogue*& dialogue,
+            DecodedRecords decoded = {});
+
+        /// Decode records of the file opened by the reader that don't depend on the state of the store.
+        /// @note Thread safe, doesn't modify the store and may be called concurrently with load() for another file.
+        DecodedRecords decodeRecords(ESM::ESMReader& esm);
         void loadESM4(ESM4::Reader& esm);
 
         template <class T>
@@ -257,7 +265,9 @@ namespace MWWorld
         // This method must be called once, after loading all master/plugin files. This can only be done
         //  from the outside, so it must be public.
         void setUp();
-        void validateRecords(ESM::ReadersCache& readers);
+        /// @param refCountCache used to avoid reading references of all cells again when it was written for the same
+        /// content files.
+        void validateRecords(ESM::ReadersCache& readers, const RefCountCache* refCountCache = nullptr);
 
         int countSavedGameRecords() const;
 
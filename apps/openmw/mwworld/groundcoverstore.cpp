@@ -1,10 +1,14 @@
 #include "groundcoverstore.hpp"
 
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/cellref.hpp>
 #include <components/esm3/loadcell.hpp>
 #include <components/esm3/loadstat.hpp>
 #include <components/esm3/readerscache.hpp>
 #include <components/esmloader/esmdata.hpp>
 #include <components/esmloader/load.hpp>
+#include <components/groundcoverdb/cellrefs.hpp>
+#include <components/groundcoverdb/database.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/strings/lower.hpp>
 #include <components/resource/resourcesystem.hpp>
@@ -15,12 +19,49 @@
 
 namespace MWWorld
 {
+    namespace
+    {
+        std::unique_ptr<const GroundcoverDb::Database> openDatabase(const std::filesystem::path& path,
+            const Files::Collections& fileCollections, const std::vector<std::string>& groundcoverFiles)
+        {
+            if (!std::filesystem::exists(path))
+                return nullptr;
+
+            try
+            {
+                auto database = std::make_unique<const GroundcoverDb::Database>(path);
+                if (!database->matches(GroundcoverDb::getContentFiles(fileCollections, groundcoverFiles)))
+                {
+                    Log(Debug::Warning) << "Groundcover database " << path
+                                        << " is built for different groundcover files and will not be used, run "
+                                           "openmw-groundcovertool to update it";
+                    return nullptr;
+                }
+                Log(Debug::Info) << "Using groundcover database " << path << " with " << database->getCellsCount()
+                                 << " cells";
+                return database;
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Failed to open groundcover database " << path << ": " << e.what();
+                return nullptr;
+            }
+        }
+    }
+
+    GroundcoverStore::GroundcoverStore() = default;
+
+    GroundcoverStore::~GroundcoverStore() = default;
+
     void GroundcoverStore::init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
-        const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
+        const std::vector<std::string>& groundcoverFiles, const std::filesystem::path& databasePath,
+        ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener)
     {
+        mDatabase = openDatabase(databasePath, fileCollections, groundcoverFiles);
+
         ::EsmLoader::Query query;
         query.mLoadStatics = true;
-        query.mLoadCells = true;
+        query.mLoadCells = mDatabase == nullptr;
 
         ESM::ReadersCache readers;
         const ::EsmLoader::EsmData content
@@ -47,6 +88,13 @@ namespace MWWorld
             mMeshCache[stat.mId] = Misc::ResourceHelpers::correctMeshPath(model, vfs);
         }
 
+        if (mDatabase != nullptr)
+        {
+            mDatabaseModels.reserve(mDatabase->getIds().size());
+            for (const ESM::RefId& id : mDatabase->getIds())
+                mDatabaseModels.push_back(getGroundcoverModel(id));
+        }
+
         for (const ESM::Cell& cell : content.mCells)
         {
             if (!cell.isExterior())
@@ -56,21 +104,37 @@ namespace MWWorld
         }
     }
 
-    std::string GroundcoverStore::getGroundcoverModel(const ESM::RefId& id) const
+    std::string_view GroundcoverStore::getGroundcoverModel(const ESM::RefId& id) const
     {
         auto search = mMeshCache.find(id);
         if (search == mMeshCache.end())
-            return std::string();
+            return {};
 
         return search->second;
     }
 
-    void GroundcoverStore::initCell(ESM::Cell& cell, int cellX, int cellY) const
+    void GroundcoverStore::getInstances(
+        int cellX, int cellY, ESM::ReadersCache& readers, std::vector<GroundcoverInstance>& instances) const
     {
-        cell.blank();
+        if (mDatabase != nullptr)
+        {
+            for (const GroundcoverDb::Instance& instance : mDatabase->getInstances(cellX, cellY))
+            {
+                if (instance.mId < mDatabaseModels.size())
+                    instances.push_back(
+                        GroundcoverInstance{ mDatabaseModels[instance.mId], instance.mPosition, instance.mScale });
+            }
+            return;
+        }
 
         auto searchCell = mCellContexts.find(std::make_pair(cellX, cellY));
-        if (searchCell != mCellContexts.end())
-            cell.mContextList = searchCell->second;
+        if (searchCell == mCellContexts.end())
+            return;
+
+        ESM::Cell cell;
+        cell.blank();
+        cell.mContextList = searchCell->second;
+        for (const ESM::CellRef& ref : GroundcoverDb::readCellRefs(cell, readers))
+            instances.push_back(GroundcoverInstance{ getGroundcoverModel(ref.mRefID), ref.mPos, ref.mScale });
     }
 }
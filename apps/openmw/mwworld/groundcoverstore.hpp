@@ -1,16 +1,26 @@
 #ifndef GAME_MWWORLD_GROUNDCOVER_STORE_H
 #define GAME_MWWORLD_GROUNDCOVER_STORE_H
 
+#include <components/esm/defs.hpp>
 #include <components/esm/refid.hpp>
+
+#include <filesystem>
 #include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace ESM
 {
     struct ESM_Context;
     struct Static;
-    struct Cell;
+    class ReadersCache;
+}
+
+namespace GroundcoverDb
+{
+    class Database;
 }
 
 namespace Loading
@@ -33,19 +43,38 @@ namespace MWWorld
     template <class T>
     class Store;
 
+    struct GroundcoverInstance
+    {
+        std::string_view mModel;
+        ESM::Position mPos;
+        float mScale;
+    };
+
     class GroundcoverStore
     {
     private:
         std::map<ESM::RefId, std::string> mMeshCache;
         std::map<std::pair<int, int>, std::vector<ESM::ESM_Context>> mCellContexts;
+        std::unique_ptr<const GroundcoverDb::Database> mDatabase;
+        std::vector<std::string_view> mDatabaseModels;
 
     public:
+        GroundcoverStore();
+
+        ~GroundcoverStore();
+
+        /// Uses instances baked by the groundcover tool into databasePath when they were built for the same
+        /// groundcover files. Otherwise references are read from the content files on each request.
         void init(const Store<ESM::Static>& statics, const Files::Collections& fileCollections,
-            const std::vector<std::string>& groundcoverFiles, ToUTF8::Utf8Encoder* encoder,
-            Loading::Listener* listener);
+            const std::vector<std::string>& groundcoverFiles, const std::filesystem::path& databasePath,
+            ToUTF8::Utf8Encoder* encoder, Loading::Listener* listener);
+
+        std::string_view getGroundcoverModel(const ESM::RefId& id) const;
 
-        std::string getGroundcoverModel(const ESM::RefId& id) const;
-        void initCell(ESM::Cell& cell, int cellX, int cellY) const;
+        /// Appends instances of the exterior cell ordered by RefNum. Instance model is empty when referenced object
+        /// is not a groundcover.
+        void getInstances(
+            int cellX, int cellY, ESM::ReadersCache& readers, std::vector<GroundcoverInstance>& instances) const;
     };
 }
 
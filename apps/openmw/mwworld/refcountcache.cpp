@@ -0,0 +1,130 @@
+#include "refcountcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+
+namespace MWWorld
+{
+    namespace
+    {
+        constexpr ESM::NAME sHeaderRecord = "RCHD";
+        constexpr ESM::NAME sRefCountRecord = "RCNT";
+        constexpr ESM::NAME sKeysRecord = "RKEY";
+
+        // Increment when the way references are counted changes
+        constexpr std::uint32_t sVersion = 1;
+    }
+
+    RefCountCache::RefCountCache(std::filesystem::path path, ContentFilesFingerprint contentFiles)
+        : mPath(std::move(path))
+        , mContentFiles(std::move(contentFiles))
+    {
+    }
+
+    bool RefCountCache::read(std::unordered_map<ESM::RefId, int>& refCount, std::set<ESM::RefId>& keyIds) const
+    {
+        if (!std::filesystem::exists(mPath))
+            return false;
+
+        try
+        {
+            ESM::ESMReader reader;
+            reader.open(mPath);
+
+            if (!reader.hasMoreRecs() || reader.getRecName() != sHeaderRecord)
+                return false;
+            reader.getRecHeader();
+            std::uint32_t version = 0;
+            reader.getHNT(version, "VERS");
+            if (version != sVersion || !mContentFiles.matches(reader))
+                return false;
+
+            std::unordered_map<ESM::RefId, int> cachedRefCount;
+            std::set<ESM::RefId> cachedKeyIds;
+            while (reader.hasMoreRecs())
+            {
+                const ESM::NAME name = reader.getRecName();
+                reader.getRecHeader();
+                if (name == sRefCountRecord)
+                {
+                    while (reader.hasMoreSubs())
+                    {
+                        ESM::RefId id = reader.getHNRefId("NAME");
+                        std::int32_t count = 0;
+                        reader.getHNT(count, "INTV");
+                        cachedRefCount.emplace(std::move(id), count);
+                    }
+                }
+                else if (name == sKeysRecord)
+                {
+                    while (reader.hasMoreSubs())
+                        cachedKeyIds.insert(reader.getHNRefId("NAME"));
+                }
+                else
+                    reader.skipRecord();
+            }
+
+            refCount = std::move(cachedRefCount);
+            keyIds = std::move(cachedKeyIds);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read references count cache " << mPath << ": " << e.what();
+            return false;
+        }
+    }
+
+    void RefCountCache::write(
+        const std::unordered_map<ESM::RefId, int>& refCount, const std::set<ESM::RefId>& keyIds) const
+    {
+        std::filesystem::path tmpPath = mPath;
+        tmpPath += ".tmp";
+
+        try
+        {
+            {
+                std::ofstream stream(tmpPath, std::ios::binary);
+                stream.exceptions(std::ios::failbit | std::ios::badbit);
+
+                ESM::ESMWriter writer;
+                writer.setFormatVersion(ESM::CurrentSaveGameFormatVersion);
+                writer.save(stream);
+
+                writer.startRecord(sHeaderRecord);
+                writer.writeHNT("VERS", sVersion);
+                mContentFiles.save(writer);
+                writer.endRecord(sHeaderRecord);
+
+                writer.startRecord(sRefCountRecord);
+                for (const auto& [id, count] : refCount)
+                {
+                    writer.writeHNRefId("NAME", id);
+                    writer.writeHNT("INTV", static_cast<std::int32_t>(count));
+                }
+                writer.endRecord(sRefCountRecord);
+
+                writer.startRecord(sKeysRecord);
+                for (const ESM::RefId& id : keyIds)
+                    writer.writeHNRefId("NAME", id);
+                writer.endRecord(sKeysRecord);
+
+                writer.close();
+            }
+
+            std::filesystem::rename(tmpPath, mPath);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to write references count cache " << mPath << ": " << e.what();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+        }
+    }
+}
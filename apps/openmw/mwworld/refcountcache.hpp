@@ -0,0 +1,32 @@
+#ifndef OPENMW_MWWORLD_REFCOUNTCACHE_H
+#define OPENMW_MWWORLD_REFCOUNTCACHE_H
+
+#include <components/esm/refid.hpp>
+
+#include <filesystem>
+#include <set>
+#include <unordered_map>
+
+#include "contentfilesfingerprint.hpp"
+
+namespace MWWorld
+{
+    /// Persistent storage for the results of counting references of all cells in the content files. Cached values are
+    /// used only when they were written for the same content files fingerprint.
+    class RefCountCache
+    {
+    public:
+        explicit RefCountCache(std::filesystem::path path, ContentFilesFingerprint contentFiles);
+
+        /// Returns false when there is no valid cache for the current content files.
+        bool read(std::unordered_map<ESM::RefId, int>& refCount, std::set<ESM::RefId>& keyIds) const;
+
+        void write(const std::unordered_map<ESM::RefId, int>& refCount, const std::set<ESM::RefId>& keyIds) const;
+
+    private:
+        std::filesystem::path mPath;
+        ContentFilesFingerprint mContentFiles;
+    };
+}
+
+#endif
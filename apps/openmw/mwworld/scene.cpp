@@ -849,7 +849,7 @@ namespace MWWorld
     Scene::~Scene()
     {
         for (const osg::ref_ptr<SceneUtil::WorkItem>& v : mWorkItems)
-            v->abort();
+            v->cancel();
 
         for (const osg::ref_ptr<SceneUtil::WorkItem>& v : mWorkItems)
             v->waitTillDone();
@@ -1070,7 +1070,7 @@ namespace MWWorld
         {
             osg::ref_ptr<PreloadMeshItem> item(
                 new PreloadMeshItem(mesh_, mRendering.getResourceSystem()->getSceneManager()));
-            mRendering.getWorkQueue()->addWorkItem(item);
+            mRendering.getWorkQueue()->addWorkItem(item, SceneUtil::WorkCategory::CellPreload);
             const auto isDone = [](const osg::ref_ptr<SceneUtil::WorkItem>& v) { return v->isDone(); };
             mWorkItems.erase(std::remove_if(mWorkItems.begin(), mWorkItems.end(), isDone), mWorkItems.end());
             mWorkItems.emplace_back(std::move(item));
@@ -207,6 +207,36 @@ namespace MWWorld
         }
         return ptr;
     }
+    template <class T, class Id>
+    struct TypedDynamicStore<T, Id>::Decoded final : DecodedRecord
+    {
+        TypedDynamicStore<T, Id>& mStore;
+        T mRecord;
+        bool mIsDeleted = false;
+
+        explicit Decoded(TypedDynamicStore<T, Id>& store)
+            : mStore(store)
+        {
+        }
+
+        RecordId apply() override { return mStore.loadStatic(std::move(mRecord), mIsDeleted); }
+    };
+
+    template <class T, class Id>
+    RecordId TypedDynamicStore<T, Id>::loadStatic(T&& record, bool isDeleted)
+    {
+        const Id id = record.mId;
+
+        std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(id, std::move(record));
+        if (inserted.second)
+            mShared.push_back(&inserted.first->second);
+
+        if constexpr (std::is_same_v<Id, ESM::RefId>)
+            return RecordId(id, isDeleted);
+        else
+            return RecordId();
+    }
+
     template <class T, class Id>
     RecordId TypedDynamicStore<T, Id>::load(ESM::ESMReader& esm)
     {
@@ -217,14 +247,22 @@ namespace MWWorld
             record.load(esm, isDeleted);
         }
 
-        std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(record.mId, record);
-        if (inserted.second)
-            mShared.push_back(&inserted.first->second);
+        return loadStatic(std::move(record), isDeleted);
+    }
 
-        if constexpr (std::is_same_v<Id, ESM::RefId>)
-            return RecordId(record.mId, isDeleted);
+    template <class T, class Id>
+    std::unique_ptr<DecodedRecord> TypedDynamicStore<T, Id>::decode(ESM::ESMReader& esm)
+    {
+        if constexpr (ESM::isESM4Rec(T::sRecordId))
+        {
+            return nullptr;
+        }
         else
-            return RecordId();
+        {
+            auto result = std::make_unique<Decoded>(*this);
+            result->mRecord.load(esm, result->mIsDeleted);
+            return result;
+        }
     }
 
     template <class T, class Id>
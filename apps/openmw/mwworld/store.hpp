@@ -57,6 +57,19 @@ namespace MWWorld
         RecordId(const ESM::RefId& id = {}, bool isDeleted = false);
     };
 
+    /// Record decoded from a content file but not yet added to the store that decoded it.
+    struct DecodedRecord
+    {
+        virtual ~DecodedRecord() = default;
+
+        /// Add the record to the store, same as DynamicStoreBase::load would do.
+        virtual RecordId apply() = 0;
+    };
+
+    /// Records of a content file in the file order. Null entries are records that can't be decoded independently
+    /// from the state of the stores and have to be loaded in order.
+    using DecodedRecords = std::vector<std::unique_ptr<DecodedRecord>>;
+
     class StoreBase
     {
     }; // Empty interface to be parent of all store types
@@ -77,6 +90,11 @@ namespace MWWorld
         virtual int getDynamicSize() const { return 0; }
         virtual RecordId load(ESM::ESMReader& esm) = 0;
 
+        /// Decode a record without adding it to the store. Returns nullptr when the record depends on the state of
+        /// the store and has to be loaded with load().
+        /// @note Thread safe, doesn't modify the store.
+        virtual std::unique_ptr<DecodedRecord> decode(ESM::ESMReader& esm) { return nullptr; }
+
         virtual bool eraseStatic(const Id& id) { return false; }
         virtual void clearDynamic() {}
 
@@ -205,6 +223,10 @@ namespace MWWorld
 
         friend class ESMStore;
 
+        struct Decoded;
+
+        RecordId loadStatic(T&& record, bool isDeleted);
+
     public:
         TypedDynamicStore();
         TypedDynamicStore(const TypedDynamicStore<T, Id>& orig);
@@ -247,6 +269,7 @@ namespace MWWorld
         bool erase(const T& item);
 
         RecordId load(ESM::ESMReader& esm) override;
+        std::unique_ptr<DecodedRecord> decode(ESM::ESMReader& esm) override;
         void write(ESM::ESMWriter& writer, Loading::Listener& progress) const override;
         RecordId read(ESM::ESMReader& reader, bool overrideOnly = false) override;
     };
@@ -1,6 +1,8 @@
 #include "worldimp.hpp"
 
+#include <algorithm>
 #include <charconv>
+#include <thread>
 #include <vector>
 
 #include <osg/ComputeBoundsVisitor>
@@ -52,6 +54,7 @@
 
 #include <components/files/conversion.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
+#include <components/settings/values.hpp>
 
 #include "../mwbase/environment.hpp"
 #include "../mwbase/luamanager.hpp"
@@ -89,11 +92,13 @@
 #include "actionteleport.hpp"
 #include "cellstore.hpp"
 #include "containerstore.hpp"
+#include "contentfilesfingerprint.hpp"
 #include "datetimemanager.hpp"
 #include "inventorystore.hpp"
 #include "manualref.hpp"
 #include "player.hpp"
 #include "projectilemanager.hpp"
+#include "refcountcache.hpp"
 #include "weather.hpp"
 
 #include "contentloader.hpp"
@@ -286,7 +291,9 @@ namespace MWWorld
         fillGlobalVariables();
 
         mStore.setUp();
-        mStore.validateRecords(mReaders);
+        const RefCountCache refCountCache(mUserDataPath / "refcount.cache",
+            ContentFilesFingerprint(fileCollections, contentFiles, mReaders.getStatelessEncoder()));
+        mStore.validateRecords(mReaders, &refCountCache);
         mStore.movePlayerRecord();
 
         mSwimHeightScale = mStore.get<ESM::GameSetting>().find("fSwimHeightScale")->mValue.getFloat();
@@ -305,7 +312,7 @@ namespace MWWorld
         }
 
         mRendering = std::make_unique<MWRender::RenderingManager>(
-            viewer, rootNode, resourceSystem, workQueue, *mNavigator, mGroundcoverStore, unrefQueue);
+            viewer, rootNode, resourceSystem, workQueue, *mNavigator, mGroundcoverStore, unrefQueue, userDataPath);
         mProjectileManager = std::make_unique<ProjectileManager>(
             mRendering->getLightRoot()->asGroup(), resourceSystem, mRendering.get(), mPhysics.get());
         mRendering->preloadCommonAssets();
@@ -1229,6 +1236,7 @@ namespace MWWorld
         }
         if (haveToMove && newPtr.getRefData().getBaseNode())
         {
+            MWBase::Environment::get().getMechanicsManager()->updatePosition(newPtr);
             mRendering->moveObject(newPtr, position);
             if (movePhysics)
             {
@@ -2867,6 +2875,13 @@ namespace MWWorld
         OMWScriptsLoader omwScriptsLoader(mStore);
         gameContentLoader.addLoader(".omwscripts", omwScriptsLoader);
 
+        // Decode records of all content files in parallel, they are still added to the store in the load order
+        const int decodingThreads = Settings::general().mContentDecodingThreads;
+        if (decodingThreads != 0)
+            esmLoader.startDecoding(getContentFilePaths(fileCollections, content),
+                decodingThreads > 0 ? static_cast<std::size_t>(decodingThreads)
+                                    : std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1);
+
         int idx = 0;
         for (const std::string& file : content)
         {
@@ -2897,7 +2912,8 @@ namespace MWWorld
 
         Log(Debug::Info) << "Loading groundcover:";
 
-        mGroundcoverStore.init(mStore.get<ESM::Static>(), fileCollections, groundcoverFiles, encoder, listener);
+        mGroundcoverStore.init(mStore.get<ESM::Static>(), fileCollections, groundcoverFiles,
+            mUserDataPath / "groundcover.bin", encoder, listener);
     }
 
     MWWorld::SpellCastState World::startSpellCast(const Ptr& actor)
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 #include <optional>
 
 #include <components/debug/debuglog.hpp>
@@ -28,12 +29,38 @@ namespace MWWorld
     {
         template <class T>
         CellStore& emplaceCellStore(ESM::RefId id, const T& cell, ESMStore& store, ESM::ReadersCache& readers,
-            std::unordered_map<ESM::RefId, CellStore>& cells)
+            std::unordered_map<ESM::RefId, CellStore>& cells, std::vector<CellStore*>& unindexedCells)
         {
-            return cells
-                .emplace(std::piecewise_construct, std::forward_as_tuple(id),
-                    std::forward_as_tuple(Cell(cell), store, readers))
-                .first->second;
+            CellStore& cellStore = cells.try_emplace(id, Cell(cell), store, readers).first->second;
+            unindexedCells.push_back(&cellStore);
+            return cellStore;
+        }
+
+        // Search exteriors in reverse order, this is a workaround for an ambiguous chargen_plank reference in the
+        // vanilla game. There is one at -22,16 and one at -2,-9, the latter should be used.
+        bool isSearchedBefore(const CellStore* left, const CellStore* right)
+        {
+            const Cell& leftCell = *left->getCell();
+            const Cell& rightCell = *right->getCell();
+            if (leftCell.isExterior() != rightCell.isExterior())
+                return leftCell.isExterior();
+            if (leftCell.isExterior())
+            {
+                const ESM::ExteriorCellLocation leftLocation = leftCell.getExteriorCellLocation();
+                const ESM::ExteriorCellLocation rightLocation = rightCell.getExteriorCellLocation();
+                if (rightLocation < leftLocation)
+                    return true;
+                if (leftLocation < rightLocation)
+                    return false;
+            }
+            else
+            {
+                if (Misc::StringUtils::ciLess(leftCell.getNameId(), rightCell.getNameId()))
+                    return true;
+                if (Misc::StringUtils::ciLess(rightCell.getNameId(), leftCell.getNameId()))
+                    return false;
+            }
+            return std::less<>()(left, right);
         }
 
         const ESM::Cell* createEsmCell(ESM::ExteriorCellLocation location, ESMStore& store)
@@ -92,17 +119,9 @@ namespace MWWorld
     }
 }
 
-MWWorld::CellStore& MWWorld::WorldModel::getOrInsertCellStore(const ESM::Cell& cell)
-{
-    const auto it = mCells.find(cell.mId);
-    if (it != mCells.end())
-        return it->second;
-    return insertCellStore(cell);
-}
-
 MWWorld::CellStore& MWWorld::WorldModel::insertCellStore(const ESM::Cell& cell)
 {
-    CellStore& cellStore = emplaceCellStore(cell.mId, cell, mStore, mReaders, mCells);
+    CellStore& cellStore = emplaceCellStore(cell.mId, cell, mStore, mReaders, mCells, mUnindexedCells);
     if (cell.mData.mFlags & ESM::Cell::Interior)
         mInteriors.emplace(cell.mName, &cellStore);
     else
@@ -117,6 +136,10 @@ void MWWorld::WorldModel::clear()
     mInteriors.clear();
     mExteriors.clear();
     mCells.clear();
+    mRefIdIndex.clear();
+    mUnindexedCells.clear();
+    mListedStoreExteriors = 0;
+    mListedStoreInteriors = 0;
     std::fill(mIdCache.begin(), mIdCache.end(), std::make_pair(ESM::RefId(), (MWWorld::CellStore*)nullptr));
     mIdCacheIndex = 0;
 }
@@ -172,7 +195,7 @@ namespace MWWorld
         {
             auto [cell, created] = createExteriorCell(location, mStore);
             const ESM::RefId id = cell.getId();
-            cellStore = &emplaceCellStore(id, std::move(cell), mStore, mReaders, mCells);
+            cellStore = &emplaceCellStore(id, std::move(cell), mStore, mReaders, mCells, mUnindexedCells);
             mExteriors.emplace(location, cellStore);
             if (created)
                 MWBase::Environment::get().getLuaManager()->exteriorCreated(*cellStore);
@@ -197,9 +220,9 @@ namespace MWWorld
         if (it == mInteriors.end())
         {
             if (const ESM::Cell* cell = mStore.get<ESM::Cell>().search(name))
-                cellStore = &emplaceCellStore(cell->mId, *cell, mStore, mReaders, mCells);
+                cellStore = &emplaceCellStore(cell->mId, *cell, mStore, mReaders, mCells, mUnindexedCells);
             else if (const ESM4::Cell* cell4 = mStore.get<ESM4::Cell>().searchCellName(name))
-                cellStore = &emplaceCellStore(cell4->mId, *cell4, mStore, mReaders, mCells);
+                cellStore = &emplaceCellStore(cell4->mId, *cell4, mStore, mReaders, mCells, mUnindexedCells);
             else
                 return nullptr;
         }
@@ -238,7 +261,7 @@ namespace MWWorld
         if (!cell.has_value())
             return nullptr;
 
-        CellStore& cellStore = emplaceCellStore(id, std::move(*cell), mStore, mReaders, mCells);
+        CellStore& cellStore = emplaceCellStore(id, std::move(*cell), mStore, mReaders, mCells, mUnindexedCells);
 
         if (cellStore.isExterior())
             mExteriors.emplace(ESM::ExteriorCellLocation(cellStore.getCell()->getGridX(),
@@ -315,44 +338,22 @@ MWWorld::Ptr MWWorld::WorldModel::getPtr(const ESM::RefId& name)
             return ptr;
     }
 
-    // Then check cells that are already listed
-    // Search in reverse, this is a workaround for an ambiguous chargen_plank reference in the vanilla game.
-    // there is one at -22,16 and one at -2,-9, the latter should be used.
-    for (auto iter = mExteriors.rbegin(); iter != mExteriors.rend(); ++iter)
-    {
-        Ptr ptr = getPtrAndCache(name, *iter->second);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    for (auto iter = mInteriors.begin(); iter != mInteriors.end(); ++iter)
-    {
-        Ptr ptr = getPtrAndCache(name, *iter->second);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    // Now try the other cells
-    const MWWorld::Store<ESM::Cell>& cells = mStore.get<ESM::Cell>();
-
-    for (auto iter = cells.extBegin(); iter != cells.extEnd(); ++iter)
+    // Check the cells that are already listed first
+    indexListedCells();
+    const std::vector<CellStore*>& cells = getIndexedCells(name);
+    // Loading a cell may register new references, iterate by index
+    for (std::size_t i = 0; i < cells.size(); ++i)
     {
-        if (mCells.contains(iter->mId))
-            continue;
-
-        Ptr ptr = getPtrAndCache(name, insertCellStore(*iter));
-
+        Ptr ptr = getPtrAndCache(name, *cells[i]);
         if (!ptr.isEmpty())
             return ptr;
     }
 
-    for (auto iter = cells.intBegin(); iter != cells.intEnd(); ++iter)
+    // Now list and index the other cells one by one until the reference is found
+    while (CellStore* cellStore = listNextStoreCell(false))
     {
-        if (mCells.contains(iter->mId))
-            continue;
-
-        Ptr ptr = getPtrAndCache(name, insertCellStore(*iter));
-
+        indexListedCells();
+        Ptr ptr = getPtrAndCache(name, *cellStore);
         if (!ptr.isEmpty())
             return ptr;
     }
@@ -363,10 +364,15 @@ MWWorld::Ptr MWWorld::WorldModel::getPtr(const ESM::RefId& name)
 
 void MWWorld::WorldModel::getExteriorPtrs(const ESM::RefId& name, std::vector<MWWorld::Ptr>& out)
 {
-    const MWWorld::Store<ESM::Cell>& cells = mStore.get<ESM::Cell>();
-    for (MWWorld::Store<ESM::Cell>::iterator iter = cells.extBegin(); iter != cells.extEnd(); ++iter)
+    while (listNextStoreCell(true) != nullptr)
+        ;
+    indexListedCells();
+    const std::vector<CellStore*>& cells = getIndexedCells(name);
+    for (std::size_t i = 0; i < cells.size(); ++i)
     {
-        CellStore& cellStore = getOrInsertCellStore(*iter);
+        CellStore& cellStore = *cells[i];
+        if (!cellStore.isExterior() || cellStore.getCell()->getWorldSpace() != ESM::Cell::sDefaultWorldspaceId)
+            continue;
 
         Ptr ptr = getPtrAndCache(name, cellStore);
 
@@ -378,16 +384,14 @@ void MWWorld::WorldModel::getExteriorPtrs(const ESM::RefId& name, std::vector<MW
 std::vector<MWWorld::Ptr> MWWorld::WorldModel::getAll(const ESM::RefId& id)
 {
     std::vector<Ptr> result;
-    for (auto& [cellId, cellStore] : mCells)
+    indexListedCells();
+    const std::vector<CellStore*>& cells = getIndexedCells(id);
+    for (std::size_t i = 0; i < cells.size(); ++i)
     {
-        if (cellStore.getState() == CellStore::State_Unloaded)
-            cellStore.preload();
-        if (cellStore.getState() == CellStore::State_Preloaded)
-        {
-            if (!cellStore.hasId(id))
-                continue;
-            cellStore.load();
-        }
+        CellStore& cellStore = *cells[i];
+        if (cellStore.getState() == CellStore::State_Preloaded && !cellStore.hasId(id))
+            continue;
+        cellStore.load();
         cellStore.forEach([&](const Ptr& ptr) {
             if (ptr.getCellRef().getRefId() == id)
                 result.push_back(ptr);
@@ -397,6 +401,78 @@ std::vector<MWWorld::Ptr> MWWorld::WorldModel::getAll(const ESM::RefId& id)
     return result;
 }
 
+void MWWorld::WorldModel::registerPtr(const Ptr& ptr)
+{
+    mPtrRegistry.insert(ptr);
+    if (ptr.isInCell())
+        addToRefIdIndex(ptr.getCellRef().getRefId(), *ptr.getCell());
+}
+
+void MWWorld::WorldModel::addToRefIdIndex(const ESM::RefId& id, CellStore& cellStore)
+{
+    std::vector<CellStore*>& cells = mRefIdIndex[id];
+    const auto it = std::lower_bound(cells.begin(), cells.end(), &cellStore, isSearchedBefore);
+    if (it == cells.end() || *it != &cellStore)
+        cells.insert(it, &cellStore);
+}
+
+void MWWorld::WorldModel::indexListedCells()
+{
+    // Only references from content files need to be listed here, the ones added or moved at runtime are added by
+    // registerPtr
+    while (!mUnindexedCells.empty())
+    {
+        CellStore& cellStore = *mUnindexedCells.back();
+        mUnindexedCells.pop_back();
+
+        if (cellStore.getState() == CellStore::State_Unloaded)
+            cellStore.preload();
+
+        if (cellStore.getState() == CellStore::State_Preloaded)
+        {
+            const std::vector<ESM::RefId>& ids = cellStore.getPreloadedIds();
+            for (auto it = ids.begin(); it != ids.end(); it = std::upper_bound(it, ids.end(), *it))
+                addToRefIdIndex(*it, cellStore);
+        }
+        else
+        {
+            cellStore.forEachConst([&](const ConstPtr& ptr) {
+                addToRefIdIndex(ptr.getCellRef().getRefId(), cellStore);
+                return true;
+            });
+        }
+    }
+}
+
+MWWorld::CellStore* MWWorld::WorldModel::listNextStoreCell(bool exteriorsOnly)
+{
+    const MWWorld::Store<ESM::Cell>& cells = mStore.get<ESM::Cell>();
+    while (mListedStoreExteriors < cells.getExtSize())
+    {
+        const ESM::Cell& cell = *cells.at(cells.getIntSize() + mListedStoreExteriors++);
+        if (!mCells.contains(cell.mId))
+            return &insertCellStore(cell);
+    }
+    if (exteriorsOnly)
+        return nullptr;
+    while (mListedStoreInteriors < cells.getIntSize())
+    {
+        const ESM::Cell& cell = *cells.at(mListedStoreInteriors++);
+        if (!mCells.contains(cell.mId))
+            return &insertCellStore(cell);
+    }
+    return nullptr;
+}
+
+const std::vector<MWWorld::CellStore*>& MWWorld::WorldModel::getIndexedCells(const ESM::RefId& id) const
+{
+    static const std::vector<CellStore*> empty;
+    const auto it = mRefIdIndex.find(id);
+    if (it == mRefIdIndex.end())
+        return empty;
+    return it->second;
+}
+
 int MWWorld::WorldModel::countSavedGameRecords() const
 {
     return std::count_if(mCells.begin(), mCells.end(), [](const auto& v) { return v.second.hasState(); });
@@ -6,6 +6,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <components/esm/util.hpp>
 #include <components/misc/algorithm.hpp>
@@ -73,7 +74,7 @@ namespace MWWorld
 
         std::size_t getPtrRegistryRevision() const { return mPtrRegistry.getRevision(); }
 
-        void registerPtr(const Ptr& ptr) { mPtrRegistry.insert(ptr); }
+        void registerPtr(const Ptr& ptr);
 
         void deregisterPtr(const Ptr& ptr) { mPtrRegistry.remove(ptr); }
 
@@ -106,13 +107,31 @@ namespace MWWorld
         std::vector<std::pair<ESM::RefId, CellStore*>> mIdCache;
         std::size_t mIdCacheIndex = 0;
         PtrRegistry mPtrRegistry;
-
-        CellStore& getOrInsertCellStore(const ESM::Cell& cell);
+        // Listed cells possibly containing a reference with the given id, in the order getPtr should check them.
+        // Cells are not removed when the reference is deleted or moved away, so every candidate has to be checked.
+        // Such stale entries are dropped only by clear(), there is at most one per cell for each id that has ever
+        // been placed in that cell.
+        std::unordered_map<ESM::RefId, std::vector<CellStore*>> mRefIdIndex;
+        // Cells created after the last index update
+        mutable std::vector<CellStore*> mUnindexedCells;
+        // Number of ESM::Cell store exteriors and interiors checked for being listed
+        std::size_t mListedStoreExteriors = 0;
+        std::size_t mListedStoreInteriors = 0;
 
         CellStore& insertCellStore(const ESM::Cell& cell);
 
         Ptr getPtrAndCache(const ESM::RefId& name, CellStore& cellStore);
 
+        void addToRefIdIndex(const ESM::RefId& id, CellStore& cellStore);
+
+        // Adds references of all listed cells to the index
+        void indexListedCells();
+
+        // Lists the next cell from ESM::Cell store, exteriors first. Returns nullptr when all of them are listed.
+        CellStore* listNextStoreCell(bool exteriorsOnly);
+
+        const std::vector<CellStore*>& getIndexedCells(const ESM::RefId& id) const;
+
         void writeCell(ESM::ESMWriter& writer, CellStore& cell) const;
     };
 }
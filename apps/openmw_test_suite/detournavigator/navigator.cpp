@@ -20,6 +20,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <condition_variable>
 #include <deque>
@@ -27,6 +28,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 MATCHER_P3(Vec3fEq, x, y, z, "")
 {
@@ -202,6 +204,95 @@ namespace
             << mPath;
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, update_then_find_paths_async_should_return_same_paths_as_find_path)
+    {
+        constexpr std::array<float, 5 * 5> heightfieldData{ {
+            0, 0, 0, 0, 0, // row 0
+            0, -25, -25, -25, -25, // row 1
+            0, -25, -100, -100, -100, // row 2
+            0, -25, -100, -100, -100, // row 3
+            0, -25, -100, -100, -100, // row 4
+        } };
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(heightfieldData);
+        const int cellSize = mHeightfieldTileSize * (surface.mSize - 1);
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        auto updateGuard = mNavigator->makeUpdateGuard();
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface, updateGuard.get());
+        mNavigator->update(mPlayerPosition, updateGuard.get());
+        updateGuard.reset();
+        mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+
+        ASSERT_EQ(
+            findPath(*mNavigator, mAgentBounds, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+            Status::Success);
+
+        const AgentBounds otherAgentBounds{ CollisionShapeType::Cylinder, { 29, 29, 66 } };
+        const std::vector<PathRequest> requests{
+            PathRequest{ 1, mAgentBounds, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance },
+            PathRequest{ 2, mAgentBounds, mStepSize, mEnd, mStart, Flag_walk, mAreaCosts, mEndTolerance },
+            PathRequest{ 3, otherAgentBounds, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance },
+        };
+        mNavigator->findPathsAsync(requests);
+        static_cast<NavigatorImpl&>(*mNavigator).waitPathResults();
+
+        std::vector<PathResult> results;
+        mNavigator->takePathResults(results);
+        ASSERT_EQ(results.size(), 3);
+        std::sort(results.begin(), results.end(), [](const auto& l, const auto& r) { return l.mId < r.mId; });
+
+        EXPECT_EQ(results[0].mStatus, Status::Success);
+        EXPECT_THAT(results[0].mPath, ElementsAreArray(mPath));
+        EXPECT_EQ(results[1].mStatus, Status::Success);
+        EXPECT_FALSE(results[1].mPath.empty());
+        EXPECT_EQ(results[2].mStatus, Status::NavMeshNotFound);
+        EXPECT_THAT(results[2].mPath, IsEmpty());
+
+        results.clear();
+        mNavigator->takePathResults(results);
+        EXPECT_THAT(results, IsEmpty());
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, find_paths_async_without_threads_should_return_results_on_next_take)
+    {
+        mSettings.mAsyncPathFinderThreads = 0;
+        mNavigator.reset(new NavigatorImpl(
+            mSettings, std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max())));
+
+        constexpr std::array<float, 5 * 5> heightfieldData{ {
+            0, 0, 0, 0, 0, // row 0
+            0, -25, -25, -25, -25, // row 1
+            0, -25, -100, -100, -100, // row 2
+            0, -25, -100, -100, -100, // row 3
+            0, -25, -100, -100, -100, // row 4
+        } };
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(heightfieldData);
+        const int cellSize = mHeightfieldTileSize * (surface.mSize - 1);
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        auto updateGuard = mNavigator->makeUpdateGuard();
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface, updateGuard.get());
+        mNavigator->update(mPlayerPosition, updateGuard.get());
+        updateGuard.reset();
+        mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+
+        ASSERT_EQ(
+            findPath(*mNavigator, mAgentBounds, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+            Status::Success);
+
+        const std::vector<PathRequest> requests{
+            PathRequest{ 1, mAgentBounds, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance },
+        };
+        mNavigator->findPathsAsync(requests);
+
+        std::vector<PathResult> results;
+        mNavigator->takePathResults(results);
+        ASSERT_EQ(results.size(), 1);
+        EXPECT_EQ(results[0].mId, 1);
+        EXPECT_EQ(results[0].mStatus, Status::Success);
+        EXPECT_THAT(results[0].mPath, ElementsAreArray(mPath));
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, add_object_should_change_navmesh)
     {
         mSettings.mWaitUntilMinDistanceToPlayer = 0;
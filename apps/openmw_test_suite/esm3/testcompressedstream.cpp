@@ -0,0 +1,177 @@
+#include <components/esm/defs.hpp>
+#include <components/esm3/compressedstream.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ESM
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        struct Esm3CompressedStreamTest : Test
+        {
+            std::vector<std::string> mValues{ "first", std::string(10000, 'a'), "third" };
+
+            // Returns TES3 header and records with the values in plain form and the offset where the records start
+            std::pair<std::string, std::size_t> writeRecords(
+                FormatVersion formatVersion = CurrentSaveGameFormatVersion) const
+            {
+                std::stringstream stream;
+                ESMWriter writer;
+                writer.setFormatVersion(formatVersion);
+                writer.save(stream);
+                const std::size_t offset = static_cast<std::size_t>(stream.tellp());
+                for (const std::string& value : mValues)
+                {
+                    writer.startRecord(REC_GLOB);
+                    writer.writeHNString("NAME", value);
+                    writer.endRecord(REC_GLOB);
+                }
+                writer.close();
+                return { stream.str(), offset };
+            }
+
+            // Replaces records by a single compressed record the same way saved games are written
+            static std::string compress(const std::string& data, std::size_t offset, std::size_t chunkSize)
+            {
+                std::string compressed;
+                Lz4FrameCompressor compressor;
+                compressed += compressor.begin();
+                for (std::size_t position = offset; position < data.size(); position += chunkSize)
+                    compressed += compressor.update(std::string_view(data).substr(position, chunkSize));
+                compressed += compressor.end();
+
+                const std::uint64_t size = data.size() - offset;
+                const std::uint32_t recordHeader[4]
+                    = { REC_LZ4C, static_cast<std::uint32_t>(sizeof(size) + compressed.size()), 0, 0 };
+
+                std::string result = data.substr(0, offset);
+                result.append(reinterpret_cast<const char*>(recordHeader), sizeof(recordHeader));
+                result.append(reinterpret_cast<const char*>(&size), sizeof(size));
+                result += compressed;
+                return result;
+            }
+
+            static std::unique_ptr<std::istream> makeStream(const std::string& data)
+            {
+                return std::make_unique<std::istringstream>(data);
+            }
+        };
+
+        TEST_F(Esm3CompressedStreamTest, readerShouldReadPlainRecords)
+        {
+            const auto [data, offset] = writeRecords();
+            ESMReader reader;
+            reader.open(makeStream(data), "test");
+            std::vector<std::string> values;
+            while (reader.hasMoreRecs())
+            {
+                EXPECT_EQ(reader.getRecName(), REC_GLOB);
+                reader.getRecHeader();
+                values.push_back(reader.getHNString("NAME"));
+            }
+            EXPECT_EQ(values, mValues);
+        }
+
+        TEST_F(Esm3CompressedStreamTest, readerShouldReadCompressedRecords)
+        {
+            const auto [data, offset] = writeRecords();
+            ESMReader reader;
+            reader.open(makeStream(compress(data, offset, 1000)), "test");
+            std::vector<std::string> values;
+            while (reader.hasMoreRecs())
+            {
+                EXPECT_EQ(reader.getRecName(), REC_GLOB);
+                reader.getRecHeader();
+                values.push_back(reader.getHNString("NAME"));
+            }
+            EXPECT_EQ(values, mValues);
+        }
+
+        TEST_F(Esm3CompressedStreamTest, readerShouldReportOffsetsOfUncompressedData)
+        {
+            const auto [data, offset] = writeRecords();
+            ESMReader reader;
+            reader.open(makeStream(compress(data, offset, data.size())), "test");
+            EXPECT_EQ(reader.getRecName(), REC_GLOB);
+            EXPECT_EQ(reader.getFileSize(), data.size());
+            EXPECT_EQ(reader.getFileOffset(), offset + 4);
+        }
+
+        TEST_F(Esm3CompressedStreamTest, readerShouldSkipCompressedRecords)
+        {
+            const auto [data, offset] = writeRecords();
+            ESMReader reader;
+            reader.open(makeStream(compress(data, offset, 4096)), "test");
+            std::size_t count = 0;
+            while (reader.hasMoreRecs())
+            {
+                reader.getRecName();
+                reader.getRecHeader();
+                if (count++ == 2)
+                    EXPECT_EQ(reader.getHNString("NAME"), mValues.back());
+                else
+                    reader.skipRecord();
+            }
+            EXPECT_EQ(count, mValues.size());
+        }
+
+        TEST_F(Esm3CompressedStreamTest, readerShouldThrowOnTruncatedCompressedData)
+        {
+            const auto [data, offset] = writeRecords();
+            const std::string compressed = compress(data, offset, data.size());
+            std::string truncated = compressed.substr(0, compressed.size() - 16);
+            // Keep the record size consistent with the file size
+            const std::uint32_t recordSize = static_cast<std::uint32_t>(truncated.size() - offset - 16);
+            truncated.replace(offset + 4, sizeof(recordSize), reinterpret_cast<const char*>(&recordSize),
+                sizeof(recordSize));
+            ESMReader reader;
+            reader.open(makeStream(truncated), "test");
+            EXPECT_THROW(
+                {
+                    while (reader.hasMoreRecs())
+                    {
+                        reader.getRecName();
+                        reader.getRecHeader();
+                        reader.skipRecord();
+                    }
+                },
+                std::runtime_error);
+        }
+
+        TEST_F(Esm3CompressedStreamTest, readerShouldThrowOnCompressedRecordsInOlderFormatVersion)
+        {
+            const auto [data, offset] = writeRecords(MaxUncompressedSaveGameFormatVersion);
+            ESMReader reader;
+            reader.open(makeStream(compress(data, offset, data.size())), "test");
+            EXPECT_THROW(reader.getRecName(), std::runtime_error);
+        }
+
+        TEST_F(Esm3CompressedStreamTest, inputStreamShouldNotSeekBackwards)
+        {
+            const std::string data(1000, 'x');
+            Lz4FrameCompressor compressor;
+            std::string compressed(compressor.begin());
+            compressed += compressor.update(data);
+            compressed += compressor.end();
+            const std::unique_ptr<std::istream> stream
+                = makeLz4InputStream(makeStream(compressed), compressed.size(), 100);
+            EXPECT_EQ(stream->tellg(), 100);
+            stream->seekg(600);
+            EXPECT_EQ(stream->tellg(), 600);
+            EXPECT_EQ(stream->get(), 'x');
+            stream->seekg(200);
+            EXPECT_TRUE(stream->fail());
+        }
+    }
+}
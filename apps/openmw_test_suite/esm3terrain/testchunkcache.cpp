@@ -0,0 +1,166 @@
+#include <components/esm3terrain/chunkcache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+    using namespace ESMTerrain;
+
+    struct ESMTerrainChunkCacheTest : Test
+    {
+        const ChunkKey mKey{ 1, 2 };
+        const ChunkKey mOtherKey{ 3, 4 };
+        osg::ref_ptr<osg::Vec3Array> mPositions = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec3Array> mNormals = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec4ubArray> mColours = new osg::Vec4ubArray;
+        osg::ref_ptr<osg::Vec3Array> mResultPositions = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec3Array> mResultNormals = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec4ubArray> mResultColours = new osg::Vec4ubArray;
+        std::filesystem::path mPath;
+
+        void SetUp() override
+        {
+            mPath = outputFilePath(std::string(UnitTest::GetInstance()->current_test_info()->name()) + ".bin");
+            std::filesystem::remove(mPath);
+
+            for (int i = 0; i < 9; ++i)
+            {
+                mPositions->push_back(osg::Vec3f(i, -i, i * 0.5f));
+                mNormals->push_back(osg::Vec3f(0, 0, 1));
+                mColours->push_back(osg::Vec4ub(i, 2 * i, 3 * i, 255));
+            }
+        }
+
+        bool get(const ChunkCache& cache, const ChunkKey& key)
+        {
+            return cache.get(key, *mResultPositions, *mResultNormals, *mResultColours);
+        }
+
+        void expectResultEqual()
+        {
+            EXPECT_EQ(mResultPositions->asVector(), mPositions->asVector());
+            EXPECT_EQ(mResultNormals->asVector(), mNormals->asVector());
+            EXPECT_EQ(mResultColours->asVector(), mColours->asVector());
+        }
+    };
+
+    TEST_F(ESMTerrainChunkCacheTest, getShouldReturnAddedChunk)
+    {
+        ChunkCache cache(mPath, 1024 * 1024);
+        EXPECT_FALSE(get(cache, mKey));
+        cache.add(mKey, *mPositions, *mNormals, *mColours);
+        ASSERT_TRUE(get(cache, mKey));
+        expectResultEqual();
+        EXPECT_FALSE(get(cache, mOtherKey));
+    }
+
+    TEST_F(ESMTerrainChunkCacheTest, getShouldReturnChunkSavedInPreviousSession)
+    {
+        {
+            ChunkCache cache(mPath, 1024 * 1024);
+            cache.add(mKey, *mPositions, *mNormals, *mColours);
+            cache.save();
+        }
+        const ChunkCache cache(mPath, 1024 * 1024);
+        EXPECT_EQ(cache.getMappedCount(), 1);
+        ASSERT_TRUE(get(cache, mKey));
+        expectResultEqual();
+        EXPECT_FALSE(get(cache, mOtherKey));
+    }
+
+    TEST_F(ESMTerrainChunkCacheTest, saveShouldKeepOldChunks)
+    {
+        {
+            ChunkCache cache(mPath, 1024 * 1024);
+            cache.add(mKey, *mPositions, *mNormals, *mColours);
+            cache.save();
+        }
+        {
+            ChunkCache cache(mPath, 1024 * 1024);
+            cache.add(mOtherKey, *mPositions, *mNormals, *mColours);
+            cache.save();
+        }
+        const ChunkCache cache(mPath, 1024 * 1024);
+        EXPECT_EQ(cache.getMappedCount(), 2);
+        EXPECT_TRUE(get(cache, mKey));
+        EXPECT_TRUE(get(cache, mOtherKey));
+    }
+
+    TEST_F(ESMTerrainChunkCacheTest, saveShouldPreferUsedChunksWhenSizeIsLimited)
+    {
+        // Header, one entry and 9 vertices of one chunk
+        const std::size_t maxSize = 24 + 32 + 9 * 28;
+        {
+            ChunkCache cache(mPath, 1024 * 1024);
+            cache.add(mKey, *mPositions, *mNormals, *mColours);
+            cache.add(mOtherKey, *mPositions, *mNormals, *mColours);
+            cache.save();
+        }
+        {
+            ChunkCache cache(mPath, maxSize);
+            EXPECT_TRUE(get(cache, mOtherKey));
+            cache.add(ChunkKey{ 5, 6 }, *mPositions, *mNormals, *mColours);
+            cache.save();
+        }
+        const ChunkCache cache(mPath, maxSize);
+        EXPECT_EQ(cache.getMappedCount(), 1);
+        EXPECT_FALSE(get(cache, mKey));
+        EXPECT_TRUE(get(cache, mOtherKey));
+        EXPECT_EQ(std::filesystem::file_size(mPath), maxSize);
+    }
+
+    TEST_F(ESMTerrainChunkCacheTest, addShouldIgnoreChunksNotFittingSizeLimit)
+    {
+        // Header, one entry and 9 vertices of one chunk
+        ChunkCache cache(mPath, 24 + 32 + 9 * 28);
+        cache.add(mKey, *mPositions, *mNormals, *mColours);
+        cache.add(mOtherKey, *mPositions, *mNormals, *mColours);
+        EXPECT_EQ(cache.getAddedCount(), 1);
+        EXPECT_TRUE(get(cache, mKey));
+        EXPECT_FALSE(get(cache, mOtherKey));
+    }
+
+    TEST_F(ESMTerrainChunkCacheTest, shouldIgnoreInvalidFile)
+    {
+        {
+            std::ofstream stream(mPath, std::ios::binary);
+            stream << "not a terrain chunk cache";
+        }
+        ChunkCache cache(mPath, 1024 * 1024);
+        EXPECT_EQ(cache.getMappedCount(), 0);
+        cache.add(mKey, *mPositions, *mNormals, *mColours);
+        cache.save();
+        EXPECT_EQ(ChunkCache(mPath, 1024 * 1024).getMappedCount(), 1);
+    }
+
+    TEST_F(ESMTerrainChunkCacheTest, addAfterSaveShouldBeIgnored)
+    {
+        ChunkCache cache(mPath, 1024 * 1024);
+        cache.save();
+        cache.add(mKey, *mPositions, *mNormals, *mColours);
+        EXPECT_EQ(cache.getAddedCount(), 0);
+        EXPECT_FALSE(get(cache, mKey));
+    }
+
+    TEST(ESMTerrainChunkKeyBuilderTest, keyShouldDependOnAllValues)
+    {
+        ChunkKeyBuilder first;
+        first.add(std::string_view("sys::default"));
+        const float values[] = { 1, 2 };
+        first.add(std::span<const float>(values));
+
+        ChunkKeyBuilder second;
+        second.add(std::string_view("sys::default"));
+        EXPECT_NE(first.getKey(), second.getKey());
+        second.add(std::span<const float>(values));
+        EXPECT_EQ(first.getKey(), second.getKey());
+    }
+}
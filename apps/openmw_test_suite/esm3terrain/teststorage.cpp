@@ -0,0 +1,387 @@
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/loadland.hpp>
+#include <components/esm3terrain/storage.hpp>
+#include <components/esm4/loadland.hpp>
+
+#include <gtest/gtest.h>
+
+#include <osg/Array>
+#include <osg/Vec2f>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace ESMTerrain;
+
+    constexpr int gridSize = 3;
+
+    template <class T, std::size_t size>
+    void generateValues(T (&values)[size], int min, int max, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<int> distribution(min, max);
+        for (T& value : values)
+            value = static_cast<T>(distribution(random));
+    }
+
+    void generateNormals(std::span<signed char> normals, std::minstd_rand& random)
+    {
+        std::uniform_int_distribution<int> horizontal(-40, 40);
+        std::uniform_int_distribution<int> vertical(60, 127);
+        for (std::size_t i = 0; i + 2 < normals.size(); i += 3)
+        {
+            normals[i] = static_cast<signed char>(horizontal(random));
+            normals[i + 1] = static_cast<signed char>(horizontal(random));
+            normals[i + 2] = static_cast<signed char>(vertical(random));
+        }
+    }
+
+    class TestStorage final : public Storage
+    {
+    public:
+        explicit TestStorage(ESM::RefId worldspace)
+            : Storage(nullptr)
+        {
+            constexpr int flags = ESM::Land::DATA_VHGT | ESM::Land::DATA_VNML | ESM::Land::DATA_VCLR;
+            std::minstd_rand random;
+            for (int x = 0; x < gridSize; ++x)
+            {
+                for (int y = 0; y < gridSize; ++y)
+                {
+                    osg::ref_ptr<const LandObject> land;
+                    if (ESM::isEsm4Ext(worldspace))
+                    {
+                        auto& record = *mEsm4Lands.emplace_back(std::make_unique<ESM4::Land>());
+                        record.mHeightMap.heightOffset = 0;
+                        generateValues(record.mHeightMap.gradientData, -8, 8, random);
+                        generateNormals(record.mVertNorm, random);
+                        generateValues(record.mVertColr, 0, 255, random);
+                        land = new LandObject(&record, flags);
+                    }
+                    else
+                    {
+                        auto& record = *mEsm3Lands.emplace_back(std::make_unique<ESM::Land>());
+                        record.blank();
+                        ESM::Land::LandData& data = *record.getLandData();
+                        generateValues(data.mHeights, -2000, 4000, random);
+                        generateNormals(data.mNormals, random);
+                        generateValues(data.mColours, 0, 255, random);
+                        land = new LandObject(&record, flags);
+                    }
+                    mLands.emplace(ESM::ExteriorCellLocation(x, y, worldspace), std::move(land));
+                }
+            }
+        }
+
+        osg::ref_ptr<const LandObject> getLand(ESM::ExteriorCellLocation cellLocation) override
+        {
+            const auto it = mLands.find(cellLocation);
+            if (it == mLands.end())
+                return nullptr;
+            return it->second;
+        }
+
+        const ESM::LandTexture* getLandTexture(int index, short plugin) override { return nullptr; }
+
+        void getBounds(float& minX, float& maxX, float& minY, float& maxY, ESM::RefId worldspace) override
+        {
+            minX = 0;
+            minY = 0;
+            maxX = gridSize;
+            maxY = gridSize;
+        }
+
+    private:
+        std::vector<std::unique_ptr<ESM::Land>> mEsm3Lands;
+        std::vector<std::unique_ptr<ESM4::Land>> mEsm4Lands;
+        std::map<ESM::ExteriorCellLocation, osg::ref_ptr<const LandObject>> mLands;
+    };
+
+    // Straightforward per vertex implementation of the terrain storage used as a reference for the optimized one.
+    // Saved chunks are reused across versions unless ChunkCache::sVersion changes, so the output has to stay the same.
+    class ReferenceStorage
+    {
+    public:
+        ReferenceStorage(TestStorage& storage, ESM::RefId worldspace)
+            : mStorage(storage)
+            , mWorldspace(worldspace)
+            , mLandSize(ESM::getLandSize(worldspace))
+        {
+        }
+
+        bool getMinMaxHeights(float size, const osg::Vec2f& center, float& min, float& max) const
+        {
+            const osg::Vec2f origin = center - osg::Vec2f(size / 2.f, size / 2.f);
+            const int cellX = static_cast<int>(std::floor(origin.x()));
+            const int cellY = static_cast<int>(std::floor(origin.y()));
+            const ESM::LandData* data = getData(cellX, cellY, ESM::Land::DATA_VHGT);
+            const int startRow = (origin.x() - cellX) * mLandSize;
+            const int startColumn = (origin.y() - cellY) * mLandSize;
+            const int endRow = startRow + size * (mLandSize - 1) + 1;
+            const int endColumn = startColumn + size * (mLandSize - 1) + 1;
+
+            if (data == nullptr)
+            {
+                min = ESM::Land::DEFAULT_HEIGHT;
+                max = ESM::Land::DEFAULT_HEIGHT;
+                return false;
+            }
+
+            min = std::numeric_limits<float>::max();
+            max = -std::numeric_limits<float>::max();
+            for (int row = startRow; row < endRow; ++row)
+            {
+                for (int col = startColumn; col < endColumn; ++col)
+                {
+                    const float height = data->getHeights()[col * mLandSize + row];
+                    min = std::min(min, height);
+                    max = std::max(max, height);
+                }
+            }
+            return true;
+        }
+
+        void fillVertexBuffers(int lodLevel, float size, const osg::Vec2f& center, std::vector<osg::Vec3f>& positions,
+            std::vector<osg::Vec3f>& normals, std::vector<osg::Vec4ub>& colours) const
+        {
+            const int increment = 1 << lodLevel;
+            const osg::Vec2f origin = center - osg::Vec2f(size / 2.f, size / 2.f);
+            const int startCellX = static_cast<int>(std::floor(origin.x()));
+            const int startCellY = static_cast<int>(std::floor(origin.y()));
+            const int cellSize = ESM::getCellSize(mWorldspace);
+            const std::size_t numVerts = static_cast<std::size_t>(size * (mLandSize - 1) / increment + 1);
+
+            positions.assign(numVerts * numVerts, osg::Vec3f());
+            normals.assign(numVerts * numVerts, osg::Vec3f());
+            colours.assign(numVerts * numVerts, osg::Vec4ub());
+
+            bool validHeightDataExists = false;
+            float vertY = 0;
+            float cellVertY = 0;
+            for (int cellY = startCellY; cellY < startCellY + std::ceil(size); ++cellY)
+            {
+                float vertX = 0;
+                float cellVertX = 0;
+                for (int cellX = startCellX; cellX < startCellX + std::ceil(size); ++cellX)
+                {
+                    const ESM::LandData* heightData = getData(cellX, cellY, ESM::Land::DATA_VHGT);
+                    if (mStorage.getLand(ESM::ExteriorCellLocation(cellX, cellY, mWorldspace)) != nullptr)
+                        validHeightDataExists = true;
+
+                    // Cells after the first one share the first row and column with the previous ones
+                    int rowStart = cellVertX != 0 ? increment : 0;
+                    int colStart = cellVertY != 0 ? increment : 0;
+                    rowStart += (origin.x() - startCellX) * mLandSize;
+                    colStart += (origin.y() - startCellY) * mLandSize;
+                    const int rowEnd = std::min(
+                        static_cast<int>(rowStart + std::min(1.f, size) * (mLandSize - 1) + 1), mLandSize);
+                    const int colEnd = std::min(
+                        static_cast<int>(colStart + std::min(1.f, size) * (mLandSize - 1) + 1), mLandSize);
+
+                    vertY = cellVertY;
+                    for (int col = colStart; col < colEnd; col += increment)
+                    {
+                        vertX = cellVertX;
+                        for (int row = rowStart; row < rowEnd; row += increment)
+                        {
+                            const std::size_t index = static_cast<std::size_t>(vertX * numVerts + vertY);
+
+                            float height = ESM::Land::DEFAULT_HEIGHT;
+                            if (heightData != nullptr)
+                                height = heightData->getHeights()[col * mLandSize + row];
+                            positions[index] = osg::Vec3f((vertX / float(numVerts - 1) - 0.5f) * size * cellSize,
+                                (vertY / float(numVerts - 1) - 0.5f) * size * cellSize, height);
+
+                            // Normals don't connect seamlessly between cells and some corner normals are garbage
+                            if ((row == 0 || row == mLandSize - 1) && (col == 0 || col == mLandSize - 1))
+                            {
+                                osg::Vec3f normal = getNormal(cellX, cellY, col + 1, row)
+                                    + getNormal(cellX, cellY, col - 1, row) + getNormal(cellX, cellY, col, row + 1)
+                                    + getNormal(cellX, cellY, col, row - 1);
+                                normal.normalize();
+                                normals[index] = normal;
+                            }
+                            else
+                                normals[index] = getNormal(cellX, cellY, col, row);
+
+                            // Colours of the last row and column are taken from the next cell
+                            int colourCellX = cellX;
+                            int colourCellY = cellY;
+                            int colourCol = col;
+                            int colourRow = row;
+                            if (colourCol == mLandSize - 1)
+                            {
+                                ++colourCellY;
+                                colourCol = 0;
+                            }
+                            if (colourRow == mLandSize - 1)
+                            {
+                                ++colourCellX;
+                                colourRow = 0;
+                            }
+                            colours[index] = getColour(colourCellX, colourCellY, colourCol, colourRow);
+
+                            ++vertX;
+                        }
+                        ++vertY;
+                    }
+                    cellVertX = vertX;
+                }
+                cellVertY = vertY;
+            }
+
+            if (!validHeightDataExists && ESM::isEsm4Ext(mWorldspace))
+                positions.assign(numVerts * numVerts, osg::Vec3f(0, 0, 0));
+        }
+
+    private:
+        TestStorage& mStorage;
+        ESM::RefId mWorldspace;
+        int mLandSize;
+
+        const ESM::LandData* getData(int cellX, int cellY, int flags) const
+        {
+            const osg::ref_ptr<const LandObject> land
+                = mStorage.getLand(ESM::ExteriorCellLocation(cellX, cellY, mWorldspace));
+            return land ? land->getData(flags) : nullptr;
+        }
+
+        // Takes the normal from the neighbour cell when col or row is out of the cell or on its last row or column
+        osg::Vec3f getNormal(int cellX, int cellY, int col, int row) const
+        {
+            while (col >= mLandSize - 1)
+            {
+                ++cellY;
+                col -= mLandSize - 1;
+            }
+            while (row >= mLandSize - 1)
+            {
+                ++cellX;
+                row -= mLandSize - 1;
+            }
+            while (col < 0)
+            {
+                --cellY;
+                col += mLandSize - 1;
+            }
+            while (row < 0)
+            {
+                --cellX;
+                row += mLandSize - 1;
+            }
+            const ESM::LandData* data = getData(cellX, cellY, ESM::Land::DATA_VNML);
+            if (data == nullptr)
+                return osg::Vec3f(0, 0, 1);
+            const int index = col * mLandSize * 3 + row * 3;
+            osg::Vec3f normal(data->getNormals()[index], data->getNormals()[index + 1], data->getNormals()[index + 2]);
+            normal.normalize();
+            return normal;
+        }
+
+        osg::Vec4ub getColour(int cellX, int cellY, int col, int row) const
+        {
+            const ESM::LandData* data = getData(cellX, cellY, ESM::Land::DATA_VCLR);
+            if (data == nullptr)
+                return osg::Vec4ub(255, 255, 255, 255);
+            const int index = col * mLandSize * 3 + row * 3;
+            const std::span<const unsigned char> colors = data->getColors();
+            return osg::Vec4ub(colors[index], colors[index + 1], colors[index + 2], 255);
+        }
+    };
+
+    void expectFloatEq(const osg::Vec3f& actual, const osg::Vec3f& expected)
+    {
+        EXPECT_FLOAT_EQ(actual.x(), expected.x());
+        EXPECT_FLOAT_EQ(actual.y(), expected.y());
+        EXPECT_FLOAT_EQ(actual.z(), expected.z());
+    }
+
+    struct ESMTerrainStorageTest : TestWithParam<bool>
+    {
+        const ESM::RefId mWorldspace
+            = GetParam() ? ESM::RefId::formIdRefId(ESM::FormId{ 0x3c, 0 }) : ESM::Cell::sDefaultWorldspaceId;
+        const int mLandSize = ESM::getLandSize(mWorldspace);
+        TestStorage mStorage{ mWorldspace };
+        const ReferenceStorage mReference{ mStorage, mWorldspace };
+    };
+
+    TEST_P(ESMTerrainStorageTest, fillVertexBuffersShouldMatchReference)
+    {
+        // Chunks are aligned to their size, covering the grid centre, its edges and the area out of it
+        const float sizes[] = { 0.125f, 0.25f, 0.5f, 1, 2, 4 };
+        const osg::Vec2f origins[] = { { 0, 0 }, { 1, 1 }, { 1.5f, 1.25f }, { 2, 0 }, { 2.75f, 2.75f }, { -1, -1 },
+            { 4, 4 } };
+        osg::ref_ptr<osg::Vec3Array> positions = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec3Array> normals = new osg::Vec3Array;
+        osg::ref_ptr<osg::Vec4ubArray> colours = new osg::Vec4ubArray;
+        std::vector<osg::Vec3f> expectedPositions;
+        std::vector<osg::Vec3f> expectedNormals;
+        std::vector<osg::Vec4ub> expectedColours;
+        for (int lod = 0; (1 << lod) < mLandSize; ++lod)
+        {
+            for (const float size : sizes)
+            {
+                if (size * (mLandSize - 1) < (1 << lod))
+                    continue;
+                for (const osg::Vec2f& origin : origins)
+                {
+                    const osg::Vec2f alignedOrigin(
+                        std::floor(origin.x() / size) * size, std::floor(origin.y() / size) * size);
+                    const osg::Vec2f center = alignedOrigin + osg::Vec2f(size / 2, size / 2);
+                    SCOPED_TRACE(::testing::Message() << "lod=" << lod << " size=" << size << " center=("
+                                                      << center.x() << ", " << center.y() << ")");
+
+                    mStorage.fillVertexBuffers(lod, size, center, mWorldspace, positions, normals, colours);
+                    mReference.fillVertexBuffers(
+                        lod, size, center, expectedPositions, expectedNormals, expectedColours);
+
+                    ASSERT_EQ(positions->size(), expectedPositions.size());
+                    ASSERT_EQ(normals->size(), expectedNormals.size());
+                    ASSERT_EQ(colours->size(), expectedColours.size());
+                    for (std::size_t i = 0; i < expectedPositions.size(); ++i)
+                    {
+                        SCOPED_TRACE(i);
+                        expectFloatEq((*positions)[i], expectedPositions[i]);
+                        expectFloatEq((*normals)[i], expectedNormals[i]);
+                        EXPECT_EQ((*colours)[i], expectedColours[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST_P(ESMTerrainStorageTest, getMinMaxHeightsShouldMatchReference)
+    {
+        for (const float size : { 0.125f, 0.25f, 0.5f, 1.f })
+        {
+            for (float y = -1; y < gridSize + 1; y += size)
+            {
+                for (float x = -1; x < gridSize + 1; x += size)
+                {
+                    const osg::Vec2f center(x + size / 2, y + size / 2);
+                    SCOPED_TRACE(::testing::Message()
+                        << "size=" << size << " center=(" << center.x() << ", " << center.y() << ")");
+
+                    float min = 0;
+                    float max = 0;
+                    float expectedMin = 0;
+                    float expectedMax = 0;
+                    EXPECT_EQ(mStorage.getMinMaxHeights(size, center, mWorldspace, min, max),
+                        mReference.getMinMaxHeights(size, center, expectedMin, expectedMax));
+                    EXPECT_EQ(min, expectedMin);
+                    EXPECT_EQ(max, expectedMax);
+                }
+            }
+        }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Esm3AndEsm4, ESMTerrainStorageTest, Values(false, true));
+}
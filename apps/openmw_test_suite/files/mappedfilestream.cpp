@@ -0,0 +1,72 @@
+#include <components/files/mappedfilestream.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+    using namespace Files;
+
+    struct FilesMappedFileStreamTest : Test
+    {
+        const std::string mContent = "0123456789abcdef";
+        std::filesystem::path mPath;
+
+        void SetUp() override
+        {
+            std::string fileName(UnitTest::GetInstance()->current_test_info()->name());
+            mPath = outputFilePath(fileName);
+            std::ofstream(mPath, std::ios_base::binary)
+                .write(mContent.data(), static_cast<std::streamsize>(mContent.size()));
+        }
+    };
+
+    TEST_F(FilesMappedFileStreamTest, shouldMapWholeFile)
+    {
+        const MappedFile file(mPath);
+        ASSERT_EQ(file.size(), mContent.size());
+        EXPECT_EQ(std::string(file.data(), file.size()), mContent);
+    }
+
+    TEST_F(FilesMappedFileStreamTest, shouldReadOnlyGivenRegion)
+    {
+        const auto stream = openMappedFileStream(std::make_shared<const MappedFile>(mPath), 4, 6);
+        const std::string result(std::istreambuf_iterator<char>(*stream), {});
+        EXPECT_EQ(result, "456789");
+    }
+
+    TEST_F(FilesMappedFileStreamTest, shouldSupportSeek)
+    {
+        const auto stream = openMappedFileStream(std::make_shared<const MappedFile>(mPath), 2, 10);
+        stream->seekg(0, std::ios_base::end);
+        EXPECT_EQ(stream->tellg(), 10);
+        stream->seekg(3);
+        char value = 0;
+        stream->read(&value, 1);
+        EXPECT_EQ(value, '5');
+    }
+
+    TEST_F(FilesMappedFileStreamTest, streamShouldKeepMappingAlive)
+    {
+        auto file = std::make_shared<const MappedFile>(mPath);
+        const auto stream = openMappedFileStream(file, 0, mContent.size());
+        file = nullptr;
+        const std::string result(std::istreambuf_iterator<char>(*stream), {});
+        EXPECT_EQ(result, mContent);
+    }
+
+    TEST_F(FilesMappedFileStreamTest, shouldThrowForRegionOutsideFile)
+    {
+        const auto file = std::make_shared<const MappedFile>(mPath);
+        EXPECT_THROW(openMappedFileStream(file, 10, 7), std::runtime_error);
+        EXPECT_THROW(openMappedFileStream(file, 17, 0), std::runtime_error);
+    }
+}
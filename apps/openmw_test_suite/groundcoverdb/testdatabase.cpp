@@ -0,0 +1,99 @@
+#include <components/groundcoverdb/database.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+    using namespace GroundcoverDb;
+
+    Instance makeTestInstance(float x, std::uint32_t id)
+    {
+        Instance result;
+        result.mPosition.pos[0] = x;
+        result.mPosition.rot[2] = 0.5f;
+        result.mScale = 2;
+        result.mId = id;
+        return result;
+    }
+
+    struct GroundcoverDbDatabaseTest : Test
+    {
+        const std::vector<ContentFile> mContentFiles{ { "Grass.esp", { 1, 2 } }, { "Flowers.esp", { 3, 4 } } };
+        const std::vector<ESM::RefId> mIds{ ESM::RefId::stringRefId("grass_01"), ESM::RefId::stringRefId("fern") };
+        std::filesystem::path mPath;
+
+        void SetUp() override
+        {
+            mPath = outputFilePath(std::string(UnitTest::GetInstance()->current_test_info()->name()) + ".bin");
+        }
+    };
+
+    TEST_F(GroundcoverDbDatabaseTest, shouldReadWrittenInstancesByCell)
+    {
+        const std::vector<CellInstances> cells{
+            { 3, -1, { makeTestInstance(1, 0), makeTestInstance(2, 1) } },
+            { -2, 5, { makeTestInstance(3, 1) } },
+            { 0, 0, {} },
+        };
+        writeDatabase(mPath, mContentFiles, mIds, cells);
+
+        const Database database(mPath);
+        EXPECT_TRUE(database.matches(mContentFiles));
+        EXPECT_EQ(database.getIds(), mIds);
+        EXPECT_EQ(database.getCellsCount(), 3);
+
+        const auto first = database.getInstances(3, -1);
+        ASSERT_EQ(first.size(), 2);
+        EXPECT_EQ(first[0].mPosition.pos[0], 1);
+        EXPECT_EQ(first[0].mPosition.rot[2], 0.5f);
+        EXPECT_EQ(first[0].mScale, 2);
+        EXPECT_EQ(first[0].mId, 0);
+        EXPECT_EQ(first[1].mPosition.pos[0], 2);
+        EXPECT_EQ(first[1].mId, 1);
+
+        const auto second = database.getInstances(-2, 5);
+        ASSERT_EQ(second.size(), 1);
+        EXPECT_EQ(second[0].mPosition.pos[0], 3);
+
+        EXPECT_TRUE(database.getInstances(0, 0).empty());
+        EXPECT_TRUE(database.getInstances(1, 1).empty());
+    }
+
+    TEST_F(GroundcoverDbDatabaseTest, shouldNotMatchOtherContentFiles)
+    {
+        writeDatabase(mPath, mContentFiles, mIds, {});
+        const Database database(mPath);
+        EXPECT_FALSE(database.matches({ mContentFiles[0] }));
+        EXPECT_FALSE(database.matches({ mContentFiles[1], mContentFiles[0] }));
+        EXPECT_FALSE(database.matches({ mContentFiles[0], { "Flowers.esp", { 3, 5 } } }));
+    }
+
+    TEST_F(GroundcoverDbDatabaseTest, shouldThrowOnDuplicateCells)
+    {
+        const std::vector<CellInstances> cells{ { 1, 1, {} }, { 1, 1, {} } };
+        EXPECT_THROW(writeDatabase(mPath, mContentFiles, mIds, cells), std::invalid_argument);
+    }
+
+    TEST_F(GroundcoverDbDatabaseTest, shouldThrowOnTruncatedFile)
+    {
+        writeDatabase(mPath, mContentFiles, mIds, { { 0, 0, { makeTestInstance(1, 0) } } });
+        std::filesystem::resize_file(mPath, std::filesystem::file_size(mPath) - 1);
+        EXPECT_THROW(Database{ mPath }, std::runtime_error);
+    }
+
+    TEST_F(GroundcoverDbDatabaseTest, shouldThrowOnInvalidMagic)
+    {
+        std::ofstream(mPath, std::ios::binary) << std::string(64, 'x');
+        EXPECT_THROW(Database{ mPath }, std::runtime_error);
+    }
+}
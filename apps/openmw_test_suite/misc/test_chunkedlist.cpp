@@ -0,0 +1,127 @@
+#include <components/misc/chunkedlist.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    template <class T>
+    std::vector<T> toVector(const ChunkedList<T>& list)
+    {
+        return std::vector<T>(list.begin(), list.end());
+    }
+
+    TEST(MiscChunkedListTest, shouldKeepInsertionOrder)
+    {
+        ChunkedList<int> list;
+        for (int i = 0; i < 100; ++i)
+            list.push_back(i);
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 0);
+        EXPECT_EQ(toVector(list), expected);
+        EXPECT_EQ(list.size(), 100);
+        EXPECT_EQ(list.front(), 0);
+        EXPECT_EQ(list.back(), 99);
+    }
+
+    TEST(MiscChunkedListTest, addingValuesShouldNotMoveOthers)
+    {
+        ChunkedList<std::string> list;
+        list.push_back("first");
+        const std::string* const first = &list.front();
+        const auto firstIt = list.begin();
+        for (int i = 0; i < 1000; ++i)
+            list.push_back(std::to_string(i));
+        EXPECT_EQ(first, &list.front());
+        EXPECT_EQ(firstIt, list.begin());
+        EXPECT_EQ(*firstIt, "first");
+    }
+
+    TEST(MiscChunkedListTest, eraseShouldSkipErasedValues)
+    {
+        ChunkedList<int> list;
+        for (int i = 0; i < 10; ++i)
+            list.push_back(i);
+        for (auto it = list.begin(); it != list.end();)
+        {
+            if (*it % 3 == 0)
+                it = list.erase(it);
+            else
+                ++it;
+        }
+        EXPECT_THAT(toVector(list), ElementsAre(1, 2, 4, 5, 7, 8));
+        EXPECT_EQ(list.size(), 6);
+        EXPECT_EQ(list.front(), 1);
+        EXPECT_EQ(list.back(), 8);
+    }
+
+    TEST(MiscChunkedListTest, eraseAllShouldMakeListEmpty)
+    {
+        ChunkedList<int> list;
+        for (int i = 0; i < 5; ++i)
+            list.push_back(i);
+        for (auto it = list.begin(); it != list.end();)
+            it = list.erase(it);
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(list.begin(), list.end());
+    }
+
+    TEST(MiscChunkedListTest, decrementEndShouldPointToLastValue)
+    {
+        ChunkedList<int> list;
+        for (int i = 0; i < 20; ++i)
+            list.push_back(i);
+        std::vector<int> reversed;
+        for (auto it = list.end(); it != list.begin();)
+            reversed.push_back(*--it);
+        std::vector<int> expected = toVector(list);
+        std::reverse(expected.begin(), expected.end());
+        EXPECT_EQ(reversed, expected);
+    }
+
+    TEST(MiscChunkedListTest, moveShouldKeepValuesAndIterators)
+    {
+        ChunkedList<std::unique_ptr<int>> list;
+        list.push_back(std::make_unique<int>(1));
+        list.push_back(std::make_unique<int>(2));
+        const auto it = std::next(list.begin());
+        ChunkedList<std::unique_ptr<int>> moved(std::move(list));
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(**it, 2);
+        EXPECT_EQ(std::next(it), moved.end());
+    }
+
+    TEST(MiscChunkedListTest, copyShouldHaveSameValues)
+    {
+        ChunkedList<int> list;
+        for (int i = 0; i < 10; ++i)
+            list.push_back(i);
+        list.erase(list.begin());
+        ChunkedList<int> copy;
+        copy.push_back(42);
+        copy = list;
+        EXPECT_EQ(toVector(copy), toVector(list));
+        EXPECT_NE(&copy.front(), &list.front());
+    }
+
+    TEST(MiscChunkedListTest, findShouldWorkWithStandardAlgorithms)
+    {
+        ChunkedList<int> list;
+        for (int i = 0; i < 10; ++i)
+            list.push_back(i * 2);
+        const auto it = std::find(list.begin(), list.end(), 8);
+        ASSERT_NE(it, list.end());
+        EXPECT_EQ(std::distance(list.begin(), it), 4);
+        *it = 9;
+        EXPECT_EQ(std::count(list.cbegin(), list.cend(), 9), 1);
+    }
+}
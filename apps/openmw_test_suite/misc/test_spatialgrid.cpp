@@ -0,0 +1,145 @@
+#include <components/misc/spatialgrid.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    std::vector<int> getInRange(const SpatialGrid<int>& grid, const osg::Vec3f& position, float radius)
+    {
+        std::vector<int> result;
+        grid.forEachInRange(position, radius, [&](int value, const osg::Vec3f& /*position*/) {
+            result.push_back(value);
+            return true;
+        });
+        return result;
+    }
+
+    std::vector<int> getInBox(const SpatialGrid<int>& grid, const osg::Vec3f& min, const osg::Vec3f& max)
+    {
+        std::vector<int> result;
+        grid.forEachInBox(min, max, [&](int value, const osg::Vec3f& /*position*/) {
+            result.push_back(value);
+            return true;
+        });
+        return result;
+    }
+
+    std::vector<int> getNearest(const SpatialGrid<int>& grid, const osg::Vec3f& position, std::size_t count,
+        float maxDistance = std::numeric_limits<float>::max())
+    {
+        std::vector<int> result;
+        for (const auto& [distance2, value] : grid.findNearest(position, count, maxDistance, [](int) { return true; }))
+            result.push_back(value);
+        return result;
+    }
+
+    TEST(MiscSpatialGridTest, forEachInRangeShouldVisitValuesWithinRadius)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(0, 0, 0));
+        grid.update(2, osg::Vec3f(150, 0, 0));
+        grid.update(3, osg::Vec3f(-250, -250, 0));
+        grid.update(4, osg::Vec3f(0, 0, 300));
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(10, 0, 0), 200), UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialGridTest, forEachInRangeShouldVisitAllValuesForLargeRadius)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(-1e5f, 0, 0));
+        grid.update(2, osg::Vec3f(1e5f, 1e5f, 0));
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 1e6f), UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialGridTest, updateShouldMoveValueToNewPosition)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(0, 0, 0));
+        grid.update(2, osg::Vec3f(10, 0, 0));
+        grid.update(1, osg::Vec3f(1000, 1000, 0));
+        EXPECT_EQ(grid.size(), 2);
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 50), ElementsAre(2));
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(1000, 1000, 0), 50), ElementsAre(1));
+    }
+
+    TEST(MiscSpatialGridTest, removeShouldKeepOtherValues)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(0, 0, 0));
+        grid.update(2, osg::Vec3f(10, 0, 0));
+        grid.update(3, osg::Vec3f(20, 0, 0));
+        EXPECT_TRUE(grid.remove(1));
+        EXPECT_FALSE(grid.remove(1));
+        grid.update(3, osg::Vec3f(30, 0, 0));
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 50), UnorderedElementsAre(2, 3));
+    }
+
+    TEST(MiscSpatialGridTest, forEachInRangeShouldStopWhenFunctionReturnsFalse)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(0, 0, 0));
+        grid.update(2, osg::Vec3f(10, 0, 0));
+        int visited = 0;
+        EXPECT_FALSE(grid.forEachInRange(osg::Vec3f(0, 0, 0), 50, [&](int, const osg::Vec3f&) {
+            ++visited;
+            return false;
+        }));
+        EXPECT_EQ(visited, 1);
+    }
+
+    TEST(MiscSpatialGridTest, forEachInBoxShouldVisitValuesWithinBox)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(0, 0, 0));
+        grid.update(2, osg::Vec3f(250, 120, 10));
+        grid.update(3, osg::Vec3f(250, 120, 100));
+        grid.update(4, osg::Vec3f(-10, 0, 0));
+        EXPECT_THAT(getInBox(grid, osg::Vec3f(0, 0, 0), osg::Vec3f(300, 150, 50)), UnorderedElementsAre(1, 2));
+    }
+
+    TEST(MiscSpatialGridTest, findNearestShouldReturnValuesSortedByDistance)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(500, 0, 0));
+        grid.update(2, osg::Vec3f(-20, 0, 0));
+        grid.update(3, osg::Vec3f(0, 150, 0));
+        grid.update(4, osg::Vec3f(0, 0, 10));
+        grid.update(5, osg::Vec3f(1e4f, 1e4f, 0));
+        EXPECT_THAT(getNearest(grid, osg::Vec3f(0, 0, 0), 3), ElementsAre(4, 2, 3));
+        EXPECT_THAT(getNearest(grid, osg::Vec3f(0, 0, 0), 10), ElementsAre(4, 2, 3, 1, 5));
+    }
+
+    TEST(MiscSpatialGridTest, findNearestShouldRespectMaxDistanceAndPredicate)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(10, 0, 0));
+        grid.update(2, osg::Vec3f(20, 0, 0));
+        grid.update(3, osg::Vec3f(300, 0, 0));
+        EXPECT_THAT(getNearest(grid, osg::Vec3f(0, 0, 0), 10, 100), ElementsAre(1, 2));
+        const auto result = grid.findNearest(osg::Vec3f(0, 0, 0), 1, 1000, [](int value) { return value != 1; });
+        EXPECT_THAT(result, ElementsAre(std::pair(400.0f, 2)));
+    }
+
+    TEST(MiscSpatialGridTest, updatePositionsShouldMoveValuesBetweenCells)
+    {
+        SpatialGrid<int> grid(100);
+        grid.update(1, osg::Vec3f(0, 0, 0));
+        grid.update(2, osg::Vec3f(10, 0, 0));
+        grid.update(3, osg::Vec3f(20, 0, 0));
+        grid.updatePositions([](int value, const osg::Vec3f& position) {
+            return value == 2 ? osg::Vec3f(1000, 0, 0) : position + osg::Vec3f(1, 0, 0);
+        });
+        EXPECT_EQ(grid.size(), 3);
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 50), UnorderedElementsAre(1, 3));
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(1000, 0, 0), 50), ElementsAre(2));
+        EXPECT_THAT(getInRange(grid, osg::Vec3f(21, 0, 0), 0), ElementsAre(3));
+    }
+}
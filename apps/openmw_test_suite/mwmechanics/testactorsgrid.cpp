@@ -0,0 +1,61 @@
+#include "apps/openmw/mwmechanics/actorsgrid.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace MWMechanics
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        std::vector<int> getInRange(const ActorsGrid<int>& grid, const osg::Vec3f& position, float radius)
+        {
+            std::vector<int> result;
+            grid.forEachInRange(position, radius, [&](int actor) {
+                result.push_back(actor);
+                return true;
+            });
+            return result;
+        }
+
+        TEST(MWMechanicsActorsGridTest, forEachInRangeShouldFindActorTeleportedWithinGridCell)
+        {
+            ActorsGrid<int> grid;
+            grid.update(1, osg::Vec3f(10, 10, 0));
+            grid.update(1, osg::Vec3f(500, 500, 0));
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(500, 500, 0), 10), ElementsAre(1));
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(10, 10, 0), 10), IsEmpty());
+        }
+
+        TEST(MWMechanicsActorsGridTest, forEachInRangeShouldFindActorTeleportedWithinGameCell)
+        {
+            ActorsGrid<int> grid;
+            grid.update(1, osg::Vec3f(100, 100, 0));
+            grid.update(2, osg::Vec3f(150, 100, 0));
+            grid.update(1, osg::Vec3f(4000, 7000, 200));
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(4000, 7000, 200), 10), ElementsAre(1));
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(100, 100, 0), 100), ElementsAre(2));
+        }
+
+        TEST(MWMechanicsActorsGridTest, forEachInRangeShouldUseExactPositions)
+        {
+            ActorsGrid<int> grid;
+            grid.update(1, osg::Vec3f(0, 0, 0));
+            grid.update(1, osg::Vec3f(100, 0, 0));
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 99), IsEmpty());
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 100), ElementsAre(1));
+        }
+
+        TEST(MWMechanicsActorsGridTest, forEachInRangeShouldNotFindRemovedActor)
+        {
+            ActorsGrid<int> grid;
+            grid.update(1, osg::Vec3f(0, 0, 0));
+            grid.remove(1);
+            EXPECT_THAT(getInRange(grid, osg::Vec3f(0, 0, 0), 100), IsEmpty());
+            EXPECT_EQ(grid.size(), 0);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#include "apps/openmw/mwphysics/loscache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWPhysics;
+
+    struct Object
+    {
+        int mValue = 0;
+    };
+
+    struct MWPhysicsLOSCacheTest : Test
+    {
+        LOSCache<Object> mCache{ 4 };
+        std::shared_ptr<Object> mFirst = std::make_shared<Object>(Object{ 1 });
+        std::shared_ptr<Object> mSecond = std::make_shared<Object>(Object{ 2 });
+        std::shared_ptr<Object> mThird = std::make_shared<Object>(Object{ 3 });
+
+        void refresh(int maxAge, bool result = true)
+        {
+            for (std::size_t i = 0; i < mCache.getShardsCount(); ++i)
+                mCache.refresh(i, maxAge, [&](const Object&, const Object&) { return result; });
+        }
+    };
+
+    TEST_F(MWPhysicsLOSCacheTest, findShouldReturnNulloptForMissingPair)
+    {
+        EXPECT_EQ(mCache.find(mFirst.get(), mSecond.get()), std::nullopt);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, findShouldReturnInsertedResultForBothOrders)
+    {
+        mCache.insert(mFirst, mSecond, true);
+        mCache.insert(mFirst, mThird, false);
+        EXPECT_EQ(mCache.find(mFirst.get(), mSecond.get()), true);
+        EXPECT_EQ(mCache.find(mSecond.get(), mFirst.get()), true);
+        EXPECT_EQ(mCache.find(mThird.get(), mFirst.get()), false);
+        EXPECT_EQ(mCache.find(mSecond.get(), mThird.get()), std::nullopt);
+        EXPECT_EQ(mCache.size(), 2);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, insertShouldKeepExistingEntry)
+    {
+        mCache.insert(mFirst, mSecond, true);
+        mCache.insert(mSecond, mFirst, false);
+        EXPECT_EQ(mCache.find(mFirst.get(), mSecond.get()), true);
+        EXPECT_EQ(mCache.size(), 1);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, refreshShouldUpdateResults)
+    {
+        mCache.insert(mFirst, mSecond, true);
+        refresh(0, false);
+        EXPECT_EQ(mCache.find(mFirst.get(), mSecond.get()), false);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, refreshShouldPassObjectsOfThePair)
+    {
+        mCache.insert(mSecond, mThird, false);
+        std::vector<std::pair<int, int>> pairs;
+        for (std::size_t i = 0; i < mCache.getShardsCount(); ++i)
+            mCache.refresh(i, 0, [&](const Object& first, const Object& second) {
+                pairs.emplace_back(first.mValue, second.mValue);
+                return true;
+            });
+        ASSERT_EQ(pairs.size(), 1);
+        EXPECT_EQ(pairs[0].first + pairs[0].second, 5);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, refreshShouldRemoveEntriesNotUsedForMoreThanMaxAgeGenerations)
+    {
+        mCache.insert(mFirst, mSecond, true);
+        mCache.insert(mFirst, mThird, true);
+        refresh(1);
+        mCache.advance();
+        EXPECT_EQ(mCache.find(mFirst.get(), mSecond.get()), true);
+        refresh(1);
+        mCache.advance();
+        refresh(1);
+        EXPECT_EQ(mCache.size(), 1);
+        EXPECT_EQ(mCache.find(mFirst.get(), mSecond.get()), true);
+        EXPECT_EQ(mCache.find(mFirst.get(), mThird.get()), std::nullopt);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, refreshWithNegativeMaxAgeShouldRemoveAllEntries)
+    {
+        mCache.insert(mFirst, mSecond, true);
+        refresh(-1);
+        EXPECT_EQ(mCache.size(), 0);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, refreshShouldRemoveEntriesWithDestroyedObjects)
+    {
+        mCache.insert(mFirst, mSecond, true);
+        mCache.insert(mFirst, mThird, true);
+        mThird.reset();
+        refresh(10);
+        EXPECT_EQ(mCache.size(), 1);
+    }
+
+    TEST_F(MWPhysicsLOSCacheTest, shouldDistributePairsOverShards)
+    {
+        LOSCache<Object> cache(8);
+        std::vector<std::shared_ptr<Object>> objects;
+        for (int i = 0; i < 32; ++i)
+            objects.push_back(std::make_shared<Object>(Object{ i }));
+        for (std::size_t i = 1; i < objects.size(); ++i)
+            cache.insert(objects[0], objects[i], true);
+        std::size_t nonEmptyShards = 0;
+        for (std::size_t i = 0; i < cache.getShardsCount(); ++i)
+        {
+            bool empty = true;
+            cache.refresh(i, 0, [&](const Object&, const Object&) {
+                empty = false;
+                return true;
+            });
+            nonEmptyShards += empty ? 0 : 1;
+        }
+        EXPECT_GT(nonEmptyShards, 1);
+    }
+}
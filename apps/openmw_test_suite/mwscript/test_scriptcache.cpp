@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include "apps/openmw/mwscript/scriptcache.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include "../testing_util.hpp"
+
+namespace MWScript
+{
+    namespace
+    {
+        using namespace testing;
+        using namespace TestingOpenMW;
+
+        struct MWScriptScriptCacheTest : Test
+        {
+            const std::string mName = UnitTest::GetInstance()->current_test_info()->name();
+            const std::filesystem::path mCachePath = outputFilePath(mName + ".scripts.cache");
+            const std::filesystem::path mContentFile = outputFilePath(mName + ".esp");
+            const ESM::RefId mId = ESM::RefId::stringRefId("script");
+            const std::string mText = "Begin script\nshort a\nEnd";
+            Interpreter::Program mProgram;
+            Compiler::Locals mLocals;
+
+            MWScriptScriptCacheTest()
+            {
+                std::filesystem::remove(mCachePath);
+                std::ofstream(mContentFile) << "content";
+                mProgram.mInstructions = { 1, 2, 3 };
+                mProgram.mIntegers = { 42 };
+                mProgram.mFloats = { 13.5f };
+                mProgram.mStrings = { "first", "second" };
+                mLocals.declare('s', "a");
+                mLocals.declare('f', "b");
+            }
+
+            ScriptCache makeCache() const
+            {
+                return ScriptCache(mCachePath, MWWorld::ContentFilesFingerprint({ mContentFile }, nullptr));
+            }
+        };
+
+        TEST_F(MWScriptScriptCacheTest, getShouldReturnSavedScript)
+        {
+            ScriptCache cache = makeCache();
+            cache.add(mId, mText, mProgram, mLocals);
+            cache.save();
+
+            ScriptCache loaded = makeCache();
+            loaded.load();
+            Interpreter::Program program;
+            Compiler::Locals locals;
+            ASSERT_TRUE(loaded.get(mId, mText, program, locals));
+            EXPECT_EQ(program.mInstructions, mProgram.mInstructions);
+            EXPECT_EQ(program.mIntegers, mProgram.mIntegers);
+            EXPECT_EQ(program.mFloats, mProgram.mFloats);
+            EXPECT_EQ(program.mStrings, mProgram.mStrings);
+            EXPECT_EQ(std::as_const(locals).get('s'), std::as_const(mLocals).get('s'));
+            EXPECT_EQ(std::as_const(locals).get('l'), std::as_const(mLocals).get('l'));
+            EXPECT_EQ(std::as_const(locals).get('f'), std::as_const(mLocals).get('f'));
+        }
+
+        TEST_F(MWScriptScriptCacheTest, getShouldReturnFalseForChangedScriptText)
+        {
+            ScriptCache cache = makeCache();
+            cache.add(mId, mText, mProgram, mLocals);
+            Interpreter::Program program;
+            Compiler::Locals locals;
+            EXPECT_FALSE(cache.get(mId, "Begin script\nEnd", program, locals));
+        }
+
+        TEST_F(MWScriptScriptCacheTest, loadShouldIgnoreCacheForChangedContentFiles)
+        {
+            ScriptCache cache = makeCache();
+            cache.add(mId, mText, mProgram, mLocals);
+            cache.save();
+
+            std::ofstream(mContentFile, std::ios::app) << "changed";
+
+            ScriptCache loaded = makeCache();
+            loaded.load();
+            Interpreter::Program program;
+            Compiler::Locals locals;
+            EXPECT_FALSE(loaded.get(mId, mText, program, locals));
+        }
+    }
+}
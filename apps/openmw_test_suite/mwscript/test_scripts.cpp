@@ -49,6 +49,11 @@ namespace
             mInterpreter.run(script.mProgram, context);
         }
 
+        void runDecoded(const CompiledScript& script, TestInterpreterContext& context)
+        {
+            mInterpreter.run(script.mProgram, mInterpreter.decode(script.mProgram), context);
+        }
+
         template <typename T, typename... TArgs>
         void installOpcode(int code, TArgs&&... args)
         {
@@ -553,6 +558,37 @@ End)mwscript";
         }
     }
 
+    TEST_F(MWScriptTest, mwscript_test_decoded_program)
+    {
+        const std::string scriptText = R"mwscript(Begin decoded
+
+short a
+long b
+float c
+
+set a to 3
+set b to ( a * 100000 )
+set c to ( -2.5 * a )
+while ( a < 10 )
+    set a to ( a + 2 )
+    set c to ( c + 0.25 )
+endwhile
+
+End)mwscript";
+        if (const auto script = compile(scriptText))
+        {
+            TestInterpreterContext context;
+            runDecoded(*script, context);
+            EXPECT_EQ(context.getLocalShort(0), 11);
+            EXPECT_EQ(context.getLocalLong(0), 300000);
+            EXPECT_FLOAT_EQ(context.getLocalFloat(0), -6.5f);
+        }
+        else
+        {
+            FAIL();
+        }
+    }
+
     TEST_F(MWScriptTest, mwscript_test_forum_thread)
     {
         registerExtensions();
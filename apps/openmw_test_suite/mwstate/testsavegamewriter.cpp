@@ -0,0 +1,150 @@
+#include "apps/openmw/mwstate/savegamewriter.hpp"
+
+#include <components/esm/defs.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/esmwriter.hpp>
+#include <components/esm3/formatversion.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../testing_util.hpp"
+
+namespace MWState
+{
+    namespace
+    {
+        using namespace ::testing;
+        using namespace TestingOpenMW;
+
+        std::string getTestName()
+        {
+            // Parameterized test names contain '/'
+            std::string name = UnitTest::GetInstance()->current_test_info()->name();
+            std::replace(name.begin(), name.end(), '/', '_');
+            return name;
+        }
+
+        struct MWStateSaveGameWriterTest : TestWithParam<bool>
+        {
+            const std::filesystem::path mPath = outputFilePath(getTestName() + ".omwsave");
+            const std::vector<std::string> mContentFiles{ "Morrowind.esm", "Tribunal.esm" };
+            const std::vector<std::string> mValues{ "first", std::string(3 * 1024 * 1024, 'a'), "third" };
+            ESM::SavedGame mProfile;
+
+            MWStateSaveGameWriterTest()
+            {
+                std::filesystem::remove(mPath);
+                mProfile.mContentFiles = mContentFiles;
+                mProfile.mPlayerName = "player";
+                mProfile.mPlayerLevel = 42;
+                mProfile.mPlayerClassId = ESM::RefId::stringRefId("class");
+                mProfile.mPlayerCellName = "cell";
+                mProfile.mInGameTime = ESM::EpochTimeStamp{ 1, 2, 3, 4 };
+                mProfile.mTimePlayed = 13.5;
+                mProfile.mDescription = "description";
+            }
+
+            // Returns the memory stream content of the first phase and the offset of the body
+            std::pair<std::string, std::size_t> writeBody() const
+            {
+                std::stringstream stream;
+                ESM::ESMWriter writer;
+                writer.setFormatVersion(SaveGameWriter::getFormatVersion(GetParam()));
+                writer.save(stream);
+                const std::size_t offset = static_cast<std::size_t>(stream.tellp());
+                for (const std::string& value : mValues)
+                {
+                    writer.startRecord(ESM::REC_GLOB);
+                    writer.writeHNString("NAME", value);
+                    writer.endRecord(ESM::REC_GLOB);
+                }
+                writer.close();
+                return { stream.str(), offset };
+            }
+
+            osg::ref_ptr<SaveGameWriter> makeWriter(const std::filesystem::path& path, bool compress) const
+            {
+                auto [data, offset] = writeBody();
+                return new SaveGameWriter(path, mContentFiles, static_cast<int>(mValues.size() + 1), mProfile,
+                    nullptr, std::move(data), offset, compress);
+            }
+
+            void expectSavedGame() const
+            {
+                ESM::ESMReader reader;
+                reader.open(mPath);
+
+                EXPECT_EQ(reader.getFormatVersion(),
+                    GetParam() ? ESM::CurrentSaveGameFormatVersion : ESM::MaxUncompressedSaveGameFormatVersion);
+                EXPECT_EQ(reader.getRecordCount(), static_cast<int>(mValues.size() + 1));
+                std::vector<std::string> masters;
+                for (const auto& master : reader.getGameFiles())
+                    masters.push_back(master.name);
+                EXPECT_EQ(masters, mContentFiles);
+
+                ASSERT_TRUE(reader.hasMoreRecs());
+                ASSERT_EQ(reader.getRecName(), ESM::REC_SAVE);
+                reader.getRecHeader();
+                ESM::SavedGame profile;
+                profile.load(reader);
+                EXPECT_EQ(profile.mContentFiles, mProfile.mContentFiles);
+                EXPECT_EQ(profile.mPlayerName, mProfile.mPlayerName);
+                EXPECT_EQ(profile.mPlayerLevel, mProfile.mPlayerLevel);
+                EXPECT_EQ(profile.mPlayerClassId, mProfile.mPlayerClassId);
+                EXPECT_EQ(profile.mPlayerCellName, mProfile.mPlayerCellName);
+                EXPECT_EQ(profile.mTimePlayed, mProfile.mTimePlayed);
+                EXPECT_EQ(profile.mDescription, mProfile.mDescription);
+
+                std::vector<std::string> values;
+                while (reader.hasMoreRecs())
+                {
+                    EXPECT_EQ(reader.getRecName(), ESM::REC_GLOB);
+                    reader.getRecHeader();
+                    values.push_back(reader.getHNString("NAME"));
+                }
+                EXPECT_EQ(values, mValues);
+            }
+        };
+
+        TEST_P(MWStateSaveGameWriterTest, doWorkShouldWriteReadableSavedGame)
+        {
+            const osg::ref_ptr<SaveGameWriter> writer = makeWriter(mPath, GetParam());
+            writer->doWork();
+            EXPECT_EQ(writer->getError(), "");
+            EXPECT_EQ(writer->getProgress(), 1);
+            expectSavedGame();
+        }
+
+        TEST_P(MWStateSaveGameWriterTest, doWorkShouldReplaceExistingFile)
+        {
+            std::ofstream(mPath, std::ios::binary) << std::string(10 * 1024 * 1024, 'b');
+            const osg::ref_ptr<SaveGameWriter> writer = makeWriter(mPath, GetParam());
+            writer->doWork();
+            EXPECT_EQ(writer->getError(), "");
+            expectSavedGame();
+            std::filesystem::path tmpPath = mPath;
+            tmpPath += ".tmp";
+            EXPECT_FALSE(std::filesystem::exists(tmpPath));
+        }
+
+        TEST_P(MWStateSaveGameWriterTest, doWorkShouldReportErrorForMissingDirectory)
+        {
+            const std::filesystem::path path = mPath.parent_path() / "missing" / mPath.filename();
+            const osg::ref_ptr<SaveGameWriter> writer = makeWriter(path, GetParam());
+            writer->doWork();
+            EXPECT_NE(writer->getError(), "");
+            EXPECT_FALSE(std::filesystem::exists(path));
+        }
+
+        INSTANTIATE_TEST_SUITE_P(PlainAndCompressed, MWStateSaveGameWriterTest, Values(false, true));
+    }
+}
@@ -438,6 +438,54 @@ TYPED_TEST_P(StoreTest, overwrite_test)
     }
 }
 
+/// Tests loading of records decoded separately from the reader used to load the file.
+TYPED_TEST_P(StoreTest, decoded_records_test)
+{
+    using RecordType = TypeParam;
+
+    for (const ESM::FormatVersion formatVersion : getFormats())
+    {
+        SCOPED_TRACE("FormatVersion: " + std::to_string(formatVersion));
+
+        const ESM::RefId recordId = ESM::RefId::stringRefId("foobar");
+
+        RecordType record;
+        if constexpr (hasBlankFunction<RecordType>)
+            record.blank();
+        record.mId = recordId;
+
+        ESM::ESMReader reader;
+        ESM::ESMReader decodingReader;
+        ESM::Dialogue* dialogue = nullptr;
+        MWWorld::ESMStore esmStore;
+
+        const auto loadDecoded = [&](bool deleted) {
+            decodingReader.open(getEsmFile(record, deleted, formatVersion), "filename");
+            MWWorld::DecodedRecords decoded = esmStore.decodeRecords(decodingReader);
+            ASSERT_EQ(decoded.size(), 1);
+            EXPECT_NE(decoded.front(), nullptr);
+            reader.open(getEsmFile(record, deleted, formatVersion), "filename");
+            esmStore.load(reader, &dummyListener, dialogue, std::move(decoded));
+        };
+
+        // master file inserts a record
+        loadDecoded(false);
+        EXPECT_EQ(esmStore.get<RecordType>().getSize(), 1);
+
+        // now a plugin overwrites it with changed data
+        record.mModel = "the_new_model";
+        loadDecoded(false);
+        EXPECT_EQ(esmStore.get<RecordType>().getSize(), 1);
+
+        // and another plugin deletes it
+        loadDecoded(true);
+
+        esmStore.setUp();
+
+        EXPECT_EQ(esmStore.get<RecordType>().getSize(), 0);
+    }
+}
+
 namespace
 {
     using namespace ::testing;
@@ -585,7 +633,7 @@ namespace
         RecordTypesTest, StoreSaveLoadTest, typename AsTestingTypes<RecordTypesWithSave>::Type);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(StoreTest, overwrite_test, delete_test);
+REGISTER_TYPED_TEST_SUITE_P(StoreTest, overwrite_test, delete_test, decoded_records_test);
 
 static_assert(std::tuple_size_v<RecordTypesWithModel> == 19);
 
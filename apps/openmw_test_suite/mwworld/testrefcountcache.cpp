@@ -0,0 +1,109 @@
+#include "apps/openmw/mwworld/refcountcache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "../testing_util.hpp"
+
+namespace MWWorld
+{
+    namespace
+    {
+        using namespace testing;
+        using namespace TestingOpenMW;
+
+        struct MWWorldRefCountCacheTest : Test
+        {
+            const std::string mName = UnitTest::GetInstance()->current_test_info()->name();
+            const std::filesystem::path mCachePath = outputFilePath(mName + ".refcount");
+            const std::filesystem::path mContentFile = outputFilePath(mName + ".esp");
+            const std::unordered_map<ESM::RefId, int> mRefCount{
+                { ESM::RefId::stringRefId("first"), 1 },
+                { ESM::RefId::stringRefId("second"), 42 },
+            };
+            const std::set<ESM::RefId> mKeyIds{ ESM::RefId::stringRefId("key") };
+
+            MWWorldRefCountCacheTest()
+            {
+                std::filesystem::remove(mCachePath);
+                std::ofstream(mContentFile) << "content";
+            }
+
+            RefCountCache makeCache() const
+            {
+                return RefCountCache(mCachePath, ContentFilesFingerprint({ mContentFile }, nullptr));
+            }
+        };
+
+        TEST_F(MWWorldRefCountCacheTest, readShouldReturnFalseWithoutFile)
+        {
+            std::unordered_map<ESM::RefId, int> refCount;
+            std::set<ESM::RefId> keyIds;
+            EXPECT_FALSE(makeCache().read(refCount, keyIds));
+        }
+
+        TEST_F(MWWorldRefCountCacheTest, readShouldReturnWrittenValues)
+        {
+            makeCache().write(mRefCount, mKeyIds);
+
+            std::unordered_map<ESM::RefId, int> refCount;
+            std::set<ESM::RefId> keyIds;
+            ASSERT_TRUE(makeCache().read(refCount, keyIds));
+            EXPECT_EQ(refCount, mRefCount);
+            EXPECT_EQ(keyIds, mKeyIds);
+        }
+
+        TEST_F(MWWorldRefCountCacheTest, readShouldReturnFalseForChangedContentFiles)
+        {
+            makeCache().write(mRefCount, mKeyIds);
+
+            std::ofstream(mContentFile, std::ios::app) << "changed";
+
+            std::unordered_map<ESM::RefId, int> refCount;
+            std::set<ESM::RefId> keyIds;
+            EXPECT_FALSE(makeCache().read(refCount, keyIds));
+            EXPECT_TRUE(refCount.empty());
+            EXPECT_TRUE(keyIds.empty());
+        }
+
+        TEST_F(MWWorldRefCountCacheTest, readShouldReturnFalseForOtherContentFilesList)
+        {
+            makeCache().write(mRefCount, mKeyIds);
+
+            const std::filesystem::path otherContentFile = outputFilePath(mName + ".other.esp");
+            std::ofstream(otherContentFile) << "other";
+            const RefCountCache cache(mCachePath, ContentFilesFingerprint({ mContentFile, otherContentFile }, nullptr));
+
+            std::unordered_map<ESM::RefId, int> refCount;
+            std::set<ESM::RefId> keyIds;
+            EXPECT_FALSE(cache.read(refCount, keyIds));
+        }
+
+        TEST_F(MWWorldRefCountCacheTest, readShouldReturnFalseForTruncatedFile)
+        {
+            makeCache().write(mRefCount, mKeyIds);
+
+            std::filesystem::resize_file(mCachePath, std::filesystem::file_size(mCachePath) - 4);
+
+            std::unordered_map<ESM::RefId, int> refCount;
+            std::set<ESM::RefId> keyIds;
+            EXPECT_FALSE(makeCache().read(refCount, keyIds));
+            EXPECT_TRUE(refCount.empty());
+            EXPECT_TRUE(keyIds.empty());
+        }
+
+        TEST_F(MWWorldRefCountCacheTest, readShouldReturnFalseForCorruptFile)
+        {
+            std::ofstream(mCachePath, std::ios::binary) << "not a references count cache";
+
+            std::unordered_map<ESM::RefId, int> refCount;
+            std::set<ESM::RefId> keyIds;
+            EXPECT_FALSE(makeCache().read(refCount, keyIds));
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#include <components/nifosg/controller.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace
+{
+    using namespace testing;
+    using namespace NifOsg;
+
+    std::shared_ptr<Nif::FloatKeyMap> makeKeys(unsigned int interpolationType)
+    {
+        auto result = std::make_shared<Nif::FloatKeyMap>();
+        result->mInterpolationType = interpolationType;
+        result->mTimes = { 0, 1, 3 };
+        result->mKeys = { Nif::FloatKey{ 10, 0, 0 }, Nif::FloatKey{ 20, 0, 0 }, Nif::FloatKey{ 0, 0, 0 } };
+        return result;
+    }
+
+    TEST(NifOsgValueInterpolatorTest, interpKeyShouldReturnDefaultValueForEmptyKeys)
+    {
+        const FloatInterpolator interpolator(std::make_shared<Nif::FloatKeyMap>(), 42);
+        EXPECT_EQ(interpolator.interpKey(1), 42);
+    }
+
+    TEST(NifOsgValueInterpolatorTest, interpKeyShouldClampToFirstAndLastKeys)
+    {
+        const FloatInterpolator interpolator(makeKeys(Nif::InterpolationType_Linear));
+        EXPECT_EQ(interpolator.interpKey(-1), 10);
+        EXPECT_EQ(interpolator.interpKey(0), 10);
+        EXPECT_EQ(interpolator.interpKey(3), 0);
+        EXPECT_EQ(interpolator.interpKey(4), 0);
+    }
+
+    TEST(NifOsgValueInterpolatorTest, interpKeyShouldInterpolateLinearly)
+    {
+        const FloatInterpolator interpolator(makeKeys(Nif::InterpolationType_Linear));
+        EXPECT_FLOAT_EQ(interpolator.interpKey(0.5f), 15);
+        EXPECT_FLOAT_EQ(interpolator.interpKey(0.75f), 17.5f);
+        EXPECT_FLOAT_EQ(interpolator.interpKey(2), 10);
+    }
+
+    TEST(NifOsgValueInterpolatorTest, interpKeyShouldSupportTimeMovingBackwards)
+    {
+        const FloatInterpolator interpolator(makeKeys(Nif::InterpolationType_Linear));
+        EXPECT_FLOAT_EQ(interpolator.interpKey(2.5f), 5);
+        EXPECT_FLOAT_EQ(interpolator.interpKey(0.25f), 12.5f);
+        EXPECT_FLOAT_EQ(interpolator.interpKey(1.5f), 15);
+    }
+
+    TEST(NifOsgValueInterpolatorTest, interpKeyShouldUseNearestKeyForConstantInterpolation)
+    {
+        const FloatInterpolator interpolator(makeKeys(Nif::InterpolationType_Constant));
+        EXPECT_EQ(interpolator.interpKey(0.4f), 10);
+        EXPECT_EQ(interpolator.interpKey(0.6f), 20);
+    }
+}
@@ -0,0 +1,72 @@
+#include <components/platform/file.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "../testing_util.hpp"
+
+namespace Platform::File
+{
+    namespace
+    {
+        using namespace ::testing;
+        using namespace TestingOpenMW;
+
+        struct PlatformFileTest : Test
+        {
+            const std::filesystem::path mPath
+                = outputFilePath(std::string(UnitTest::GetInstance()->current_test_info()->name()) + ".bin");
+            const std::string mData = "first" + std::string(100000, 'a') + "last";
+
+            std::string readAll() const
+            {
+                ScopedHandle handle = open(mPath);
+                std::string result(size(handle), '\0');
+                EXPECT_EQ(read(handle, result.data(), result.size()), result.size());
+                return result;
+            }
+        };
+
+        TEST_F(PlatformFileTest, readShouldReturnWrittenData)
+        {
+            {
+                ScopedHandle handle = create(mPath);
+                write(handle, mData.data(), mData.size());
+                sync(handle);
+            }
+            EXPECT_EQ(readAll(), mData);
+        }
+
+        TEST_F(PlatformFileTest, createShouldTruncateExistingFile)
+        {
+            std::ofstream(mPath, std::ios::binary) << std::string(1000, 'b');
+            {
+                ScopedHandle handle = create(mPath);
+                write(handle, mData.data(), 10);
+            }
+            EXPECT_EQ(readAll(), mData.substr(0, 10));
+        }
+
+        TEST_F(PlatformFileTest, writeAfterSeekShouldOverwriteData)
+        {
+            {
+                ScopedHandle handle = create(mPath);
+                write(handle, mData.data(), mData.size());
+                seek(handle, 1);
+                write(handle, "xy", 2);
+            }
+            std::string expected = mData;
+            expected.replace(1, 2, "xy");
+            EXPECT_EQ(readAll(), expected);
+        }
+
+        TEST_F(PlatformFileTest, createShouldThrowForMissingDirectory)
+        {
+            EXPECT_THROW(create(mPath.parent_path() / "missing" / "file.bin"), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,169 @@
+#include <components/resource/objectcache.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace Resource
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        TEST(ResourceGenericObjectCacheTest, getRefFromObjectCacheShouldReturnNullptrForMissingKey)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            EXPECT_EQ(cache->getRefFromObjectCache(42), nullptr);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, getRefFromObjectCacheShouldReturnAddedObject)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            osg::ref_ptr<osg::Object> value(new osg::Object);
+            cache->addEntryToObjectCache(42, value.get());
+            EXPECT_EQ(cache->getRefFromObjectCache(42).get(), value.get());
+        }
+
+        TEST(ResourceGenericObjectCacheTest, addEntryToObjectCacheShouldReplaceObjectForSameKey)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            osg::ref_ptr<osg::Object> value1(new osg::Object);
+            osg::ref_ptr<osg::Object> value2(new osg::Object);
+            cache->addEntryToObjectCache(42, value1.get());
+            cache->addEntryToObjectCache(42, value2.get());
+            EXPECT_EQ(cache->getRefFromObjectCache(42).get(), value2.get());
+            EXPECT_EQ(cache->getCacheSize(), 1);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldRemoveExpiredObjectsWithoutExternalReferences)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->addEntryToObjectCache(1, new osg::Object, 1);
+            cache->addEntryToObjectCache(2, new osg::Object, 5);
+            cache->update(10, 6);
+            EXPECT_EQ(cache->getRefFromObjectCache(1), nullptr);
+            EXPECT_NE(cache->getRefFromObjectCache(2), nullptr);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldKeepObjectsWithUninitializedTimeStamp)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->addEntryToObjectCache(1, new osg::Object);
+            cache->update(10, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            cache->update(14, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            cache->update(15, 5);
+            EXPECT_EQ(cache->getRefFromObjectCache(1), nullptr);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldVisitObjectsWithUninitializedTimeStampAddedAfterNewerOnes)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            for (int i = 0; i < 100; ++i)
+                cache->addEntryToObjectCache(i, new osg::Object, 8);
+            cache->addEntryToObjectCache(100, new osg::Object);
+            cache->update(10, 5);
+            EXPECT_EQ(cache->getCacheSize(), 101);
+            cache->update(16, 5);
+            EXPECT_EQ(cache->getCacheSize(), 0);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldKeepObjectsForExpiryDelayAfterExternalReferenceIsGone)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            osg::ref_ptr<osg::Object> value(new osg::Object);
+            cache->addEntryToObjectCache(1, value.get(), 1);
+            cache->update(10, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            value = nullptr;
+            cache->update(16, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            cache->update(21, 5);
+            EXPECT_EQ(cache->getRefFromObjectCache(1), nullptr);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldRemoveObjectsWithinExpiryDelayAfterExternalReferenceIsGone)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            osg::ref_ptr<osg::Object> value(new osg::Object);
+            cache->addEntryToObjectCache(1, value.get(), 1);
+            cache->update(10, 5);
+            value = nullptr;
+            cache->update(11.5, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            cache->update(15, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            cache->update(15.5, 5);
+            EXPECT_EQ(cache->getRefFromObjectCache(1), nullptr);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, updateShouldKeepObjectsWithExternalReferences)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            osg::ref_ptr<osg::Object> value(new osg::Object);
+            cache->addEntryToObjectCache(1, value.get(), 1);
+            for (int time = 10; time < 100; ++time)
+                cache->update(time, 5);
+            EXPECT_EQ(cache->getRefFromObjectCache(1).get(), value.get());
+        }
+
+        TEST(ResourceGenericObjectCacheTest, checkInObjectCacheShouldUpdateTimeStamp)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->addEntryToObjectCache(1, new osg::Object, 1);
+            cache->addEntryToObjectCache(2, new osg::Object, 2);
+            EXPECT_TRUE(cache->checkInObjectCache(1, 8));
+            EXPECT_FALSE(cache->checkInObjectCache(3, 8));
+            cache->update(10, 5);
+            EXPECT_NE(cache->getRefFromObjectCache(1), nullptr);
+            EXPECT_EQ(cache->getRefFromObjectCache(2), nullptr);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, removeFromObjectCacheShouldRemoveObject)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->addEntryToObjectCache(1, new osg::Object);
+            cache->addEntryToObjectCache(2, new osg::Object);
+            cache->removeFromObjectCache(1);
+            EXPECT_EQ(cache->getRefFromObjectCache(1), nullptr);
+            EXPECT_EQ(cache->getCacheSize(), 1);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, callShouldVisitAllObjects)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            for (int i = 0; i < 100; ++i)
+                cache->addEntryToObjectCache(i, new osg::Object);
+            std::vector<int> keys;
+            auto f = [&](int key, osg::Object* /*object*/) { keys.push_back(key); };
+            cache->call(f);
+            EXPECT_EQ(keys.size(), 100);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, getStatsShouldReturnGetAndHitCounts)
+        {
+            osg::ref_ptr<GenericObjectCache<int>> cache(new GenericObjectCache<int>);
+            cache->addEntryToObjectCache(1, new osg::Object);
+            cache->getRefFromObjectCache(1);
+            cache->getRefFromObjectCache(2);
+            const GenericObjectCacheStats stats = cache->getStats();
+            EXPECT_EQ(stats.mSize, 1);
+            EXPECT_EQ(stats.mGetCount, 2);
+            EXPECT_EQ(stats.mHitCount, 1);
+        }
+
+        TEST(ResourceGenericObjectCacheTest, shouldSupportTupleKeys)
+        {
+            using Key = std::tuple<osg::Vec2f, float, bool>;
+            osg::ref_ptr<GenericObjectCache<Key>> cache(new GenericObjectCache<Key>);
+            osg::ref_ptr<osg::Object> value(new osg::Object);
+            cache->addEntryToObjectCache(Key(osg::Vec2f(1, 2), 3, true), value.get());
+            EXPECT_EQ(cache->getRefFromObjectCache(Key(osg::Vec2f(1, 2), 3, true)).get(), value.get());
+            EXPECT_EQ(cache->getRefFromObjectCache(Key(osg::Vec2f(1, 2), 3, false)), nullptr);
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#include <components/nifosg/matrixtransform.hpp>
+#include <components/resource/scenefilecache.hpp>
+#include <components/sceneutil/positionattitudetransform.hpp>
+#include <components/sceneutil/serialize.hpp>
+
+#include <gtest/gtest.h>
+
+#include <osg/Geometry>
+#include <osg/Group>
+#include <osg/Texture2D>
+#include <osgDB/Registry>
+
+#include <sstream>
+
+namespace Resource
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        struct DummyCallback : osg::NodeCallback
+        {
+        };
+
+        TEST(ResourceSceneFileCacheTest, canCacheShouldAcceptGroupWithGeometry)
+        {
+            osg::ref_ptr<osg::Group> group(new osg::Group);
+            osg::ref_ptr<NifOsg::MatrixTransform> transform(new NifOsg::MatrixTransform);
+            transform->addChild(new osg::Geometry);
+            group->addChild(transform);
+            group->setUserValue("recIndex", 42u);
+            EXPECT_TRUE(SceneFileCache::canCache(*group));
+        }
+
+        TEST(ResourceSceneFileCacheTest, canCacheShouldRejectNodeWithCallback)
+        {
+            osg::ref_ptr<osg::Group> group(new osg::Group);
+            osg::ref_ptr<osg::Group> child(new osg::Group);
+            child->setUpdateCallback(new DummyCallback);
+            group->addChild(child);
+            EXPECT_FALSE(SceneFileCache::canCache(*group));
+        }
+
+        TEST(ResourceSceneFileCacheTest, canCacheShouldRejectNodeWithoutLosslessSerializer)
+        {
+            osg::ref_ptr<osg::Group> group(new osg::Group);
+            group->addChild(new SceneUtil::PositionAttitudeTransform);
+            EXPECT_FALSE(SceneFileCache::canCache(*group));
+        }
+
+        TEST(ResourceSceneFileCacheTest, canCacheShouldRejectEmbeddedImage)
+        {
+            osg::ref_ptr<osg::Geometry> geometry(new osg::Geometry);
+            osg::ref_ptr<osg::Texture2D> texture(new osg::Texture2D(new osg::Image));
+            geometry->getOrCreateStateSet()->setTextureAttributeAndModes(0, texture);
+            EXPECT_FALSE(SceneFileCache::canCache(*geometry));
+            texture->getImage()->setFileName("textures/tx_a.dds");
+            EXPECT_TRUE(SceneFileCache::canCache(*geometry));
+        }
+
+        TEST(ResourceSceneFileCacheTest, matrixTransformSerializerShouldKeepScaleAndRotation)
+        {
+            SceneUtil::registerLosslessSerializers();
+            osgDB::ReaderWriter* const readerWriter
+                = osgDB::Registry::instance()->getReaderWriterForExtension("osgb");
+            ASSERT_NE(readerWriter, nullptr);
+
+            Nif::Transformation trafo = Nif::Transformation::getIdentity();
+            trafo.scale = 2;
+            trafo.rotation.mValues[0][1] = 0.5f;
+            trafo.pos = osg::Vec3f(1, 2, 3);
+            osg::ref_ptr<NifOsg::MatrixTransform> transform(new NifOsg::MatrixTransform(trafo));
+
+            std::stringstream stream;
+            ASSERT_TRUE(readerWriter->writeNode(*transform, stream).success());
+            const osgDB::ReaderWriter::ReadResult result = readerWriter->readNode(stream);
+            ASSERT_TRUE(result.success());
+            const auto* const read = dynamic_cast<const NifOsg::MatrixTransform*>(result.getNode());
+            ASSERT_NE(read, nullptr);
+            EXPECT_EQ(read->mScale, 2);
+            EXPECT_EQ(read->mRotationScale.mValues[0][1], 0.5f);
+            EXPECT_EQ(read->mRotationScale.mValues[2][2], 1);
+            EXPECT_EQ(read->getMatrix(), transform->getMatrix());
+        }
+    }
+}
@@ -0,0 +1,193 @@
+#include <components/sceneutil/skinning.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <osg/Matrixf>
+#include <osg/Vec3f>
+#include <osg/Vec4f>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace SceneUtil
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        constexpr float epsilon = 1e-3f;
+
+        osg::Matrixf generateMatrix(std::minstd_rand& random)
+        {
+            std::uniform_real_distribution<float> angle(-osg::PI, osg::PI);
+            std::uniform_real_distribution<float> scale(0.5f, 2);
+            std::uniform_real_distribution<float> offset(-100, 100);
+            return osg::Matrixf::scale(scale(random), scale(random), scale(random))
+                * osg::Matrixf::rotate(angle(random), osg::Vec3f(0, 0, 1))
+                * osg::Matrixf::rotate(angle(random), osg::Vec3f(1, 0, 0))
+                * osg::Matrixf::translate(offset(random), offset(random), offset(random));
+        }
+
+        osg::Vec3f generateVec3f(std::minstd_rand& random)
+        {
+            std::uniform_real_distribution<float> coordinate(-1, 1);
+            return osg::Vec3f(coordinate(random), coordinate(random), coordinate(random));
+        }
+
+        void expectNear(const osg::Vec3f& actual, const osg::Vec3f& expected)
+        {
+            EXPECT_NEAR(actual.x(), expected.x(), epsilon);
+            EXPECT_NEAR(actual.y(), expected.y(), epsilon);
+            EXPECT_NEAR(actual.z(), expected.z(), epsilon);
+        }
+
+        struct SceneUtilSkinningTest : Test
+        {
+            static constexpr std::size_t sBonesCount = 8;
+            static constexpr std::size_t sVerticesCount = 64;
+
+            std::minstd_rand mRandom;
+            std::vector<osg::Matrixf> mInvBindMatrices;
+            std::vector<osg::Matrixf> mBoneMatrices;
+            osg::Matrixf mGeomToSkel;
+            SkinInfluences mInfluences;
+            std::vector<osg::Vec3f> mSourcePositions;
+            std::vector<osg::Vec3f> mSourceNormals;
+            std::vector<osg::Vec4f> mSourceTangents;
+
+            SceneUtilSkinningTest()
+                : mGeomToSkel(generateMatrix(mRandom))
+            {
+                for (std::size_t i = 0; i < sBonesCount; ++i)
+                {
+                    mInvBindMatrices.push_back(generateMatrix(mRandom));
+                    mBoneMatrices.push_back(generateMatrix(mRandom));
+                }
+                std::uniform_int_distribution<std::size_t> weightsCount(1, 4);
+                std::uniform_int_distribution<std::uint16_t> bone(0, sBonesCount - 1);
+                std::uniform_real_distribution<float> weight(0.1f, 1);
+                for (std::size_t begin = 0; begin < sVerticesCount; begin += 4)
+                {
+                    const std::size_t count = weightsCount(mRandom);
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        mInfluences.mBones.push_back(bone(mRandom));
+                        mInfluences.mWeights.push_back(weight(mRandom) / count);
+                    }
+                    mInfluences.mWeightOffsets.push_back(static_cast<std::uint32_t>(mInfluences.mBones.size()));
+                    for (std::size_t i = begin; i < begin + 4; ++i)
+                        mInfluences.mVertices.push_back(static_cast<std::uint16_t>(i));
+                    mInfluences.mVertexOffsets.push_back(static_cast<std::uint32_t>(mInfluences.mVertices.size()));
+                }
+                std::shuffle(mInfluences.mVertices.begin(), mInfluences.mVertices.end(), mRandom);
+                for (std::size_t i = 0; i < sVerticesCount; ++i)
+                {
+                    mSourcePositions.push_back(generateVec3f(mRandom) * 100);
+                    mSourceNormals.push_back(generateVec3f(mRandom));
+                    mSourceTangents.emplace_back(generateVec3f(mRandom), i % 2 == 0 ? 1 : -1);
+                }
+            }
+
+            // Blends full matrices and transforms vertices like RigGeometry did before skinning was done with
+            // SkinTransform
+            osg::Matrixf getReferenceGroupMatrix(std::size_t group) const
+            {
+                osg::Matrixf result(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
+                for (std::uint32_t i = mInfluences.mWeightOffsets[group]; i < mInfluences.mWeightOffsets[group + 1];
+                     ++i)
+                {
+                    const std::uint16_t bone = mInfluences.mBones[i];
+                    const osg::Matrixf matrix = mInvBindMatrices[bone] * mBoneMatrices[bone];
+                    for (std::size_t j = 0; j < 16; ++j)
+                        if (j % 4 != 3)
+                            result.ptr()[j] += matrix.ptr()[j] * mInfluences.mWeights[i];
+                }
+                return result * mGeomToSkel;
+            }
+
+            std::vector<SkinTransform> getGroupTransforms() const
+            {
+                std::vector<SkinTransform> bones;
+                for (std::size_t i = 0; i < sBonesCount; ++i)
+                    bones.push_back(
+                        multiply(makeSkinTransform(mInvBindMatrices[i]), makeSkinTransform(mBoneMatrices[i])));
+                std::vector<SkinTransform> groups(mInfluences.getGroupsCount());
+                blendSkinTransforms(mInfluences, bones, groups);
+                const SkinTransform geomToSkel = makeSkinTransform(mGeomToSkel);
+                for (SkinTransform& transform : groups)
+                    transform = multiply(transform, geomToSkel);
+                return groups;
+            }
+        };
+
+        TEST_F(SceneUtilSkinningTest, multiplyShouldMatchMatrixProduct)
+        {
+            const osg::Matrixf lhs = generateMatrix(mRandom);
+            const osg::Matrixf rhs = generateMatrix(mRandom);
+            const SkinTransform expected = makeSkinTransform(lhs * rhs);
+            const SkinTransform actual = multiply(makeSkinTransform(lhs), makeSkinTransform(rhs));
+            for (std::size_t i = 0; i < expected.mValues.size(); ++i)
+                EXPECT_NEAR(actual.mValues[i], expected.mValues[i], epsilon) << i;
+        }
+
+        TEST_F(SceneUtilSkinningTest, skinVerticesShouldMatchMatrixSkinning)
+        {
+            const std::vector<SkinTransform> groups = getGroupTransforms();
+            std::vector<osg::Vec3f> positions(sVerticesCount);
+            std::vector<osg::Vec3f> normals(sVerticesCount);
+            std::vector<osg::Vec4f> tangents(sVerticesCount);
+            SkinVertices vertices;
+            vertices.mSourcePositions = mSourcePositions.data();
+            vertices.mPositions = positions.data();
+            vertices.mSourceNormals = mSourceNormals.data();
+            vertices.mNormals = normals.data();
+            vertices.mSourceTangents = mSourceTangents.data();
+            vertices.mTangents = tangents.data();
+
+            skinVertices(mInfluences, groups, vertices);
+
+            for (std::size_t group = 0; group < mInfluences.getGroupsCount(); ++group)
+            {
+                const osg::Matrixf matrix = getReferenceGroupMatrix(group);
+                for (std::uint32_t i = mInfluences.mVertexOffsets[group]; i < mInfluences.mVertexOffsets[group + 1];
+                     ++i)
+                {
+                    const std::uint16_t vertex = mInfluences.mVertices[i];
+                    expectNear(positions[vertex], matrix.preMult(mSourcePositions[vertex]));
+                    expectNear(normals[vertex], osg::Matrixf::transform3x3(mSourceNormals[vertex], matrix));
+                    const osg::Vec4f& sourceTangent = mSourceTangents[vertex];
+                    expectNear(osg::Vec3f(tangents[vertex].x(), tangents[vertex].y(), tangents[vertex].z()),
+                        osg::Matrixf::transform3x3(
+                            osg::Vec3f(sourceTangent.x(), sourceTangent.y(), sourceTangent.z()), matrix));
+                    EXPECT_EQ(tangents[vertex].w(), sourceTangent.w());
+                }
+            }
+        }
+
+        TEST_F(SceneUtilSkinningTest, skinVerticesShouldSkipMissingNormalsAndTangents)
+        {
+            const std::vector<SkinTransform> groups = getGroupTransforms();
+            std::vector<osg::Vec3f> positions(sVerticesCount);
+            SkinVertices vertices;
+            vertices.mSourcePositions = mSourcePositions.data();
+            vertices.mPositions = positions.data();
+
+            skinVertices(mInfluences, groups, vertices);
+
+            for (std::size_t group = 0; group < mInfluences.getGroupsCount(); ++group)
+            {
+                const osg::Matrixf matrix = getReferenceGroupMatrix(group);
+                for (std::uint32_t i = mInfluences.mVertexOffsets[group]; i < mInfluences.mVertexOffsets[group + 1];
+                     ++i)
+                {
+                    const std::uint16_t vertex = mInfluences.mVertices[i];
+                    expectNear(positions[vertex], matrix.preMult(mSourcePositions[vertex]));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,226 @@
+#include <components/sceneutil/workqueue.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SceneUtil
+{
+    namespace
+    {
+        using namespace ::testing;
+
+        struct Gate
+        {
+            std::mutex mMutex;
+            std::condition_variable mCondition;
+            bool mOpen = false;
+
+            void wait()
+            {
+                std::unique_lock lock(mMutex);
+                mCondition.wait(lock, [&] { return mOpen; });
+            }
+
+            void open()
+            {
+                {
+                    const std::lock_guard lock(mMutex);
+                    mOpen = true;
+                }
+                mCondition.notify_all();
+            }
+        };
+
+        struct WaitForGate final : WorkItem
+        {
+            Gate& mGate;
+
+            explicit WaitForGate(Gate& gate)
+                : mGate(gate)
+            {
+            }
+
+            void doWork() override { mGate.wait(); }
+        };
+
+        struct RecordOrder final : WorkItem
+        {
+            std::mutex& mMutex;
+            std::vector<int>& mOrder;
+            int mValue;
+
+            explicit RecordOrder(std::mutex& mutex, std::vector<int>& order, int value)
+                : mMutex(mutex)
+                , mOrder(order)
+                , mValue(value)
+            {
+            }
+
+            void doWork() override
+            {
+                const std::lock_guard lock(mMutex);
+                mOrder.push_back(mValue);
+            }
+        };
+
+        struct CountCalls final : WorkItem
+        {
+            int mCalls = 0;
+
+            void doWork() override { ++mCalls; }
+        };
+
+        TEST(SceneUtilWorkQueueTest, addedItemsShouldBeDone)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(2));
+            std::vector<osg::ref_ptr<CountCalls>> items;
+            for (int i = 0; i < 100; ++i)
+            {
+                items.emplace_back(new CountCalls);
+                queue->addWorkItem(items.back());
+            }
+            for (const osg::ref_ptr<CountCalls>& item : items)
+            {
+                item->waitTillDone();
+                EXPECT_EQ(item->mCalls, 1);
+            }
+        }
+
+        TEST(SceneUtilWorkQueueTest, itemsShouldBeStartedInOrderOfPriorityThenInOrderOfAdding)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(1));
+            Gate gate;
+            queue->addWorkItem(new WaitForGate(gate));
+            std::mutex mutex;
+            std::vector<int> order;
+            std::vector<osg::ref_ptr<WorkItem>> items;
+            const std::vector<std::pair<int, int>> valuesAndPriorities{
+                { 1, WorkPriority::Low },
+                { 2, WorkPriority::Normal },
+                { 3, WorkPriority::High },
+                { 4, WorkPriority::Normal },
+                { 5, WorkPriority::High },
+            };
+            for (const auto& [value, priority] : valuesAndPriorities)
+            {
+                items.emplace_back(new RecordOrder(mutex, order, value));
+                queue->addWorkItem(items.back(), WorkCategory::Other, priority);
+            }
+            gate.open();
+            for (const osg::ref_ptr<WorkItem>& item : items)
+                item->waitTillDone();
+            EXPECT_THAT(order, ElementsAre(3, 5, 2, 4, 1));
+        }
+
+        TEST(SceneUtilWorkQueueTest, itemsWithSamePriorityShouldBeStartedInOrderOfAddingAcrossQueues)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(2));
+            Gate gate1;
+            Gate gate2;
+            osg::ref_ptr<WorkItem> gateItem1(new WaitForGate(gate1));
+            osg::ref_ptr<WorkItem> gateItem2(new WaitForGate(gate2));
+            queue->addWorkItem(gateItem1);
+            queue->addWorkItem(gateItem2);
+            while (queue->getNumItems() > 0)
+                std::this_thread::yield();
+            std::mutex mutex;
+            std::vector<int> order;
+            std::vector<osg::ref_ptr<WorkItem>> items;
+            for (int i = 0; i < 6; ++i)
+            {
+                items.emplace_back(new RecordOrder(mutex, order, i));
+                queue->addWorkItem(items.back());
+            }
+            gate1.open();
+            for (const osg::ref_ptr<WorkItem>& item : items)
+                item->waitTillDone();
+            gate2.open();
+            gateItem2->waitTillDone();
+            EXPECT_THAT(order, ElementsAre(0, 1, 2, 3, 4, 5));
+        }
+
+        TEST(SceneUtilWorkQueueTest, itemWaitingLongerThanAgingTimeShouldBeStartedBeforeHigherPriorityItems)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(1, std::chrono::milliseconds(50)));
+            Gate gate;
+            queue->addWorkItem(new WaitForGate(gate));
+            std::mutex mutex;
+            std::vector<int> order;
+            std::vector<osg::ref_ptr<WorkItem>> items;
+            items.emplace_back(new RecordOrder(mutex, order, 1));
+            queue->addWorkItem(items.back(), WorkCategory::Unref, WorkPriority::Low);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            for (int value : { 2, 3 })
+            {
+                items.emplace_back(new RecordOrder(mutex, order, value));
+                queue->addWorkItem(items.back(), WorkCategory::Other, WorkPriority::High);
+            }
+            gate.open();
+            for (const osg::ref_ptr<WorkItem>& item : items)
+                item->waitTillDone();
+            EXPECT_THAT(order, ElementsAre(1, 2, 3));
+        }
+
+        TEST(SceneUtilWorkQueueTest, cancelledItemShouldBeDoneWithoutDoingWork)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(1));
+            Gate gate;
+            queue->addWorkItem(new WaitForGate(gate));
+            osg::ref_ptr<CountCalls> item(new CountCalls);
+            queue->addWorkItem(item, WorkCategory::CellPreload);
+            item->cancel();
+            gate.open();
+            item->waitTillDone();
+            EXPECT_EQ(item->mCalls, 0);
+            EXPECT_EQ(queue->getStats()[static_cast<std::size_t>(WorkCategory::CellPreload)].mCancelled, 1);
+        }
+
+        TEST(SceneUtilWorkQueueTest, getStatsShouldReturnNumberOfQueuedAndStartedItemsPerCategory)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(1));
+            Gate gate;
+            osg::ref_ptr<WorkItem> gateItem(new WaitForGate(gate));
+            queue->addWorkItem(gateItem, WorkCategory::Unref);
+            std::vector<osg::ref_ptr<CountCalls>> items;
+            for (int i = 0; i < 3; ++i)
+            {
+                items.emplace_back(new CountCalls);
+                queue->addWorkItem(items.back(), WorkCategory::TerrainPreload);
+            }
+            const WorkStats before = queue->getStats();
+            EXPECT_EQ(before[static_cast<std::size_t>(WorkCategory::TerrainPreload)].mQueued, 3);
+            gate.open();
+            for (const osg::ref_ptr<CountCalls>& item : items)
+                item->waitTillDone();
+            gateItem->waitTillDone();
+            const WorkStats after = queue->getStats();
+            EXPECT_EQ(after[static_cast<std::size_t>(WorkCategory::TerrainPreload)].mQueued, 0);
+            EXPECT_EQ(after[static_cast<std::size_t>(WorkCategory::TerrainPreload)].mStarted, 3);
+            EXPECT_EQ(after[static_cast<std::size_t>(WorkCategory::Unref)].mStarted, 1);
+        }
+
+        TEST(SceneUtilWorkQueueTest, idleThreadShouldStealWorkFromBusyThreadQueue)
+        {
+            osg::ref_ptr<WorkQueue> queue(new WorkQueue(2));
+            Gate gate;
+            osg::ref_ptr<WorkItem> gateItem(new WaitForGate(gate));
+            queue->addWorkItem(gateItem);
+            std::vector<osg::ref_ptr<CountCalls>> items;
+            for (int i = 0; i < 10; ++i)
+            {
+                items.emplace_back(new CountCalls);
+                queue->addWorkItem(items.back());
+            }
+            for (const osg::ref_ptr<CountCalls>& item : items)
+                item->waitTillDone();
+            gate.open();
+            gateItem->waitTillDone();
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include "../testing_util.hpp"
+
+#include <components/vfs/manager.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+
+    struct VFSManagerTest : Test
+    {
+        VFSTestFile mFile{ "content" };
+        std::unique_ptr<VFS::Manager> mVFS;
+
+        void build(bool strict, const std::vector<std::string>& names)
+        {
+            std::map<std::string, VFS::File*> files;
+            for (const std::string& name : names)
+                files.emplace(name, &mFile);
+            mVFS = std::make_unique<VFS::Manager>(strict);
+            mVFS->addArchive(std::make_unique<VFSTestData>(std::move(files)));
+            mVFS->buildIndex();
+        }
+
+        std::vector<std::string> list(std::string_view path) const
+        {
+            std::vector<std::string> result;
+            for (const std::string& name : mVFS->getRecursiveDirectoryIterator(path))
+                result.push_back(name);
+            return result;
+        }
+    };
+
+    TEST_F(VFSManagerTest, existsShouldNormalizeName)
+    {
+        build(false, { "meshes/a/b.nif" });
+        EXPECT_TRUE(mVFS->exists("meshes/a/b.nif"));
+        EXPECT_TRUE(mVFS->exists("Meshes\\A\\B.NIF"));
+        EXPECT_FALSE(mVFS->exists("meshes/a/b.ni"));
+        EXPECT_FALSE(mVFS->exists("meshes/a/b.nif2"));
+    }
+
+    TEST_F(VFSManagerTest, existsShouldBeCaseSensitiveInStrictMode)
+    {
+        build(true, { "Meshes/a.nif" });
+        EXPECT_TRUE(mVFS->exists("Meshes\\a.nif"));
+        EXPECT_FALSE(mVFS->exists("meshes/a.nif"));
+    }
+
+    TEST_F(VFSManagerTest, getShouldThrowExceptionForMissingFile)
+    {
+        build(false, { "a.txt" });
+        EXPECT_NE(mVFS->get("A.TXT"), nullptr);
+        EXPECT_THROW(mVFS->get("b.txt"), std::runtime_error);
+    }
+
+    TEST_F(VFSManagerTest, getRecursiveDirectoryIteratorShouldReturnSortedFilesWithPrefix)
+    {
+        build(false, { "a.txt", "dir/b/c.txt", "dir/a.txt", "dir/b.txt", "dir2/a.txt", "dir/b/a/d.txt", "dir.txt" });
+        EXPECT_THAT(list(""),
+            ElementsAre("a.txt", "dir.txt", "dir/a.txt", "dir/b.txt", "dir/b/a/d.txt", "dir/b/c.txt", "dir2/a.txt"));
+        EXPECT_THAT(list("Dir\\"), ElementsAre("dir/a.txt", "dir/b.txt", "dir/b/a/d.txt", "dir/b/c.txt"));
+        EXPECT_THAT(list("dir/b/"), ElementsAre("dir/b/a/d.txt", "dir/b/c.txt"));
+        EXPECT_THAT(list("dir/b"), ElementsAre("dir/b.txt", "dir/b/a/d.txt", "dir/b/c.txt"));
+        EXPECT_THAT(list("dir"),
+            ElementsAre("dir.txt", "dir/a.txt", "dir/b.txt", "dir/b/a/d.txt", "dir/b/c.txt", "dir2/a.txt"));
+        EXPECT_THAT(list("dir/b/c.txt"), ElementsAre("dir/b/c.txt"));
+    }
+
+    TEST_F(VFSManagerTest, getRecursiveDirectoryIteratorShouldReturnEmptyRangeForMissingPath)
+    {
+        build(false, { "dir/a.txt" });
+        EXPECT_THAT(list("other/"), IsEmpty());
+        EXPECT_THAT(list("dir/other/"), IsEmpty());
+        EXPECT_THAT(list("dir/b"), IsEmpty());
+        EXPECT_THAT(list("e"), IsEmpty());
+    }
+}
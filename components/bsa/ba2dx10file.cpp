@@ -639,7 +639,7 @@ namespace Bsa
         {
             if (c.packedSize != 0)
             {
-                Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.packedSize);
+                Files::IStreamPtr streamPtr = openRegion(c.offset, c.packedSize);
                 std::istream* fileStream = streamPtr.get();
 
                 boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
@@ -652,7 +652,7 @@ namespace Bsa
             // uncompressed chunk
             else
             {
-                Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, c.offset, c.size);
+                Files::IStreamPtr streamPtr = openRegion(c.offset, c.size);
                 std::istream* fileStream = streamPtr.get();
 
                 fileStream->read(memoryStreamPtr->getRawData() + offset, c.size);
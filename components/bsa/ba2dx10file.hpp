@@ -51,6 +51,7 @@ namespace Bsa
         using BSAFile::getFilename;
         using BSAFile::getList;
         using BSAFile::open;
+        using BSAFile::setUseMemoryMapping;
 
         BA2DX10File();
         virtual ~BA2DX10File();
@@ -202,8 +202,11 @@ namespace Bsa
 
     Files::IStreamPtr BA2GNRLFile::getFile(const FileRecord& fileRecord)
     {
-        Files::IStreamPtr streamPtr
-            = Files::openConstrainedFileStream(mFilepath, fileRecord.offset, fileRecord.packedSize);
+        // Uncompressed entries of memory mapped archives can be read directly from the mapping
+        if (fileRecord.packedSize == 0 && mMappedFile != nullptr)
+            return openRegion(fileRecord.offset, fileRecord.size);
+
+        Files::IStreamPtr streamPtr = openRegion(fileRecord.offset, fileRecord.packedSize);
         std::istream* fileStream = streamPtr.get();
         uint32_t uncompressedSize = fileRecord.size;
         auto memoryStreamPtr = std::make_unique<MemoryInputStream>(uncompressedSize);
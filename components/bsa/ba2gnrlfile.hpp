@@ -39,6 +39,7 @@ namespace Bsa
         using BSAFile::getFilename;
         using BSAFile::getList;
         using BSAFile::open;
+        using BSAFile::setUseMemoryMapping;
 
         BA2GNRLFile();
         virtual ~BA2GNRLFile();
@@ -25,6 +25,7 @@
 
 #include <components/esm/fourcc.hpp>
 #include <components/files/constrainedfilestream.hpp>
+#include <components/files/mappedfilestream.hpp>
 
 #include <algorithm>
 #include <cassert>
@@ -40,6 +41,13 @@ using namespace Bsa;
     throw std::runtime_error("BSA Error: " + msg + "\nArchive: " + Files::pathToUnicodeString(mFilepath));
 }
 
+Files::IStreamPtr BSAFile::openRegion(std::size_t offset, std::size_t size) const
+{
+    if (mMappedFile != nullptr)
+        return Files::openMappedFileStream(mMappedFile, offset, size);
+    return Files::openConstrainedFileStream(mFilepath, offset, size);
+}
+
 // the getHash code is from bsapack from ghostwheel
 // the code is also the same as in
 // https://github.com/arviceblot/bsatool_rs/commit/67cb59ec3aaeedc0849222ea387f031c33e48c81
@@ -241,7 +249,11 @@ void BSAFile::open(const std::filesystem::path& file)
 
     mFilepath = file;
     if (std::filesystem::exists(file))
+    {
+        if (mUseMemoryMapping)
+            mMappedFile = std::make_shared<const Files::MappedFile>(mFilepath);
         readHeader();
+    }
     else
     {
         {
@@ -260,12 +272,13 @@ void Bsa::BSAFile::close()
 
     mFiles.clear();
     mStringBuf.clear();
+    mMappedFile = nullptr;
     mIsLoaded = false;
 }
 
 Files::IStreamPtr Bsa::BSAFile::getFile(const FileStruct* file)
 {
-    return Files::openConstrainedFileStream(mFilepath, file->offset, file->fileSize);
+    return openRegion(file->offset, file->fileSize);
 }
 
 void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
@@ -273,6 +286,9 @@ void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
     if (!mIsLoaded)
         fail("Unable to add file " + filename + " the archive is not opened");
 
+    // Existing mapping doesn't cover the data written below
+    mMappedFile = nullptr;
+
     auto newStartOfDataBuffer = 12 + (12 + 8) * (mFiles.size() + 1) + mStringBuf.size() + filename.size() + 1;
     if (mFiles.empty())
         std::filesystem::resize_file(mFilepath, newStartOfDataBuffer);
@@ -26,12 +26,18 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <components/files/conversion.hpp>
 #include <components/files/istreamptr.hpp>
 
+namespace Files
+{
+    class MappedFile;
+}
+
 namespace Bsa
 {
 
@@ -96,9 +102,19 @@ namespace Bsa
         /// Used for error messages
         std::filesystem::path mFilepath;
 
+        /// Map the whole archive into memory when it is opened
+        bool mUseMemoryMapping = false;
+
+        /// Mapping of the whole archive, shared with all streams returned by openRegion
+        std::shared_ptr<const Files::MappedFile> mMappedFile;
+
         /// Error handling
         [[noreturn]] void fail(const std::string& msg) const;
 
+        /// Open a stream over a region of the archive. Returns a view into the mapping when the archive is memory
+        /// mapped and a stream reading from the file otherwise.
+        Files::IStreamPtr openRegion(std::size_t offset, std::size_t size) const;
+
         /// Read header information from the input source
         virtual void readHeader();
         virtual void writeHeader();
@@ -122,6 +138,10 @@ namespace Bsa
         /// Open an archive file.
         void open(const std::filesystem::path& file);
 
+        /// Map existing archive into memory on open() so getFile() does not need to open the file again for each
+        /// call. Has no effect on already opened archive.
+        void setUseMemoryMapping(bool value) { mUseMemoryMapping = value; }
+
         void close();
 
         /* -----------------------------------
@@ -378,7 +378,7 @@ namespace Bsa
         size_t size = fileRecord.getSizeWithoutCompressionFlag();
         size_t uncompressedSize = size;
         bool compressed = fileRecord.isCompressed(mCompressedByDefault);
-        Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilepath, fileRecord.offset, size);
+        Files::IStreamPtr streamPtr = openRegion(fileRecord.offset, size);
         std::istream* fileStream = streamPtr.get();
         if (mEmbeddedFileNames)
         {
@@ -388,6 +388,9 @@ namespace Bsa
             fileStream->ignore(length);
             size -= length + sizeof(char);
         }
+        // Uncompressed entries of memory mapped archives can be read directly from the mapping
+        if (!compressed && mMappedFile != nullptr)
+            return openRegion(fileRecord.offset + (fileRecord.getSizeWithoutCompressionFlag() - size), size);
         if (compressed)
         {
             fileStream->read(reinterpret_cast<char*>(&uncompressedSize), sizeof(uint32_t));
@@ -449,8 +452,7 @@ namespace Bsa
                 continue;
             }
 
-            Files::IStreamPtr dataBegin = Files::openConstrainedFileStream(
-                mFilepath, fileRecord.offset, fileRecord.getSizeWithoutCompressionFlag());
+            Files::IStreamPtr dataBegin = openRegion(fileRecord.offset, fileRecord.getSizeWithoutCompressionFlag());
 
             if (mEmbeddedFileNames)
             {
@@ -84,6 +84,7 @@ namespace Bsa
         using BSAFile::getFilename;
         using BSAFile::getList;
         using BSAFile::open;
+        using BSAFile::setUseMemoryMapping;
 
         CompressedBSAFile();
         virtual ~CompressedBSAFile();
@@ -3,6 +3,10 @@
 
 namespace Compiler
 {
+    /// Version of the generated code. Increment when opcodes or code generation change to discard compiled scripts
+    /// cached on disk.
+    const int codeVersion = 1;
+
     namespace Ai
     {
         const int opcodeAiTravel = 0x20000;
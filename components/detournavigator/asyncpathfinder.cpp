@@ -0,0 +1,134 @@
+#include "asyncpathfinder.hpp"
+#include "navigatorutils.hpp"
+#include "settings.hpp"
+
+#include <components/debug/debuglog.hpp>
+
+#include <iterator>
+
+namespace DetourNavigator
+{
+    AsyncPathFinder::AsyncPathFinder(const Settings& settings)
+        : mSettings(settings)
+    {
+    }
+
+    AsyncPathFinder::~AsyncPathFinder()
+    {
+        stop();
+    }
+
+    void AsyncPathFinder::post(const std::weak_ptr<GuardedNavMeshCacheItem>& navMesh, const PathRequest& request)
+    {
+        Job job{ navMesh, request };
+        if (mSettings.get().mAsyncPathFinderThreads == 0)
+        {
+            PathResult result = processJobSafe(job);
+            const std::lock_guard lock(mMutex);
+            mResults.push_back(std::move(result));
+            return;
+        }
+        const std::lock_guard lock(mMutex);
+        if (mShouldStop)
+            return;
+        if (mThreads.empty())
+            for (std::size_t i = 0; i < mSettings.get().mAsyncPathFinderThreads; ++i)
+                mThreads.emplace_back([&] { process(); });
+        mJobs.push_back(std::move(job));
+        mHasJob.notify_one();
+    }
+
+    void AsyncPathFinder::takeResults(std::vector<PathResult>& results)
+    {
+        const std::lock_guard lock(mMutex);
+        if (results.empty())
+        {
+            results.swap(mResults);
+            return;
+        }
+        std::move(mResults.begin(), mResults.end(), std::back_inserter(results));
+        mResults.clear();
+    }
+
+    void AsyncPathFinder::wait()
+    {
+        std::unique_lock lock(mMutex);
+        mDone.wait(lock, [&] { return mShouldStop || (mJobs.empty() && mProcessing == 0); });
+    }
+
+    void AsyncPathFinder::stop()
+    {
+        mShouldStop = true;
+        std::unique_lock lock(mMutex);
+        mJobs.clear();
+        mHasJob.notify_all();
+        mDone.notify_all();
+        lock.unlock();
+        for (auto& thread : mThreads)
+            if (thread.joinable())
+                thread.join();
+    }
+
+    AsyncPathFinderStats AsyncPathFinder::getStats() const
+    {
+        AsyncPathFinderStats result;
+        const std::lock_guard lock(mMutex);
+        result.mWaiting = mJobs.size();
+        result.mProcessing = mProcessing;
+        result.mDone = mResults.size();
+        return result;
+    }
+
+    void AsyncPathFinder::process() noexcept
+    {
+        Log(Debug::Debug) << "Start process path requests by thread=" << std::this_thread::get_id();
+        std::unique_lock lock(mMutex);
+        while (true)
+        {
+            mHasJob.wait(lock, [&] { return mShouldStop || !mJobs.empty(); });
+            if (mShouldStop)
+                break;
+            Job job = std::move(mJobs.front());
+            mJobs.pop_front();
+            ++mProcessing;
+            lock.unlock();
+            PathResult result = processJobSafe(job);
+            lock.lock();
+            --mProcessing;
+            mResults.push_back(std::move(result));
+            if (mJobs.empty() && mProcessing == 0)
+                mDone.notify_all();
+        }
+        Log(Debug::Debug) << "Stop path requests processing by thread=" << std::this_thread::get_id();
+    }
+
+    PathResult AsyncPathFinder::processJobSafe(const Job& job) const noexcept
+    {
+        try
+        {
+            return processJob(job);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "AsyncPathFinder::processJobSafe exception: " << e.what();
+            return PathResult{ job.mRequest.mId, Status::FindPathOverPolygonsFailed, {} };
+        }
+    }
+
+    PathResult AsyncPathFinder::processJob(const Job& job) const
+    {
+        PathResult result;
+        result.mId = job.mRequest.mId;
+        const auto navMesh = job.mNavMesh.lock();
+        if (navMesh == nullptr)
+        {
+            result.mStatus = Status::NavMeshNotFound;
+            return result;
+        }
+        const PathRequest& request = job.mRequest;
+        result.mStatus = findPath(*navMesh, mSettings.get(), request.mAgentBounds, request.mStepSize, request.mStart,
+            request.mEnd, request.mIncludeFlags, request.mAreaCosts, request.mEndTolerance,
+            std::back_inserter(result.mPath));
+        return result;
+    }
+}
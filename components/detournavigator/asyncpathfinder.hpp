@@ -0,0 +1,68 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+
+#include "pathrequest.hpp"
+#include "sharednavmeshcacheitem.hpp"
+#include "stats.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DetourNavigator
+{
+    struct Settings;
+
+    /// Finds paths in background threads. Each thread uses own navmesh query and locks navmesh only for reading so
+    /// requests over the same navmesh are processed in parallel. Threads are started by the first posted request.
+    /// With zero threads requests are processed by post on the calling thread.
+    class AsyncPathFinder
+    {
+    public:
+        explicit AsyncPathFinder(const Settings& settings);
+
+        ~AsyncPathFinder();
+
+        void post(const std::weak_ptr<GuardedNavMeshCacheItem>& navMesh, const PathRequest& request);
+
+        /// Appends results of all processed requests since the last call
+        void takeResults(std::vector<PathResult>& results);
+
+        /// Blocks until all posted requests are processed
+        void wait();
+
+        void stop();
+
+        AsyncPathFinderStats getStats() const;
+
+    private:
+        struct Job
+        {
+            std::weak_ptr<GuardedNavMeshCacheItem> mNavMesh;
+            PathRequest mRequest;
+        };
+
+        std::reference_wrapper<const Settings> mSettings;
+        std::atomic_bool mShouldStop{ false };
+        mutable std::mutex mMutex;
+        std::condition_variable mHasJob;
+        std::condition_variable mDone;
+        std::deque<Job> mJobs;
+        std::size_t mProcessing = 0;
+        std::vector<PathResult> mResults;
+        std::vector<std::thread> mThreads;
+
+        void process() noexcept;
+
+        PathResult processJobSafe(const Job& job) const noexcept;
+
+        PathResult processJob(const Job& job) const;
+    };
+}
+
+#endif
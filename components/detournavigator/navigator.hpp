@@ -6,6 +6,7 @@
 #include "heightfieldshape.hpp"
 #include "objectid.hpp"
 #include "objecttransform.hpp"
+#include "pathrequest.hpp"
 #include "recastmeshtiles.hpp"
 #include "sharednavmeshcacheitem.hpp"
 #include "updateguard.hpp"
@@ -13,6 +14,9 @@
 
 #include <components/resource/bulletshape.hpp>
 
+#include <span>
+#include <vector>
+
 namespace ESM
 {
     struct Cell;
@@ -193,6 +197,19 @@ namespace DetourNavigator
          */
         virtual std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const = 0;
 
+        /**
+         * @brief findPathsAsync schedules paths to be found by background threads. Navmesh for each request is
+         * chosen at the moment of the call. Requests with the same navmesh are processed in parallel.
+         * @param requests each has an id to match the result.
+         */
+        virtual void findPathsAsync(std::span<const PathRequest> requests) = 0;
+
+        /**
+         * @brief takePathResults appends results of requests processed since the last call.
+         * Usually results of requests made on the previous frame are available on the next one.
+         */
+        virtual void takePathResults(std::vector<PathResult>& results) = 0;
+
         virtual const Settings& getSettings() const = 0;
 
         virtual Stats getStats() const = 0;
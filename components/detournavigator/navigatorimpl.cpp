@@ -12,6 +12,7 @@ namespace DetourNavigator
     NavigatorImpl::NavigatorImpl(const Settings& settings, std::unique_ptr<NavMeshDb>&& db)
         : mSettings(settings)
         , mNavMeshManager(mSettings, std::move(db))
+        , mPathFinder(mSettings)
     {
     }
 
@@ -174,9 +175,22 @@ namespace DetourNavigator
         return mSettings;
     }
 
+    void NavigatorImpl::findPathsAsync(std::span<const PathRequest> requests)
+    {
+        for (const PathRequest& request : requests)
+            mPathFinder.post(mNavMeshManager.getNavMesh(request.mAgentBounds), request);
+    }
+
+    void NavigatorImpl::takePathResults(std::vector<PathResult>& results)
+    {
+        mPathFinder.takeResults(results);
+    }
+
     Stats NavigatorImpl::getStats() const
     {
-        return mNavMeshManager.getStats();
+        Stats result = mNavMeshManager.getStats();
+        result.mPathFinder = mPathFinder.getStats();
+        return result;
     }
 
     RecastMeshTiles NavigatorImpl::getRecastMeshTiles() const
@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVIGATORIMPL_H
 #define OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVIGATORIMPL_H
 
+#include "asyncpathfinder.hpp"
 #include "navigator.hpp"
 #include "navmeshmanager.hpp"
 #include "updateguard.hpp"
@@ -67,6 +68,13 @@ namespace DetourNavigator
 
         std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const override;
 
+        void findPathsAsync(std::span<const PathRequest> requests) override;
+
+        void takePathResults(std::vector<PathResult>& results) override;
+
+        /// Blocks until all path requests are processed
+        void waitPathResults() { mPathFinder.wait(); }
+
         const Settings& getSettings() const override;
 
         Stats getStats() const override;
@@ -78,6 +86,7 @@ namespace DetourNavigator
     private:
         Settings mSettings;
         NavMeshManager mNavMeshManager;
+        AsyncPathFinder mPathFinder;
         std::optional<TilePosition> mLastPlayerPosition;
         std::map<AgentBounds, std::size_t> mAgents;
         std::unordered_map<ObjectId, ObjectId> mAvoidIds;
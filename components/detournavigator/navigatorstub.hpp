@@ -6,6 +6,9 @@
 #include "stats.hpp"
 #include "updateguard.hpp"
 
+#include <iterator>
+#include <vector>
+
 namespace Loading
 {
     class Listener;
@@ -79,6 +82,18 @@ namespace DetourNavigator
 
         std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const override { return {}; }
 
+        void findPathsAsync(std::span<const PathRequest> requests) override
+        {
+            for (const PathRequest& request : requests)
+                mPathResults.push_back(PathResult{ request.mId, Status::NavMeshNotFound, {} });
+        }
+
+        void takePathResults(std::vector<PathResult>& results) override
+        {
+            std::move(mPathResults.begin(), mPathResults.end(), std::back_inserter(results));
+            mPathResults.clear();
+        }
+
         const Settings& getSettings() const override { return mDefaultSettings; }
 
         Stats getStats() const override { return Stats{}; }
@@ -90,6 +105,7 @@ namespace DetourNavigator
     private:
         Settings mDefaultSettings{};
         SharedNavMeshCacheItem mEmptyNavMeshCacheItem;
+        std::vector<PathResult> mPathResults;
     };
 }
 
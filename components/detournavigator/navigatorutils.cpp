@@ -1,6 +1,7 @@
 #include "navigatorutils.hpp"
 #include "findrandompointaroundcircle.hpp"
 #include "navigator.hpp"
+#include "navmeshquerycache.hpp"
 #include "raycast.hpp"
 
 namespace DetourNavigator
@@ -12,8 +13,11 @@ namespace DetourNavigator
         if (!navMesh)
             return std::nullopt;
         const Settings& settings = navigator.getSettings();
-        const auto locked = navMesh->lock();
-        const auto result = DetourNavigator::findRandomPointAroundCircle(locked->getQuery(),
+        const auto locked = navMesh->lockConst();
+        const dtNavMeshQuery* const query = getNavMeshQuery(locked->getImpl(), settings.mDetour.mMaxNavMeshQueryNodes);
+        if (query == nullptr)
+            return std::nullopt;
+        const auto result = DetourNavigator::findRandomPointAroundCircle(*query,
             toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
             toNavMeshCoordinates(settings.mRecast, start), toNavMeshCoordinates(settings.mRecast, maxRadius),
             includeFlags, prng);
@@ -29,8 +33,11 @@ namespace DetourNavigator
         if (navMesh == nullptr)
             return std::nullopt;
         const Settings& settings = navigator.getSettings();
-        const auto locked = navMesh->lock();
-        const auto result = DetourNavigator::raycast(locked->getQuery(),
+        const auto locked = navMesh->lockConst();
+        const dtNavMeshQuery* const query = getNavMeshQuery(locked->getImpl(), settings.mDetour.mMaxNavMeshQueryNodes);
+        if (query == nullptr)
+            return std::nullopt;
+        const auto result = DetourNavigator::raycast(*query,
             toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
             toNavMeshCoordinates(settings.mRecast, start), toNavMeshCoordinates(settings.mRecast, end), includeFlags);
         if (!result)
@@ -5,6 +5,7 @@
 #include "flags.hpp"
 #include "navigator.hpp"
 #include "navmeshcacheitem.hpp"
+#include "navmeshquerycache.hpp"
 #include "settings.hpp"
 
 #include <components/misc/guarded.hpp>
@@ -15,6 +16,8 @@ namespace DetourNavigator
 {
     /**
      * @brief findPath fills output iterator with points of scene surfaces to be used for actor to walk through.
+     * Navmesh is locked for reading only so multiple threads can find paths over the same navmesh at the same time.
+     * @param navMesh is a navmesh to find path over.
      * @param agentBounds allows to find navmesh for given actor.
      * @param start path from given point.
      * @param end path at given point.
@@ -25,24 +28,46 @@ namespace DetourNavigator
      * Equal to out if no path is found.
      */
     template <class OutputIterator>
-    inline Status findPath(const Navigator& navigator, const AgentBounds& agentBounds, const float stepSize,
-        const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts,
-        float endTolerance, OutputIterator out)
+    inline Status findPath(const GuardedNavMeshCacheItem& navMesh, const Settings& settings,
+        const AgentBounds& agentBounds, const float stepSize, const osg::Vec3f& start, const osg::Vec3f& end,
+        const Flags includeFlags, const AreaCosts& areaCosts, float endTolerance, OutputIterator out)
     {
         static_assert(std::is_same<typename std::iterator_traits<OutputIterator>::iterator_category,
                           std::output_iterator_tag>::value,
             "out is not an OutputIterator");
-        const auto navMesh = navigator.getNavMesh(agentBounds);
-        if (navMesh == nullptr)
-            return Status::NavMeshNotFound;
-        const Settings& settings = navigator.getSettings();
-        const auto locked = navMesh->lock();
-        return findSmoothPath(locked->getImpl(), locked->getQuery(),
+        const auto locked = navMesh.lockConst();
+        const dtNavMeshQuery* const query = getNavMeshQuery(locked->getImpl(), settings.mDetour.mMaxNavMeshQueryNodes);
+        if (query == nullptr)
+            return Status::InitNavMeshQueryFailed;
+        return findSmoothPath(locked->getImpl(), *query,
             toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
             toNavMeshCoordinates(settings.mRecast, stepSize), toNavMeshCoordinates(settings.mRecast, start),
             toNavMeshCoordinates(settings.mRecast, end), includeFlags, areaCosts, settings, endTolerance, out);
     }
 
+    /**
+     * @brief findPath fills output iterator with points of scene surfaces to be used for actor to walk through.
+     * @param agentBounds allows to find navmesh for given actor.
+     * @param start path from given point.
+     * @param end path at given point.
+     * @param includeFlags setup allowed surfaces for actor to walk.
+     * @param out the beginning of the destination range.
+     * @param endTolerance defines maximum allowed distance to end path point in addition to agentHalfExtents
+     * @return Output iterator to the element in the destination range, one past the last element of found path.
+     * Equal to out if no path is found.
+     */
+    template <class OutputIterator>
+    inline Status findPath(const Navigator& navigator, const AgentBounds& agentBounds, const float stepSize,
+        const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts,
+        float endTolerance, OutputIterator out)
+    {
+        const auto navMesh = navigator.getNavMesh(agentBounds);
+        if (navMesh == nullptr)
+            return Status::NavMeshNotFound;
+        return findPath(*navMesh, navigator.getSettings(), agentBounds, stepSize, start, end, includeFlags, areaCosts,
+            endTolerance, out);
+    }
+
     /**
      * @brief findRandomPointAroundCircle returns random location on navmesh within the reach of specified location.
      * @param agentBounds allows to find navmesh for given actor.
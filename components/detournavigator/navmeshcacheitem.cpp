@@ -10,7 +10,6 @@
 #include <DetourNavMesh.h>
 
 #include <ostream>
-#include <sstream>
 
 namespace
 {
@@ -74,14 +73,6 @@ namespace DetourNavigator
         : mVersion{ generation, 0 }
     {
         initEmptyNavMesh(settings, mImpl);
-
-        if (const dtStatus status = mQuery.init(&mImpl, settings.mDetour.mMaxNavMeshQueryNodes);
-            !dtStatusSucceed(status))
-        {
-            std::ostringstream error;
-            error << "Failed to init navmesh query: " << WriteDtStatus{ status };
-            throw std::runtime_error(error.str());
-        }
     }
 
     UpdateNavMeshStatus NavMeshCacheItem::updateTile(
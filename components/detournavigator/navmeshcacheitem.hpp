@@ -7,7 +7,6 @@
 #include "version.hpp"
 
 #include <DetourNavMesh.h>
-#include <DetourNavMeshQuery.h>
 
 #include <iosfwd>
 #include <map>
@@ -110,8 +109,6 @@ namespace DetourNavigator
 
         const dtNavMesh& getImpl() const { return mImpl; }
 
-        dtNavMeshQuery& getQuery() { return mQuery; }
-
         const Version& getVersion() const { return mVersion; }
 
         UpdateNavMeshStatus updateTile(
@@ -141,7 +138,6 @@ namespace DetourNavigator
 
         Version mVersion;
         dtNavMesh mImpl;
-        dtNavMeshQuery mQuery;
         std::map<TilePosition, Tile> mUsedTiles;
         std::set<TilePosition> mEmptyTiles;
     };
@@ -0,0 +1,15 @@
+#include "navmeshquerycache.hpp"
+#include "findsmoothpath.hpp"
+
+#include <DetourNavMeshQuery.h>
+
+namespace DetourNavigator
+{
+    dtNavMeshQuery* getNavMeshQuery(const dtNavMesh& navMesh, int maxNodes)
+    {
+        thread_local dtNavMeshQuery query;
+        if (!initNavMeshQuery(query, navMesh, maxNodes))
+            return nullptr;
+        return &query;
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVMESHQUERYCACHE_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_NAVMESHQUERYCACHE_H
+
+class dtNavMesh;
+class dtNavMeshQuery;
+
+namespace DetourNavigator
+{
+    /**
+     * @brief getNavMeshQuery returns navmesh query owned by the calling thread initialized for given navmesh.
+     * Node pool allocated by the query is reused when it has enough nodes so reinitialization costs only clearing.
+     * Returned query is valid until the next call from the same thread.
+     * @return nullptr if the query initialization is failed.
+     */
+    dtNavMeshQuery* getNavMeshQuery(const dtNavMesh& navMesh, int maxNodes);
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHREQUEST_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHREQUEST_H
+
+#include "agentbounds.hpp"
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "status.hpp"
+
+#include <osg/Vec3f>
+
+#include <cstddef>
+#include <vector>
+
+namespace DetourNavigator
+{
+    struct PathRequest
+    {
+        // Defined by the caller to match result with request
+        std::size_t mId = 0;
+        AgentBounds mAgentBounds;
+        float mStepSize = 0;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mIncludeFlags = Flag_none;
+        AreaCosts mAreaCosts;
+        float mEndTolerance = 0;
+    };
+
+    struct PathResult
+    {
+        std::size_t mId = 0;
+        Status mStatus = Status::NavMeshNotFound;
+        std::vector<osg::Vec3f> mPath;
+    };
+}
+
+#endif
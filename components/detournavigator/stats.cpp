@@ -30,11 +30,20 @@ namespace DetourNavigator
             out.setAttribute(frameNumber, "NavMesh Cache Get", static_cast<double>(stats.mCache.mGetCount));
             out.setAttribute(frameNumber, "NavMesh Cache Hit", static_cast<double>(stats.mCache.mHitCount));
         }
+
+        void reportStats(const AsyncPathFinderStats& stats, unsigned int frameNumber, osg::Stats& out)
+        {
+            out.setAttribute(frameNumber, "NavMesh Path Waiting", static_cast<double>(stats.mWaiting));
+            out.setAttribute(frameNumber, "NavMesh Path Processing", static_cast<double>(stats.mProcessing));
+            out.setAttribute(frameNumber, "NavMesh Path Done", static_cast<double>(stats.mDone));
+        }
     }
 
     void reportStats(const Stats& stats, unsigned int frameNumber, osg::Stats& out)
     {
         if (stats.mUpdater.has_value())
             reportStats(*stats.mUpdater, frameNumber, out);
+        if (stats.mPathFinder.has_value())
+            reportStats(*stats.mPathFinder, frameNumber, out);
     }
 }
@@ -43,9 +43,17 @@ namespace DetourNavigator
         NavMeshTilesCacheStats mCache;
     };
 
+    struct AsyncPathFinderStats
+    {
+        std::size_t mWaiting = 0;
+        std::size_t mProcessing = 0;
+        std::size_t mDone = 0;
+    };
+
     struct Stats
     {
         std::optional<AsyncNavMeshUpdaterStats> mUpdater;
+        std::optional<AsyncPathFinderStats> mPathFinder;
     };
 
     void reportStats(const Stats& stats, unsigned int frameNumber, osg::Stats& out);
@@ -0,0 +1,185 @@
+#include "compressedstream.hpp"
+
+#include <lz4frame.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+
+namespace ESM
+{
+    namespace
+    {
+        constexpr std::size_t sBufferSize = 64 * 1024;
+
+        void checkLz4Result(std::size_t result, std::string_view operation)
+        {
+            if (LZ4F_isError(result))
+                throw std::runtime_error(
+                    "LZ4 " + std::string(operation) + " error: " + std::string(LZ4F_getErrorName(result)));
+        }
+
+        class Lz4InputStreamBuf final : public std::streambuf
+        {
+        public:
+            explicit Lz4InputStreamBuf(
+                std::unique_ptr<std::istream>&& source, std::size_t compressedSize, std::streamoff baseOffset)
+                : mSource(std::move(source))
+                , mLeftCompressed(compressedSize)
+                , mPosition(baseOffset)
+                , mInput(sBufferSize)
+                , mOutput(sBufferSize)
+            {
+                checkLz4Result(LZ4F_createDecompressionContext(&mContext, LZ4F_VERSION), "decompression");
+                setg(mOutput.data(), mOutput.data(), mOutput.data());
+            }
+
+            ~Lz4InputStreamBuf() override { LZ4F_freeDecompressionContext(mContext); }
+
+        protected:
+            int_type underflow() override
+            {
+                if (gptr() < egptr())
+                    return traits_type::to_int_type(*gptr());
+
+                mPosition += egptr() - eback();
+                setg(mOutput.data(), mOutput.data(), mOutput.data());
+
+                while (!mFrameEnd)
+                {
+                    if (mInputBegin == mInputEnd)
+                    {
+                        if (mLeftCompressed == 0)
+                            throw std::runtime_error("Unexpected end of LZ4 compressed data");
+                        const std::size_t size = std::min(mInput.size(), mLeftCompressed);
+                        mSource->read(mInput.data(), static_cast<std::streamsize>(size));
+                        if (mSource->gcount() != static_cast<std::streamsize>(size))
+                            throw std::runtime_error("Failed to read LZ4 compressed data");
+                        mLeftCompressed -= size;
+                        mInputBegin = 0;
+                        mInputEnd = size;
+                    }
+
+                    std::size_t outputSize = mOutput.size();
+                    std::size_t inputSize = mInputEnd - mInputBegin;
+                    const std::size_t result = LZ4F_decompress(
+                        mContext, mOutput.data(), &outputSize, mInput.data() + mInputBegin, &inputSize, nullptr);
+                    checkLz4Result(result, "decompression");
+                    mInputBegin += inputSize;
+                    mFrameEnd = result == 0;
+
+                    if (outputSize > 0)
+                    {
+                        setg(mOutput.data(), mOutput.data(), mOutput.data() + outputSize);
+                        return traits_type::to_int_type(*gptr());
+                    }
+                }
+
+                return traits_type::eof();
+            }
+
+            pos_type seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+            {
+                const off_type current = mPosition + (gptr() - eback());
+                if (dir == std::ios_base::cur)
+                    return seekpos(current + offset, which);
+                if (dir == std::ios_base::beg)
+                    return seekpos(offset, which);
+                return pos_type(off_type(-1));
+            }
+
+            pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+            {
+                if (!(which & std::ios_base::in))
+                    return pos_type(off_type(-1));
+
+                off_type current = mPosition + (gptr() - eback());
+                const off_type target = position;
+                if (target < current)
+                    return pos_type(off_type(-1));
+
+                // Decompress and drop the data until the target is reached
+                while (current < target)
+                {
+                    if (gptr() == egptr() && traits_type::eq_int_type(underflow(), traits_type::eof()))
+                        return pos_type(off_type(-1));
+                    const off_type step = std::min<off_type>(target - current, egptr() - gptr());
+                    gbump(static_cast<int>(step));
+                    current += step;
+                }
+
+                return pos_type(current);
+            }
+
+        private:
+            std::unique_ptr<std::istream> mSource;
+            std::size_t mLeftCompressed;
+            off_type mPosition;
+            LZ4F_dctx* mContext = nullptr;
+            std::vector<char> mInput;
+            std::size_t mInputBegin = 0;
+            std::size_t mInputEnd = 0;
+            std::vector<char> mOutput;
+            bool mFrameEnd = false;
+        };
+
+        class Lz4InputStream final : public std::istream
+        {
+        public:
+            explicit Lz4InputStream(
+                std::unique_ptr<std::istream>&& source, std::size_t compressedSize, std::streamoff baseOffset)
+                : std::istream(nullptr)
+                , mBuffer(std::move(source), compressedSize, baseOffset)
+            {
+                init(&mBuffer);
+                // Decompression errors are reported by exceptions from the stream buffer, let them through
+                exceptions(std::ios_base::badbit);
+            }
+
+        private:
+            Lz4InputStreamBuf mBuffer;
+        };
+    }
+
+    Lz4FrameCompressor::Lz4FrameCompressor()
+    {
+        checkLz4Result(LZ4F_createCompressionContext(&mContext, LZ4F_VERSION), "compression");
+    }
+
+    Lz4FrameCompressor::~Lz4FrameCompressor()
+    {
+        LZ4F_freeCompressionContext(mContext);
+    }
+
+    std::string_view Lz4FrameCompressor::begin()
+    {
+        mBuffer.resize(LZ4F_HEADER_SIZE_MAX);
+        const std::size_t size = LZ4F_compressBegin(mContext, mBuffer.data(), mBuffer.size(), nullptr);
+        checkLz4Result(size, "compression");
+        return std::string_view(mBuffer.data(), size);
+    }
+
+    std::string_view Lz4FrameCompressor::update(std::string_view data)
+    {
+        mBuffer.resize(LZ4F_compressBound(data.size(), nullptr));
+        const std::size_t size
+            = LZ4F_compressUpdate(mContext, mBuffer.data(), mBuffer.size(), data.data(), data.size(), nullptr);
+        checkLz4Result(size, "compression");
+        return std::string_view(mBuffer.data(), size);
+    }
+
+    std::string_view Lz4FrameCompressor::end()
+    {
+        mBuffer.resize(LZ4F_compressBound(0, nullptr));
+        const std::size_t size = LZ4F_compressEnd(mContext, mBuffer.data(), mBuffer.size(), nullptr);
+        checkLz4Result(size, "compression");
+        return std::string_view(mBuffer.data(), size);
+    }
+
+    std::unique_ptr<std::istream> makeLz4InputStream(
+        std::unique_ptr<std::istream>&& source, std::size_t compressedSize, std::streamoff baseOffset)
+    {
+        return std::make_unique<Lz4InputStream>(std::move(source), compressedSize, baseOffset);
+    }
+}
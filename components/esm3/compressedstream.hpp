@@ -0,0 +1,44 @@
+#ifndef OPENMW_COMPONENTS_ESM3_COMPRESSEDSTREAM_H
+#define OPENMW_COMPONENTS_ESM3_COMPRESSEDSTREAM_H
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+struct LZ4F_cctx_s;
+
+namespace ESM
+{
+    /// Compresses data into a single LZ4 frame in a streaming way. Each call returns the next part of the frame which
+    /// stays valid until the next call.
+    class Lz4FrameCompressor
+    {
+    public:
+        Lz4FrameCompressor();
+
+        ~Lz4FrameCompressor();
+
+        Lz4FrameCompressor(const Lz4FrameCompressor&) = delete;
+
+        Lz4FrameCompressor& operator=(const Lz4FrameCompressor&) = delete;
+
+        std::string_view begin();
+
+        std::string_view update(std::string_view data);
+
+        std::string_view end();
+
+    private:
+        LZ4F_cctx_s* mContext = nullptr;
+        std::vector<char> mBuffer;
+    };
+
+    /// Returns stream decompressing LZ4 frame of compressedSize bytes from the current position of the source.
+    /// Positions reported by the returned stream start from baseOffset. Only forward seeking is supported.
+    std::unique_ptr<std::istream> makeLz4InputStream(
+        std::unique_ptr<std::istream>&& source, std::size_t compressedSize, std::streamoff baseOffset);
+}
+
+#endif
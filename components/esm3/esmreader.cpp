@@ -1,5 +1,6 @@
 #include "esmreader.hpp"
 
+#include "compressedstream.hpp"
 #include "readerscache.hpp"
 #include "savedgame.hpp"
 
@@ -362,9 +363,40 @@ namespace ESM
         // record.
         mCtx.subCached = false;
 
+        if (mCtx.recName == REC_LZ4C)
+        {
+            if (getFormatVersion() <= MaxUncompressedSaveGameFormatVersion)
+                fail("Compressed record is not supported by format version " + std::to_string(getFormatVersion()));
+            getRecHeader();
+            startDecompression();
+            return getRecName();
+        }
+
         return mCtx.recName;
     }
 
+    void ESMReader::startDecompression()
+    {
+        if (mCtx.leftFile != 0)
+            fail("Compressed records must be at the end of file");
+
+        std::uint64_t size = 0;
+        if (mCtx.leftRec < static_cast<std::streamsize>(sizeof(size)))
+            fail("Compressed record is too small");
+        getT(size);
+
+        const std::size_t compressedSize = static_cast<std::size_t>(mCtx.leftRec) - sizeof(size);
+        mCtx.leftRec = 0;
+
+        // Offsets continue from the beginning of the compressed record as if the records were stored in place of it
+        const std::streamoff offset = static_cast<std::streamoff>(mEsm->tellg())
+            - static_cast<std::streamoff>(decltype(mCtx.recName)::sCapacity + 3 * sizeof(std::uint32_t) + sizeof(size));
+        mEsm = makeLz4InputStream(std::move(mEsm), compressedSize, offset);
+
+        mCtx.leftFile = static_cast<std::streamsize>(size);
+        mFileSize = static_cast<std::size_t>(offset) + size;
+    }
+
     void ESMReader::skipRecord()
     {
         skip(mCtx.leftRec);
@@ -324,6 +324,9 @@ namespace ESM
 
         void clearCtx();
 
+        // Replaces the stream by the decompressed content of the current record, see REC_LZ4C
+        void startDecompression();
+
         RefId getRefIdImpl(std::size_t size);
 
         std::unique_ptr<std::istream> mEsm;
@@ -0,0 +1,282 @@
+#include "chunkcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/files/conversion.hpp>
+#include <components/files/mappedfilestream.hpp>
+
+#include <extern/smhasher/MurmurHash3.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ESMTerrain
+{
+    namespace
+    {
+        constexpr char sMagic[8] = { 'O', 'M', 'W', 'T', 'E', 'R', 'R', 'C' };
+
+        // Increment when the file layout or the way vertex buffers are generated changes
+        constexpr std::uint32_t sVersion = 1;
+
+        struct Header
+        {
+            char mMagic[sizeof(sMagic)];
+            std::uint32_t mVersion;
+            std::uint32_t mEntriesCount;
+            std::uint64_t mDataSize;
+        };
+
+        static_assert(std::is_trivially_copyable_v<Header>);
+        static_assert(sizeof(osg::Vec3f) == 12);
+        static_assert(sizeof(osg::Vec4ub) == 4);
+
+        constexpr std::size_t sVertexSize = 2 * sizeof(osg::Vec3f) + sizeof(osg::Vec4ub);
+
+        template <class T>
+        void copyFrom(const char* data, std::uint32_t count, osg::TemplateArray<T>& array)
+        {
+            array.resize(count);
+            std::memcpy(&array.front(), data, count * sizeof(T));
+        }
+
+        template <class T>
+        void write(std::ostream& stream, const T* values, std::size_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            stream.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(sizeof(T) * count));
+        }
+    }
+
+    void ChunkKeyBuilder::add(const void* data, std::size_t size)
+    {
+        ChunkKey result{ 0, 0 };
+        MurmurHash3_x64_128(data, static_cast<int>(size), mKey.data(), result.data());
+        mKey = result;
+    }
+
+    ChunkCache::ChunkCache(const std::filesystem::path& path, std::size_t maxSize)
+        : mPath(path)
+        , mMaxSize(maxSize)
+    {
+        std::error_code ec;
+        if (!std::filesystem::exists(mPath, ec))
+            return;
+
+        try
+        {
+            load();
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Ignoring terrain chunk cache \"" << Files::pathToUnicodeString(mPath)
+                                << "\": " << e.what();
+            mFile = nullptr;
+            mEntries = {};
+            mData = nullptr;
+        }
+    }
+
+    ChunkCache::~ChunkCache() = default;
+
+    void ChunkCache::load()
+    {
+        mFile = std::make_unique<Files::MappedFile>(mPath);
+
+        const char* const begin = mFile->data();
+        const std::size_t size = mFile->size();
+
+        Header header;
+        if (size < sizeof(header))
+            throw std::runtime_error("Unexpected end of file");
+        std::memcpy(&header, begin, sizeof(header));
+        if (std::memcmp(header.mMagic, sMagic, sizeof(sMagic)) != 0)
+            throw std::runtime_error("Invalid magic");
+        if (header.mVersion != sVersion)
+            throw std::runtime_error("Unsupported version: " + std::to_string(header.mVersion));
+
+        const std::size_t entriesSize = header.mEntriesCount * sizeof(Entry);
+        if (entriesSize > size - sizeof(header) || header.mDataSize != size - sizeof(header) - entriesSize)
+            throw std::runtime_error("Unexpected end of file");
+
+        const std::span<const Entry> entries(
+            reinterpret_cast<const Entry*>(begin + sizeof(header)), header.mEntriesCount);
+        for (const Entry& entry : entries)
+            if (entry.mOffset > header.mDataSize
+                || entry.mVertexCount > (header.mDataSize - entry.mOffset) / sVertexSize)
+                throw std::runtime_error("Invalid entry range");
+        if (std::adjacent_find(entries.begin(), entries.end(),
+                [](const Entry& l, const Entry& r) { return l.mKey >= r.mKey; })
+            != entries.end())
+            throw std::runtime_error("Entries are not sorted");
+
+        mEntries = entries;
+        mData = begin + sizeof(header) + entriesSize;
+        mUsed = std::make_unique<std::atomic_bool[]>(mEntries.size());
+
+        Log(Debug::Verbose) << "Loaded " << mEntries.size() << " terrain chunks from \""
+                            << Files::pathToUnicodeString(mPath) << "\"";
+    }
+
+    bool ChunkCache::get(
+        const ChunkKey& key, osg::Vec3Array& positions, osg::Vec3Array& normals, osg::Vec4ubArray& colours) const
+    {
+        const std::shared_lock lock(mMutex);
+
+        const auto entry = std::lower_bound(mEntries.begin(), mEntries.end(), key,
+            [](const Entry& entry, const ChunkKey& value) { return entry.mKey < value; });
+        if (entry != mEntries.end() && entry->mKey == key)
+        {
+            const char* data = mData + entry->mOffset;
+            copyFrom(data, entry->mVertexCount, positions);
+            data += entry->mVertexCount * sizeof(osg::Vec3f);
+            copyFrom(data, entry->mVertexCount, normals);
+            data += entry->mVertexCount * sizeof(osg::Vec3f);
+            copyFrom(data, entry->mVertexCount, colours);
+            mUsed[entry - mEntries.begin()].store(true, std::memory_order_relaxed);
+            return true;
+        }
+
+        const auto chunk = mAdded.find(key);
+        if (chunk == mAdded.end())
+            return false;
+
+        positions.assign(chunk->second.mPositions.begin(), chunk->second.mPositions.end());
+        normals.assign(chunk->second.mNormals.begin(), chunk->second.mNormals.end());
+        colours.assign(chunk->second.mColours.begin(), chunk->second.mColours.end());
+        return true;
+    }
+
+    void ChunkCache::add(const ChunkKey& key, const osg::Vec3Array& positions, const osg::Vec3Array& normals,
+        const osg::Vec4ubArray& colours)
+    {
+        if (positions.empty() || positions.size() != normals.size() || positions.size() != colours.size()
+            || positions.size() > std::numeric_limits<std::uint32_t>::max())
+            return;
+
+        const std::unique_lock lock(mMutex);
+
+        if (mClosed)
+            return;
+
+        const std::size_t size = sizeof(Entry) + positions.size() * sVertexSize;
+        if (sizeof(Header) + mAddedSize + size > mMaxSize || mAdded.contains(key))
+            return;
+
+        mAdded.emplace(key,
+            Chunk{ std::vector<osg::Vec3f>(positions.begin(), positions.end()),
+                std::vector<osg::Vec3f>(normals.begin(), normals.end()),
+                std::vector<osg::Vec4ub>(colours.begin(), colours.end()) });
+        mAddedSize += size;
+    }
+
+    std::size_t ChunkCache::getAddedCount() const
+    {
+        const std::shared_lock lock(mMutex);
+        return mAdded.size();
+    }
+
+    void ChunkCache::save()
+    {
+        const std::unique_lock lock(mMutex);
+
+        mClosed = true;
+
+        if (mAdded.empty())
+            return;
+
+        struct Source
+        {
+            ChunkKey mKey;
+            std::uint32_t mVertexCount;
+            const Entry* mEntry;
+            const Chunk* mChunk;
+        };
+
+        std::vector<Source> sources;
+        std::size_t dataSize = 0;
+        const auto select = [&](Source source) {
+            const std::size_t size = sizeof(Entry) + source.mVertexCount * sVertexSize;
+            if (sizeof(Header) + dataSize + size > mMaxSize)
+                return;
+            dataSize += size;
+            sources.push_back(source);
+        };
+
+        for (std::size_t i = 0; i < mEntries.size(); ++i)
+            if (mUsed[i].load(std::memory_order_relaxed))
+                select(Source{ mEntries[i].mKey, mEntries[i].mVertexCount, &mEntries[i], nullptr });
+        for (const auto& [key, chunk] : mAdded)
+            select(Source{ key, static_cast<std::uint32_t>(chunk.mPositions.size()), nullptr, &chunk });
+        for (std::size_t i = 0; i < mEntries.size(); ++i)
+            if (!mUsed[i].load(std::memory_order_relaxed))
+                select(Source{ mEntries[i].mKey, mEntries[i].mVertexCount, &mEntries[i], nullptr });
+
+        std::sort(sources.begin(), sources.end(), [](const Source& l, const Source& r) { return l.mKey < r.mKey; });
+        sources.erase(std::unique(sources.begin(), sources.end(),
+                          [](const Source& l, const Source& r) { return l.mKey == r.mKey; }),
+            sources.end());
+
+        std::filesystem::path tmpPath = mPath;
+        tmpPath += ".tmp";
+
+        try
+        {
+            std::ofstream stream(tmpPath, std::ios::binary);
+            stream.exceptions(std::ios::failbit | std::ios::badbit);
+
+            Header header;
+            std::memcpy(header.mMagic, sMagic, sizeof(sMagic));
+            header.mVersion = sVersion;
+            header.mEntriesCount = static_cast<std::uint32_t>(sources.size());
+            header.mDataSize = 0;
+            for (const Source& source : sources)
+                header.mDataSize += source.mVertexCount * sVertexSize;
+            write(stream, &header, 1);
+
+            std::uint64_t offset = 0;
+            for (const Source& source : sources)
+            {
+                const Entry entry{ source.mKey, offset, source.mVertexCount, 0 };
+                write(stream, &entry, 1);
+                offset += source.mVertexCount * sVertexSize;
+            }
+
+            for (const Source& source : sources)
+            {
+                if (source.mEntry != nullptr)
+                    write(stream, mData + source.mEntry->mOffset, source.mVertexCount * sVertexSize);
+                else
+                {
+                    write(stream, source.mChunk->mPositions.data(), source.mVertexCount);
+                    write(stream, source.mChunk->mNormals.data(), source.mVertexCount);
+                    write(stream, source.mChunk->mColours.data(), source.mVertexCount);
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            throw std::runtime_error("Failed to write terrain chunk cache \"" + Files::pathToUnicodeString(tmpPath)
+                + "\": " + e.what());
+        }
+
+        // The file can't be replaced while it is mapped on some platforms
+        mEntries = {};
+        mData = nullptr;
+        mUsed = nullptr;
+        mFile = nullptr;
+        mAdded.clear();
+        mAddedSize = 0;
+
+        std::filesystem::rename(tmpPath, mPath);
+
+        Log(Debug::Verbose) << "Saved " << sources.size() << " terrain chunks to \""
+                            << Files::pathToUnicodeString(mPath) << "\"";
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef OPENMW_COMPONENTS_ESM3TERRAIN_CHUNKCACHE_H
+#define OPENMW_COMPONENTS_ESM3TERRAIN_CHUNKCACHE_H
+
+#include <osg/Array>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Files
+{
+    class MappedFile;
+}
+
+namespace ESMTerrain
+{
+    /// Stable hash of everything the generated chunk geometry depends on
+    using ChunkKey = std::array<std::uint64_t, 2>;
+
+    /// Builds ChunkKey from a sequence of values. The result does not depend on the platform for the same input.
+    class ChunkKeyBuilder
+    {
+    public:
+        void add(const void* data, std::size_t size);
+
+        template <class T>
+        void add(std::span<const T> values)
+        {
+            add(values.data(), values.size_bytes());
+        }
+
+        void add(std::string_view value) { add(value.data(), value.size()); }
+
+        const ChunkKey& getKey() const { return mKey; }
+
+    private:
+        ChunkKey mKey{ 0, 0 };
+    };
+
+    /// Persistent cache of terrain chunk vertex buffers. Entries loaded from the file are accessed through a read-only
+    /// memory mapping, entries generated in this session are kept in memory until save() writes them all into a new
+    /// file. get() and add() are thread-safe.
+    class ChunkCache
+    {
+    public:
+        /// Maps the cache file if it exists. An invalid or outdated file is ignored and will be replaced on save.
+        /// @param maxSize limit of the file size in bytes
+        explicit ChunkCache(const std::filesystem::path& path, std::size_t maxSize);
+
+        ~ChunkCache();
+
+        /// Fills the buffers and returns true when the entry exists.
+        bool get(const ChunkKey& key, osg::Vec3Array& positions, osg::Vec3Array& normals,
+            osg::Vec4ubArray& colours) const;
+
+        /// Ignores the entry when entries added in this session would not fit the size limit, so memory used by
+        /// them is bounded as well.
+        void add(const ChunkKey& key, const osg::Vec3Array& positions, const osg::Vec3Array& normals,
+            const osg::Vec4ubArray& colours);
+
+        /// Writes entries used or added in this session first, then the rest of the old ones while the size fits the
+        /// limit. Does nothing when no entries were added. The cache is empty and can not be used after this call.
+        void save();
+
+        std::size_t getMappedCount() const { return mEntries.size(); }
+
+        std::size_t getAddedCount() const;
+
+    private:
+        struct Entry
+        {
+            ChunkKey mKey;
+            std::uint64_t mOffset;
+            std::uint32_t mVertexCount;
+            std::uint32_t mPadding;
+        };
+
+        struct Chunk
+        {
+            std::vector<osg::Vec3f> mPositions;
+            std::vector<osg::Vec3f> mNormals;
+            std::vector<osg::Vec4ub> mColours;
+        };
+
+        std::filesystem::path mPath;
+        std::size_t mMaxSize;
+        mutable std::shared_mutex mMutex;
+        std::unique_ptr<const Files::MappedFile> mFile;
+        std::span<const Entry> mEntries;
+        const char* mData = nullptr;
+        std::unique_ptr<std::atomic_bool[]> mUsed;
+        std::map<ChunkKey, Chunk> mAdded;
+        std::size_t mAddedSize = 0;
+        bool mClosed = false;
+
+        void load();
+    };
+}
+
+#endif
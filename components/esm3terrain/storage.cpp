@@ -1,6 +1,10 @@
 #include "storage.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <set>
+#include <span>
 
 #include <osg/Image>
 #include <osg/Plane>
@@ -22,6 +26,119 @@ namespace ESMTerrain
         Map mMap;
     };
 
+    namespace
+    {
+        std::uint64_t getLandDataHash(const ESM::LandData& data)
+        {
+            ChunkKeyBuilder builder;
+            const std::int32_t values[] = { data.mLoadFlags, data.getLandSize() };
+            builder.add(std::span<const std::int32_t>(values));
+            builder.add(data.getHeights());
+            builder.add(data.getNormals());
+            builder.add(data.getColors());
+            return builder.getKey()[0];
+        }
+
+        // The kernels below process a run of vertices from one land row. They have no branches depending on the
+        // vertex, so the compiler can vectorize them. Source data is read with the LOD increment as a stride and
+        // the output with the chunk row length as a stride, since the vertex buffers are column-major.
+
+        void fillPositions(const float* heights, std::size_t stride, std::size_t count, float firstX, float scale,
+            float size, float cellSize, float y, osg::Vec3f* out, std::size_t outStride)
+        {
+            if (heights == nullptr)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    out[i * outStride] = osg::Vec3f(((firstX + static_cast<float>(i)) / scale - 0.5f) * size * cellSize,
+                        y, ESM::Land::DEFAULT_HEIGHT);
+                return;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+                out[i * outStride] = osg::Vec3f(
+                    ((firstX + static_cast<float>(i)) / scale - 0.5f) * size * cellSize, y, heights[i * stride]);
+        }
+
+        void fillNormals(const ESM::LandData::VNML* normals, std::size_t stride, std::size_t count, osg::Vec3f* out,
+            std::size_t outStride)
+        {
+            if (normals == nullptr)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    out[i * outStride] = osg::Vec3f(0, 0, 1);
+                return;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const ESM::LandData::VNML* const normal = normals + i * stride * 3;
+                const float x = normal[0];
+                const float y = normal[1];
+                const float z = normal[2];
+                const float length = std::sqrt(x * x + y * y + z * z);
+                // Same as osg::Vec3f::normalize but without a branch
+                const float inverse = length > 0 ? 1.0f / length : 1.0f;
+                out[i * outStride] = osg::Vec3f(x * inverse, y * inverse, z * inverse);
+            }
+        }
+
+        void fillColours(const unsigned char* colours, std::size_t stride, std::size_t count, osg::Vec4ub* out,
+            std::size_t outStride)
+        {
+            if (colours == nullptr)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    out[i * outStride] = osg::Vec4ub(255, 255, 255, 255);
+                return;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const unsigned char* const colour = colours + i * stride * 3;
+                out[i * outStride] = osg::Vec4ub(colour[0], colour[1], colour[2], 255);
+            }
+        }
+
+        // Keeps independent lanes to avoid a dependency chain on a single value, so they map to vector registers
+        class MinMaxHeights
+        {
+        public:
+            MinMaxHeights()
+            {
+                mMin.fill(std::numeric_limits<float>::max());
+                mMax.fill(-std::numeric_limits<float>::max());
+            }
+
+            void add(std::span<const float> heights)
+            {
+                std::size_t i = 0;
+                for (; i + sLanes <= heights.size(); i += sLanes)
+                {
+                    for (std::size_t j = 0; j < sLanes; ++j)
+                    {
+                        mMin[j] = std::min(mMin[j], heights[i + j]);
+                        mMax[j] = std::max(mMax[j], heights[i + j]);
+                    }
+                }
+                for (std::size_t j = 0; i < heights.size(); ++i, ++j)
+                {
+                    mMin[j] = std::min(mMin[j], heights[i]);
+                    mMax[j] = std::max(mMax[j], heights[i]);
+                }
+            }
+
+            float getMin() const { return *std::min_element(mMin.begin(), mMin.end()); }
+
+            float getMax() const { return *std::max_element(mMax.begin(), mMax.end()); }
+
+        private:
+            static constexpr std::size_t sLanes = 8;
+
+            std::array<float, sLanes> mMin;
+            std::array<float, sLanes> mMax;
+        };
+    }
+
     LandObject::LandObject()
         : mLand(nullptr)
     {
@@ -46,6 +163,12 @@ namespace ESMTerrain
 
     LandObject::~LandObject() {}
 
+    std::uint64_t LandObject::getHash() const
+    {
+        std::call_once(mHashFlag, [&] { mHash = getLandDataHash(mData); });
+        return mHash;
+    }
+
     const float defaultHeight = ESM::Land::DEFAULT_HEIGHT;
 
     Storage::Storage(const VFS::Manager* vfs, const std::string& normalMapPattern,
@@ -79,19 +202,12 @@ namespace ESMTerrain
 
         if (data)
         {
-            min = std::numeric_limits<float>::max();
-            max = -std::numeric_limits<float>::max();
-            for (int row = startRow; row < endRow; ++row)
-            {
-                for (int col = startColumn; col < endColumn; ++col)
-                {
-                    float h = data->getHeights()[col * landSize + row];
-                    if (h > max)
-                        max = h;
-                    if (h < min)
-                        min = h;
-                }
-            }
+            MinMaxHeights heights;
+            // Heights are stored by columns, so each column is a contiguous range
+            for (int col = startColumn; col < endColumn; ++col)
+                heights.add(data->getHeights().subspan(col * landSize + startRow, endRow - startRow));
+            min = heights.getMin();
+            max = heights.getMax();
             return true;
         }
 
@@ -203,20 +319,31 @@ namespace ESMTerrain
         normals->resize(numVerts * numVerts);
         colours->resize(numVerts * numVerts);
 
-        osg::Vec3f normal;
-        osg::Vec4ub color;
-
-        float vertY = 0;
-        float vertX = 0;
-
         LandCache cache;
 
         bool alteration = useAlteration();
+
+        // Altered terrain is edited on the fly, so it is never cached
+        const bool useChunkCache = mChunkCache != nullptr && !alteration;
+        ChunkKey chunkKey{};
+        if (useChunkCache)
+        {
+            chunkKey = getChunkKey(lodLevel, size, center, worldspace, cache);
+            if (mChunkCache->get(chunkKey, *positions, *normals, *colours))
+                return;
+        }
+
+        const float cellSize = static_cast<float>(LandSizeInUnits);
+        const float vertexScale = static_cast<float>(numVerts - 1);
+
+        std::size_t vertY = 0;
+        std::size_t vertX = 0;
+
         bool validHeightDataExists = false;
-        float vertY_ = 0; // of current cell corner
+        std::size_t vertY_ = 0; // of current cell corner
         for (int cellY = startCellY; cellY < startCellY + std::ceil(size); ++cellY)
         {
-            float vertX_ = 0; // of current cell corner
+            std::size_t vertX_ = 0; // of current cell corner
             for (int cellX = startCellX; cellX < startCellX + std::ceil(size); ++cellX)
             {
                 ESM::ExteriorCellLocation cellLocation(cellX, cellY, worldspace);
@@ -250,38 +377,51 @@ namespace ESMTerrain
                 int colEnd = std::min(
                     static_cast<int>(colStart + std::min(1.f, size) * (landSize - 1) + 1), static_cast<int>(landSize));
 
+                assert(rowStart >= 0 && rowStart < rowEnd);
+                const std::size_t count = (rowEnd - rowStart + increment - 1) / increment;
+
                 vertY = vertY_;
                 for (int col = colStart; col < colEnd; col += increment)
                 {
-                    vertX = vertX_;
-                    for (int row = rowStart; row < rowEnd; row += increment)
+                    assert(col >= 0 && col < landSize);
+                    assert(vertX_ + count <= numVerts);
+                    assert(vertY < numVerts);
+
+                    const std::size_t srcIndex = col * landSize + rowStart;
+                    const std::size_t dstIndex = vertX_ * numVerts + vertY;
+                    osg::Vec3f* const dstPositions = &(*positions)[dstIndex];
+                    osg::Vec3f* const dstNormals = &(*normals)[dstIndex];
+                    osg::Vec4ub* const dstColours = &(*colours)[dstIndex];
+
+                    // Interior vertices of the row go through the branchless kernels first
+                    const float y = (static_cast<float>(vertY) / vertexScale - 0.5f) * size * cellSize;
+                    fillPositions(heightData ? heightData->getHeights().data() + srcIndex : nullptr, increment, count,
+                        static_cast<float>(vertX_), vertexScale, size, cellSize, y, dstPositions, numVerts);
+                    fillNormals(normalData ? normalData->getNormals().data() + srcIndex * 3 : nullptr, increment,
+                        count, dstNormals, numVerts);
+                    fillColours(colourData ? colourData->getColors().data() + srcIndex * 3 : nullptr, increment,
+                        count, dstColours, numVerts);
+
+                    if (alteration)
                     {
-                        int srcArrayIndex = col * landSize * 3 + row * 3;
-
-                        assert(row >= 0 && row < landSize);
-                        assert(col >= 0 && col < landSize);
-
-                        assert(vertX < numVerts);
-                        assert(vertY < numVerts);
-
-                        float height = defaultHeight;
-                        if (heightData)
-                            height = heightData->getHeights()[col * landSize + row];
-                        if (alteration)
-                            height += getAlteredHeight(col, row);
-                        (*positions)[static_cast<unsigned int>(vertX * numVerts + vertY)]
-                            = osg::Vec3f((vertX / float(numVerts - 1) - 0.5f) * size * LandSizeInUnits,
-                                (vertY / float(numVerts - 1) - 0.5f) * size * LandSizeInUnits, height);
-
-                        if (normalData)
+                        for (std::size_t i = 0; i < count; ++i)
                         {
-                            for (int i = 0; i < 3; ++i)
-                                normal[i] = normalData->getNormals()[srcArrayIndex + i];
-
-                            normal.normalize();
+                            const int row = rowStart + static_cast<int>(i * increment);
+                            dstPositions[i * numVerts].z() += getAlteredHeight(col, row);
+                            osg::Vec4ub& color = dstColours[i * numVerts];
+                            adjustColor(col, row, heightData, color); // Does nothing by default, override in OpenMW-CS
+                            color.a() = 255;
                         }
-                        else
-                            normal = osg::Vec3f(0, 0, 1);
+                    }
+
+                    // Then the vertices on the cell edges are replaced by the values from the neighbour cells.
+                    // Every vertex of the first and last land rows may be a corner, otherwise only the last one is
+                    // on the edge.
+                    const bool edgeRow = col == 0 || col == landSize - 1;
+                    for (std::size_t i = edgeRow ? 0 : count - 1; i < count; ++i)
+                    {
+                        const int row = rowStart + static_cast<int>(i * increment);
+                        osg::Vec3f& normal = dstNormals[i * numVerts];
 
                         // Normals apparently don't connect seamlessly between cells
                         if (col == landSize - 1 || row == landSize - 1)
@@ -293,49 +433,58 @@ namespace ESMTerrain
 
                         assert(normal.z() > 0);
 
-                        (*normals)[static_cast<unsigned int>(vertX * numVerts + vertY)] = normal;
-
-                        if (colourData)
-                        {
-                            for (int i = 0; i < 3; ++i)
-                                color[i] = colourData->getColors()[srcArrayIndex + i];
-                        }
-                        else
-                        {
-                            color.r() = 255;
-                            color.g() = 255;
-                            color.b() = 255;
-                        }
-                        if (alteration)
-                            adjustColor(col, row, heightData, color); // Does nothing by default, override in OpenMW-CS
-
                         // Unlike normals, colors mostly connect seamlessly between cells, but not always...
                         if (col == landSize - 1 || row == landSize - 1)
-                            fixColour(color, cellLocation, col, row, cache);
-
-                        color.a() = 255;
-
-                        (*colours)[static_cast<unsigned int>(vertX * numVerts + vertY)] = color;
-
-                        ++vertX;
+                            fixColour(dstColours[i * numVerts], cellLocation, col, row, cache);
                     }
+
                     ++vertY;
                 }
+                vertX = vertX_ + count;
                 vertX_ = vertX;
             }
             vertY_ = vertY;
 
-            assert(vertX_ == numVerts); // Ensure we covered whole area
+            assert(vertX == numVerts); // Ensure we covered whole area
         }
         assert(vertY_ == numVerts); // Ensure we covered whole area
 
         if (!validHeightDataExists && ESM::isEsm4Ext(worldspace))
         {
-            for (unsigned int iVert = 0; iVert < numVerts * numVerts; iVert++)
+            std::fill(positions->begin(), positions->end(), osg::Vec3f(0.f, 0.f, 0.f));
+        }
+
+        if (useChunkCache)
+            mChunkCache->add(chunkKey, *positions, *normals, *colours);
+    }
+
+    ChunkKey Storage::getChunkKey(
+        int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace, LandCache& cache)
+    {
+        ChunkKeyBuilder builder;
+        builder.add(worldspace.serializeText());
+        const float floatValues[] = { size, center.x(), center.y() };
+        builder.add(std::span<const float>(floatValues));
+        const std::int32_t intValues[] = { lodLevel, ESM::getLandSize(worldspace), ESM::getCellSize(worldspace) };
+        builder.add(std::span<const std::int32_t>(intValues));
+
+        const osg::Vec2f origin = center - osg::Vec2f(size / 2.f, size / 2.f);
+        const int startCellX = static_cast<int>(std::floor(origin.x()));
+        const int startCellY = static_cast<int>(std::floor(origin.y()));
+        const int cellsCount = static_cast<int>(std::ceil(size));
+
+        // Normals and colours at the chunk borders are taken from the neighbour cells
+        for (int cellY = startCellY - 1; cellY <= startCellY + cellsCount; ++cellY)
+        {
+            for (int cellX = startCellX - 1; cellX <= startCellX + cellsCount; ++cellX)
             {
-                (*positions)[static_cast<unsigned int>(iVert)] = osg::Vec3f(0.f, 0.f, 0.f);
+                const LandObject* land = getLand(ESM::ExteriorCellLocation(cellX, cellY, worldspace), cache);
+                const std::uint64_t hash = land != nullptr ? land->getHash() : 0;
+                builder.add(&hash, sizeof(hash));
             }
         }
+
+        return builder.getKey();
     }
 
     Storage::UniqueTextureId Storage::getVtexIndexAt(
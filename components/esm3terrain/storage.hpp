@@ -11,6 +11,8 @@
 #include <components/esm3/loadland.hpp>
 #include <components/esm3/loadltex.hpp>
 
+#include "chunkcache.hpp"
+
 namespace ESM4
 {
     struct Land;
@@ -56,10 +58,17 @@ namespace ESMTerrain
         inline int getLandSize() const { return mData.getLandSize(); }
         inline int getRealSize() const { return mData.getSize(); }
 
+        /// Hash of the loaded data, stable across sessions and platforms. Computed on the first call, so it costs
+        /// nothing when the chunk cache is disabled.
+        std::uint64_t getHash() const;
+
     private:
         const ESM::Land* mLand;
 
         ESM::LandData mData;
+
+        mutable std::once_flag mHashFlag;
+        mutable std::uint64_t mHash = 0;
     };
 
     /// @brief Feeds data from ESM terrain records (ESM::Land, ESM::LandTexture)
@@ -123,6 +132,9 @@ namespace ESMTerrain
 
         int getBlendmapScale(float chunkSize) override;
 
+        /// Use the cache for vertex buffers of the chunks. The cache has to outlive this object.
+        void setChunkCache(ChunkCache* cache) { mChunkCache = cache; }
+
         float getVertexHeight(const ESM::LandData* data, int x, int y)
         {
             const int landSize = data->getLandSize();
@@ -133,6 +145,7 @@ namespace ESMTerrain
 
     private:
         const VFS::Manager* mVFS;
+        ChunkCache* mChunkCache = nullptr;
 
         inline void fixNormal(
             osg::Vec3f& normal, ESM::ExteriorCellLocation cellLocation, int col, int row, LandCache& cache);
@@ -143,6 +156,9 @@ namespace ESMTerrain
 
         inline const LandObject* getLand(ESM::ExteriorCellLocation cellLocation, LandCache& cache);
 
+        ChunkKey getChunkKey(int lodLevel, float size, const osg::Vec2f& center, ESM::RefId worldspace,
+            LandCache& cache);
+
         virtual bool useAlteration() const { return false; }
         virtual void adjustColor(int col, int row, const ESM::LandData* heightData, osg::Vec4ub& color) const;
         virtual float getAlteredHeight(int col, int row) const;
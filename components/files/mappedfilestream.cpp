@@ -0,0 +1,52 @@
+#include "mappedfilestream.hpp"
+
+#include "conversion.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace Files
+{
+    MappedFile::MappedFile(const std::filesystem::path& path)
+        : mSource(std::make_unique<boost::iostreams::mapped_file_source>())
+    {
+        try
+        {
+            mSource->open(pathToUnicodeString(path));
+        }
+        catch (const std::exception& e)
+        {
+            throw std::runtime_error("Failed to map file " + pathToUnicodeString(path) + ": " + e.what());
+        }
+    }
+
+    MappedFile::~MappedFile() = default;
+
+    const char* MappedFile::data() const
+    {
+        return mSource->data();
+    }
+
+    std::size_t MappedFile::size() const
+    {
+        return mSource->size();
+    }
+
+    MappedFileStreamBuf::MappedFileStreamBuf(
+        std::shared_ptr<const MappedFile> file, std::size_t start, std::size_t length)
+        : MemBuf(file->data() + start, length)
+        , mFile(std::move(file))
+    {
+    }
+
+    IStreamPtr openMappedFileStream(std::shared_ptr<const MappedFile> file, std::size_t start, std::size_t length)
+    {
+        if (start > file->size() || length > file->size() - start)
+            throw std::runtime_error("Region [" + std::to_string(start) + ", " + std::to_string(start + length)
+                + ") is outside of mapped file of size " + std::to_string(file->size()));
+        return std::make_unique<MappedFileStream>(
+            std::make_unique<MappedFileStreamBuf>(std::move(file), start, length));
+    }
+}
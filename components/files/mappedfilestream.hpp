@@ -0,0 +1,50 @@
+#ifndef OPENMW_COMPONENTS_FILES_MAPPEDFILESTREAM_H
+#define OPENMW_COMPONENTS_FILES_MAPPEDFILESTREAM_H
+
+#include "istreamptr.hpp"
+#include "memorystream.hpp"
+#include "streamwithbuffer.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+
+namespace boost::iostreams
+{
+    class mapped_file_source;
+}
+
+namespace Files
+{
+    /// Read-only memory mapping of a whole file.
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::filesystem::path& path);
+
+        ~MappedFile();
+
+        const char* data() const;
+
+        std::size_t size() const;
+
+    private:
+        std::unique_ptr<boost::iostreams::mapped_file_source> mSource;
+    };
+
+    /// A streambuf over a region of a memory mapped file. Does not copy the data and keeps the mapping alive.
+    class MappedFileStreamBuf final : public MemBuf
+    {
+    public:
+        MappedFileStreamBuf(std::shared_ptr<const MappedFile> file, std::size_t start, std::size_t length);
+
+    private:
+        std::shared_ptr<const MappedFile> mFile;
+    };
+
+    using MappedFileStream = StreamWithBuffer<MappedFileStreamBuf>;
+
+    IStreamPtr openMappedFileStream(std::shared_ptr<const MappedFile> file, std::size_t start, std::size_t length);
+}
+
+#endif
@@ -0,0 +1,40 @@
+#include "cellrefs.hpp"
+
+#include <components/esm3/cellref.hpp>
+#include <components/esm3/esmreader.hpp>
+#include <components/esm3/loadcell.hpp>
+#include <components/esm3/readerscache.hpp>
+
+#include <cstddef>
+#include <map>
+
+namespace GroundcoverDb
+{
+    std::vector<ESM::CellRef> readCellRefs(const ESM::Cell& cell, ESM::ReadersCache& readers)
+    {
+        std::map<ESM::RefNum, ESM::CellRef> refs;
+        for (std::size_t i = 0; i < cell.mContextList.size(); ++i)
+        {
+            const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+            const ESM::ReadersCache::BusyItem reader = readers.get(index);
+            cell.restore(*reader, static_cast<int>(i));
+            ESM::CellRef ref;
+            bool deleted = false;
+            while (cell.getNextRef(*reader, ref, deleted))
+            {
+                if (deleted)
+                {
+                    refs.erase(ref.mRefNum);
+                    continue;
+                }
+                refs[ref.mRefNum] = std::move(ref);
+            }
+        }
+
+        std::vector<ESM::CellRef> result;
+        result.reserve(refs.size());
+        for (auto& [refNum, ref] : refs)
+            result.push_back(std::move(ref));
+        return result;
+    }
+}
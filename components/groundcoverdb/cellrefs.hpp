@@ -0,0 +1,20 @@
+#ifndef OPENMW_COMPONENTS_GROUNDCOVERDB_CELLREFS_H
+#define OPENMW_COMPONENTS_GROUNDCOVERDB_CELLREFS_H
+
+#include <vector>
+
+namespace ESM
+{
+    struct Cell;
+    struct CellRef;
+    class ReadersCache;
+}
+
+namespace GroundcoverDb
+{
+    /// Reads references of all content files from the cell context list. References overridden by later content files
+    /// are merged, deleted references are skipped. Result is ordered by RefNum.
+    std::vector<ESM::CellRef> readCellRefs(const ESM::Cell& cell, ESM::ReadersCache& readers);
+}
+
+#endif
@@ -0,0 +1,266 @@
+#include "database.hpp"
+
+#include <components/esm3/cellref.hpp>
+#include <components/files/collections.hpp>
+#include <components/files/conversion.hpp>
+#include <components/files/hash.hpp>
+#include <components/files/mappedfilestream.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace GroundcoverDb
+{
+    namespace
+    {
+        constexpr char sMagic[8] = { 'O', 'M', 'W', 'G', 'R', 'A', 'S', 'S' };
+
+        // Increment when the file layout or the way instances are collected changes
+        constexpr std::uint32_t sVersion = 1;
+
+        constexpr std::size_t sAlignment = 8;
+
+        struct Header
+        {
+            char mMagic[sizeof(sMagic)];
+            std::uint32_t mVersion;
+            std::uint32_t mContentFilesCount;
+            std::uint32_t mIdsCount;
+            std::uint32_t mCellsCount;
+            std::uint64_t mInstancesCount;
+        };
+
+        static_assert(std::is_trivially_copyable_v<Header>);
+        static_assert(std::is_trivially_copyable_v<CellEntry>);
+        static_assert(std::is_trivially_copyable_v<Instance>);
+        static_assert(alignof(CellEntry) <= sAlignment);
+        static_assert(alignof(Instance) <= sAlignment);
+
+        class Writer
+        {
+        public:
+            explicit Writer(std::ostream& stream)
+                : mStream(stream)
+            {
+            }
+
+            template <class T>
+            void write(const T& value)
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                write(&value, 1);
+            }
+
+            template <class T>
+            void write(const T* values, std::size_t count)
+            {
+                static_assert(std::is_trivially_copyable_v<T>);
+                mStream.write(reinterpret_cast<const char*>(values), static_cast<std::streamsize>(sizeof(T) * count));
+                mOffset += sizeof(T) * count;
+            }
+
+            void write(std::string_view value)
+            {
+                write(static_cast<std::uint32_t>(value.size()));
+                write(value.data(), value.size());
+            }
+
+            void align()
+            {
+                constexpr char padding[sAlignment] = {};
+                if (const std::size_t remainder = mOffset % sAlignment; remainder != 0)
+                    write(padding, sAlignment - remainder);
+            }
+
+        private:
+            std::ostream& mStream;
+            std::size_t mOffset = 0;
+        };
+
+        class Reader
+        {
+        public:
+            explicit Reader(const Files::MappedFile& file)
+                : mData(file.data())
+                , mSize(file.size())
+            {
+            }
+
+            template <class T>
+            T read()
+            {
+                T value;
+                std::memcpy(&value, take(sizeof(T)), sizeof(T));
+                return value;
+            }
+
+            std::string_view readString()
+            {
+                const std::uint32_t size = read<std::uint32_t>();
+                return std::string_view(take(size), size);
+            }
+
+            template <class T>
+            std::span<const T> readArray(std::size_t count)
+            {
+                if (count > (mSize - mOffset) / sizeof(T))
+                    throw std::runtime_error("Unexpected end of groundcover database");
+                return std::span<const T>(reinterpret_cast<const T*>(take(sizeof(T) * count)), count);
+            }
+
+            void align()
+            {
+                if (const std::size_t remainder = mOffset % sAlignment; remainder != 0)
+                    take(sAlignment - remainder);
+            }
+
+        private:
+            const char* mData;
+            std::size_t mSize;
+            std::size_t mOffset = 0;
+
+            const char* take(std::size_t size)
+            {
+                if (size > mSize - mOffset)
+                    throw std::runtime_error("Unexpected end of groundcover database");
+                const char* const result = mData + mOffset;
+                mOffset += size;
+                return result;
+            }
+        };
+
+        auto makeCellKey(const CellEntry& cell)
+        {
+            return std::make_tuple(cell.mX, cell.mY);
+        }
+    }
+
+    Instance makeInstance(const ESM::CellRef& ref, std::uint32_t id)
+    {
+        return Instance{ ref.mPos, ref.mScale, id };
+    }
+
+    std::vector<ContentFile> getContentFiles(
+        const Files::Collections& fileCollections, const std::vector<std::string>& content)
+    {
+        std::vector<ContentFile> result;
+        for (const std::string& name : content)
+        {
+            const Files::MultiDirCollection& collection = fileCollections.getCollection(
+                Files::pathToUnicodeString(Files::pathFromUnicodeString(name).extension()));
+            if (!collection.doesExist(name))
+                continue;
+            const std::filesystem::path path = collection.getPath(name);
+            std::ifstream stream(path, std::ios::binary);
+            if (!stream)
+                throw std::runtime_error("Failed to open content file " + Files::pathToUnicodeString(path));
+            result.push_back(ContentFile{ name, Files::getHash(path, stream) });
+        }
+        return result;
+    }
+
+    void writeDatabase(const std::filesystem::path& path, const std::vector<ContentFile>& contentFiles,
+        const std::vector<ESM::RefId>& ids, const std::vector<CellInstances>& cells)
+    {
+        std::vector<CellEntry> entries;
+        entries.reserve(cells.size());
+        std::uint64_t instancesCount = 0;
+        for (const CellInstances& cell : cells)
+        {
+            if (instancesCount + cell.mInstances.size() > std::numeric_limits<std::uint32_t>::max())
+                throw std::runtime_error("Too many groundcover instances");
+            entries.push_back(CellEntry{ cell.mX, cell.mY, static_cast<std::uint32_t>(instancesCount),
+                static_cast<std::uint32_t>(cell.mInstances.size()) });
+            instancesCount += cell.mInstances.size();
+        }
+
+        std::vector<std::size_t> order(cells.size());
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+        std::sort(order.begin(), order.end(),
+            [&](std::size_t l, std::size_t r) { return makeCellKey(entries[l]) < makeCellKey(entries[r]); });
+        if (std::adjacent_find(order.begin(), order.end(), [&](std::size_t l, std::size_t r) {
+                return makeCellKey(entries[l]) == makeCellKey(entries[r]);
+            }) != order.end())
+            throw std::invalid_argument("Duplicate groundcover cells");
+
+        std::ofstream stream(path, std::ios::binary);
+        stream.exceptions(std::ios::failbit | std::ios::badbit);
+        Writer writer(stream);
+
+        Header header;
+        std::memcpy(header.mMagic, sMagic, sizeof(sMagic));
+        header.mVersion = sVersion;
+        header.mContentFilesCount = static_cast<std::uint32_t>(contentFiles.size());
+        header.mIdsCount = static_cast<std::uint32_t>(ids.size());
+        header.mCellsCount = static_cast<std::uint32_t>(cells.size());
+        header.mInstancesCount = instancesCount;
+        writer.write(header);
+
+        for (const ContentFile& contentFile : contentFiles)
+        {
+            writer.write(std::string_view(contentFile.mName));
+            writer.write(contentFile.mHash);
+        }
+
+        for (const ESM::RefId& id : ids)
+            writer.write(std::string_view(id.serializeText()));
+
+        writer.align();
+        for (const std::size_t i : order)
+            writer.write(entries[i]);
+
+        for (const CellInstances& cell : cells)
+            writer.write(cell.mInstances.data(), cell.mInstances.size());
+    }
+
+    Database::Database(const std::filesystem::path& path)
+        : mFile(std::make_unique<Files::MappedFile>(path))
+    {
+        Reader reader(*mFile);
+
+        const Header header = reader.read<Header>();
+        if (std::memcmp(header.mMagic, sMagic, sizeof(sMagic)) != 0)
+            throw std::runtime_error("Invalid groundcover database magic");
+        if (header.mVersion != sVersion)
+            throw std::runtime_error("Unsupported groundcover database version: " + std::to_string(header.mVersion));
+
+        mContentFiles.reserve(header.mContentFilesCount);
+        for (std::uint32_t i = 0; i < header.mContentFilesCount; ++i)
+        {
+            ContentFile& contentFile = mContentFiles.emplace_back();
+            contentFile.mName = reader.readString();
+            contentFile.mHash = reader.read<std::array<std::uint64_t, 2>>();
+        }
+
+        mIds.reserve(header.mIdsCount);
+        for (std::uint32_t i = 0; i < header.mIdsCount; ++i)
+            mIds.push_back(ESM::RefId::deserializeText(reader.readString()));
+
+        reader.align();
+        mCells = reader.readArray<CellEntry>(header.mCellsCount);
+        mInstances = reader.readArray<Instance>(header.mInstancesCount);
+
+        for (const CellEntry& cell : mCells)
+            if (cell.mBegin > mInstances.size() || cell.mCount > mInstances.size() - cell.mBegin)
+                throw std::runtime_error("Invalid groundcover database cell instances range");
+    }
+
+    Database::~Database() = default;
+
+    std::span<const Instance> Database::getInstances(int cellX, int cellY) const
+    {
+        const auto key = std::make_tuple(cellX, cellY);
+        const auto it = std::lower_bound(mCells.begin(), mCells.end(), key,
+            [](const CellEntry& cell, const auto& value) { return makeCellKey(cell) < value; });
+        if (it == mCells.end() || makeCellKey(*it) != key)
+            return {};
+        return mInstances.subspan(it->mBegin, it->mCount);
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef OPENMW_COMPONENTS_GROUNDCOVERDB_DATABASE_H
+#define OPENMW_COMPONENTS_GROUNDCOVERDB_DATABASE_H
+
+#include <components/esm/defs.hpp>
+#include <components/esm/refid.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace ESM
+{
+    struct CellRef;
+}
+
+namespace Files
+{
+    class Collections;
+    class MappedFile;
+}
+
+namespace GroundcoverDb
+{
+    /// Groundcover reference stored in the database. mId is an index in the database ids list.
+    struct Instance
+    {
+        ESM::Position mPosition;
+        float mScale = 1;
+        std::uint32_t mId = 0;
+    };
+
+    static_assert(sizeof(Instance) == 32);
+
+    Instance makeInstance(const ESM::CellRef& ref, std::uint32_t id);
+
+    struct CellInstances
+    {
+        int mX = 0;
+        int mY = 0;
+        std::vector<Instance> mInstances;
+    };
+
+    /// Location of the cell instances in the database instances array
+    struct CellEntry
+    {
+        std::int32_t mX = 0;
+        std::int32_t mY = 0;
+        std::uint32_t mBegin = 0;
+        std::uint32_t mCount = 0;
+    };
+
+    struct ContentFile
+    {
+        std::string mName;
+        std::array<std::uint64_t, 2> mHash{};
+
+        friend bool operator==(const ContentFile& l, const ContentFile& r) = default;
+    };
+
+    /// Returns names and hashes of the existing content files in the same order
+    std::vector<ContentFile> getContentFiles(
+        const Files::Collections& fileCollections, const std::vector<std::string>& content);
+
+    /// Writes groundcover instances of exterior cells baked for the given content files. Instances of each cell are
+    /// stored in the given order.
+    void writeDatabase(const std::filesystem::path& path, const std::vector<ContentFile>& contentFiles,
+        const std::vector<ESM::RefId>& ids, const std::vector<CellInstances>& cells);
+
+    /// Read-only view over a memory mapped file written by writeDatabase. Throws std::runtime_error when the file can
+    /// not be mapped or has invalid format. Instances are not validated on load, so their ids have to be checked
+    /// against getIds() by the user.
+    class Database
+    {
+    public:
+        explicit Database(const std::filesystem::path& path);
+
+        ~Database();
+
+        bool matches(const std::vector<ContentFile>& contentFiles) const { return mContentFiles == contentFiles; }
+
+        const std::vector<ESM::RefId>& getIds() const { return mIds; }
+
+        std::span<const Instance> getInstances(int cellX, int cellY) const;
+
+        std::size_t getCellsCount() const { return mCells.size(); }
+
+    private:
+        std::unique_ptr<const Files::MappedFile> mFile;
+        std::vector<ContentFile> mContentFiles;
+        std::vector<ESM::RefId> mIds;
+        std::span<const CellEntry> mCells;
+        std::span<const Instance> mInstances;
+    };
+}
+
+#endif
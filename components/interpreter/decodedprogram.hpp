@@ -0,0 +1,36 @@
+#ifndef OPENMW_COMPONENTS_INTERPRETER_DECODEDPROGRAM_H
+#define OPENMW_COMPONENTS_INTERPRETER_DECODEDPROGRAM_H
+
+#include <vector>
+
+#include "types.hpp"
+
+namespace Interpreter
+{
+    class Opcode0;
+    class Opcode1;
+    class Runtime;
+    struct DecodedInstruction;
+
+    using InstructionHandler = void (*)(const DecodedInstruction& instruction, Runtime& runtime);
+
+    /// Instruction with the opcode handler already resolved by the interpreter
+    struct DecodedInstruction
+    {
+        InstructionHandler mHandler;
+        union
+        {
+            Opcode0* mOpcode0;
+            Opcode1* mOpcode1;
+            Type_Integer mInteger; // Inlined literal
+            Type_Float mFloat; // Inlined literal
+        };
+        unsigned int mArg0;
+    };
+
+    /// Instructions of a program in the same order as Program::mInstructions. Opcode pointers belong to the
+    /// interpreter that decoded the program, so it must be executed only by this interpreter.
+    using DecodedProgram = std::vector<DecodedInstruction>;
+}
+
+#endif
@@ -4,6 +4,8 @@
 #include <stdexcept>
 #include <string>
 
+#include "genericopcodes.hpp"
+#include "localopcodes.hpp"
 #include "opcodes.hpp"
 #include "program.hpp"
 
@@ -21,18 +23,62 @@ namespace Interpreter
         throw std::runtime_error(error);
     }
 
-    template <typename T>
-    auto& getDispatcher(const T& segment, unsigned int seg, int opcode)
+    namespace
     {
-        auto it = segment.find(opcode);
-        if (it == segment.end())
+        void executeOpcode0(const DecodedInstruction& instruction, Runtime& runtime)
         {
-            abortUnknownCode(seg, opcode);
+            instruction.mOpcode0->execute(runtime);
+        }
+
+        void executeOpcode1(const DecodedInstruction& instruction, Runtime& runtime)
+        {
+            instruction.mOpcode1->execute(runtime, instruction.mArg0);
+        }
+
+        void executePushInt(const DecodedInstruction& instruction, Runtime& runtime)
+        {
+            runtime.push(static_cast<Type_Integer>(instruction.mArg0));
+        }
+
+        // Replaces a literal index push followed by a literal fetch
+        void executePushIntegerLiteral(const DecodedInstruction& instruction, Runtime& runtime)
+        {
+            runtime.push(instruction.mInteger);
+            runtime.setPC(runtime.getPC() + 1);
+        }
+
+        void executePushFloatLiteral(const DecodedInstruction& instruction, Runtime& runtime)
+        {
+            runtime.push(instruction.mFloat);
+            runtime.setPC(runtime.getPC() + 1);
+        }
+
+        // Errors are reported only when an invalid instruction is executed, like they were before decoding
+        void executeUnknownSegment(const DecodedInstruction& instruction, Runtime& /*runtime*/)
+        {
+            abortUnknownSegment(instruction.mArg0);
+        }
+
+        template <unsigned int segment>
+        void executeUnknownCode(const DecodedInstruction& instruction, Runtime& /*runtime*/)
+        {
+            abortUnknownCode(segment, static_cast<int>(instruction.mArg0));
+        }
+
+        template <unsigned int segment, typename T>
+        DecodedInstruction decodeOpcode1(const T& seg, int opcode, unsigned int arg0)
+        {
+            const auto it = seg.find(opcode);
+            if (it == seg.end())
+                return DecodedInstruction{ &executeUnknownCode<segment>, { nullptr },
+                    static_cast<unsigned int>(opcode) };
+            DecodedInstruction result{ &executeOpcode1, { nullptr }, arg0 };
+            result.mOpcode1 = it->second.get();
+            return result;
         }
-        return it->second;
     }
 
-    void Interpreter::execute(Type_Code code)
+    DecodedInstruction Interpreter::decode(Type_Code code) const
     {
         unsigned int segSpec = code >> 30;
 
@@ -43,7 +89,7 @@ namespace Interpreter
                 const int opcode = code >> 24;
                 const unsigned int arg0 = code & 0xffffff;
 
-                return getDispatcher(mSegment0, 0, opcode)->execute(mRuntime, arg0);
+                return decodeOpcode1<0>(mSegment0, opcode, arg0);
             }
 
             case 2:
@@ -51,7 +97,7 @@ namespace Interpreter
                 const int opcode = (code >> 20) & 0x3ff;
                 const unsigned int arg0 = code & 0xfffff;
 
-                return getDispatcher(mSegment2, 2, opcode)->execute(mRuntime, arg0);
+                return decodeOpcode1<2>(mSegment2, opcode, arg0);
             }
         }
 
@@ -64,18 +110,59 @@ namespace Interpreter
                 const int opcode = (code >> 8) & 0x3ffff;
                 const unsigned int arg0 = code & 0xff;
 
-                return getDispatcher(mSegment3, 3, opcode)->execute(mRuntime, arg0);
+                return decodeOpcode1<3>(mSegment3, opcode, arg0);
             }
 
             case 0x32:
             {
                 const int opcode = code & 0x3ffffff;
 
-                return getDispatcher(mSegment5, 5, opcode)->execute(mRuntime);
+                const auto it = mSegment5.find(opcode);
+                if (it == mSegment5.end())
+                    return DecodedInstruction{ &executeUnknownCode<5>, { nullptr }, static_cast<unsigned int>(opcode) };
+                DecodedInstruction result{ &executeOpcode0, { nullptr }, 0 };
+                result.mOpcode0 = it->second.get();
+                return result;
             }
         }
 
-        abortUnknownSegment(code);
+        return DecodedInstruction{ &executeUnknownSegment, { nullptr }, code };
+    }
+
+    DecodedProgram Interpreter::decode(const Program& program) const
+    {
+        DecodedProgram result;
+        result.reserve(program.mInstructions.size());
+        for (const Type_Code instruction : program.mInstructions)
+        {
+            DecodedInstruction& decoded = result.emplace_back(decode(instruction));
+            // Integers are pushed directly without a virtual call
+            if (decoded.mHandler == &executeOpcode1 && dynamic_cast<OpPushInt*>(decoded.mOpcode1) != nullptr)
+                decoded.mHandler = &executePushInt;
+        }
+
+        // Literal index push followed by a literal fetch is executed as a single instruction. The fetch is kept
+        // in place so jumps targeting it behave the same.
+        for (std::size_t i = 0; i + 1 < result.size(); ++i)
+        {
+            DecodedInstruction& push = result[i];
+            if (push.mHandler != &executePushInt || result[i + 1].mHandler != &executeOpcode0)
+                continue;
+            Opcode0* const fetch = result[i + 1].mOpcode0;
+            const std::size_t index = push.mArg0;
+            if (dynamic_cast<OpFetchIntLiteral*>(fetch) != nullptr && index < program.mIntegers.size())
+            {
+                push.mHandler = &executePushIntegerLiteral;
+                push.mInteger = program.mIntegers[index];
+            }
+            else if (dynamic_cast<OpFetchFloatLiteral*>(fetch) != nullptr && index < program.mFloats.size())
+            {
+                push.mHandler = &executePushFloatLiteral;
+                push.mFloat = program.mFloats[index];
+            }
+        }
+
+        return result;
     }
 
     void Interpreter::begin()
@@ -105,6 +192,12 @@ namespace Interpreter
         }
     }
 
+    void Interpreter::execute(Type_Code code)
+    {
+        const DecodedInstruction instruction = decode(code);
+        instruction.mHandler(instruction, mRuntime);
+    }
+
     void Interpreter::run(const Program& program, Context& context)
     {
         begin();
@@ -128,4 +221,32 @@ namespace Interpreter
 
         end();
     }
+
+    void Interpreter::run(const Program& program, const DecodedProgram& decoded, Context& context)
+    {
+        assert(decoded.size() == program.mInstructions.size());
+
+        begin();
+
+        try
+        {
+            mRuntime.configure(program, context);
+
+            const DecodedInstruction* const instructions = decoded.data();
+            const int size = static_cast<int>(decoded.size());
+            for (int pc = mRuntime.getPC(); pc >= 0 && pc < size; pc = mRuntime.getPC())
+            {
+                const DecodedInstruction& instruction = instructions[pc];
+                mRuntime.setPC(pc + 1);
+                instruction.mHandler(instruction, mRuntime);
+            }
+        }
+        catch (...)
+        {
+            end();
+            throw;
+        }
+
+        end();
+    }
 }
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "components/interpreter/program.hpp"
+#include "decodedprogram.hpp"
 #include "opcodes.hpp"
 #include "runtime.hpp"
 #include "types.hpp"
@@ -26,6 +27,8 @@ namespace Interpreter
         std::map<int, std::unique_ptr<Opcode1>> mSegment3;
         std::map<int, std::unique_ptr<Opcode0>> mSegment5;
 
+        DecodedInstruction decode(Type_Code code) const;
+
         void execute(Type_Code code);
 
         void begin();
@@ -69,7 +72,15 @@ namespace Interpreter
             installSegment(mSegment5, code, std::make_unique<T>(std::forward<TArgs>(args)...));
         }
 
+        DecodedProgram decode(const Program& program) const;
+        ///< Resolve opcode handlers of all instructions. Opcodes must not be installed after the program is decoded.
+
         void run(const Program& program, Context& context);
+        ///< Decode and run instructions one by one. Prefer running a program decoded in advance when it is executed
+        /// repeatedly.
+
+        void run(const Program& program, const DecodedProgram& decoded, Context& context);
+        ///< \a decoded must be the result of decode(program) of this interpreter.
     };
 }
 
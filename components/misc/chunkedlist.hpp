@@ -0,0 +1,297 @@
+#ifndef OPENMW_COMPONENTS_MISC_CHUNKEDLIST_H
+#define OPENMW_COMPONENTS_MISC_CHUNKEDLIST_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Misc
+{
+    /// \class ChunkedList
+    /// Sequence container storing values in a linked list of contiguous chunks. Like std::list it never moves
+    /// values: pointers, references and iterators stay valid until the value is erased, including when other values
+    /// are added or the container is moved. Iterating over values does not chase a pointer per value. Chunk capacity
+    /// grows geometrically so small lists don't waste memory. Erased values leave a hole that is skipped by iterators
+    /// and is not reused to keep the insertion order.
+    template <class T>
+    class ChunkedList
+    {
+        struct Chunk
+        {
+            Chunk* mPrev = nullptr;
+            Chunk* mNext = nullptr;
+            std::size_t mCapacity;
+            std::size_t mSize = 0;
+            T* mValues;
+            std::unique_ptr<bool[]> mErased;
+
+            explicit Chunk(std::size_t capacity)
+                : mCapacity(capacity)
+                , mValues(std::allocator<T>().allocate(capacity))
+            {
+            }
+
+            Chunk(const Chunk&) = delete;
+            Chunk& operator=(const Chunk&) = delete;
+
+            ~Chunk()
+            {
+                for (std::size_t i = 0; i < mSize; ++i)
+                    if (!isErased(i))
+                        std::destroy_at(mValues + i);
+                std::allocator<T>().deallocate(mValues, mCapacity);
+            }
+
+            bool isErased(std::size_t index) const { return mErased != nullptr && mErased[index]; }
+        };
+
+        template <bool isConst>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<isConst, const T*, T*>;
+            using reference = std::conditional_t<isConst, const T&, T&>;
+
+            Iterator() = default;
+
+            template <bool otherIsConst, class = std::enable_if_t<isConst && !otherIsConst>>
+            Iterator(const Iterator<otherIsConst>& other)
+                : mList(other.mList)
+                , mChunk(other.mChunk)
+                , mIndex(other.mIndex)
+            {
+            }
+
+            reference operator*() const { return mChunk->mValues[mIndex]; }
+
+            pointer operator->() const { return mChunk->mValues + mIndex; }
+
+            Iterator& operator++()
+            {
+                do
+                {
+                    if (++mIndex == mChunk->mSize)
+                    {
+                        mChunk = mChunk->mNext;
+                        mIndex = 0;
+                    }
+                } while (mChunk != nullptr && mChunk->isErased(mIndex));
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            Iterator& operator--()
+            {
+                do
+                {
+                    if (mChunk == nullptr)
+                    {
+                        mChunk = mList->mLast;
+                        mIndex = mChunk->mSize - 1;
+                    }
+                    else if (mIndex == 0)
+                    {
+                        mChunk = mChunk->mPrev;
+                        mIndex = mChunk->mSize - 1;
+                    }
+                    else
+                        --mIndex;
+                } while (mChunk->isErased(mIndex));
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator result = *this;
+                --*this;
+                return result;
+            }
+
+            // The list is not compared to keep iterators valid after the container is moved
+            friend bool operator==(const Iterator& left, const Iterator& right)
+            {
+                return left.mChunk == right.mChunk && left.mIndex == right.mIndex;
+            }
+
+        private:
+            friend class ChunkedList;
+            friend class Iterator<!isConst>;
+
+            // Only used to decrement the end iterator
+            const ChunkedList* mList = nullptr;
+            Chunk* mChunk = nullptr;
+            std::size_t mIndex = 0;
+
+            explicit Iterator(const ChunkedList* list, Chunk* chunk, std::size_t index)
+                : mList(list)
+                , mChunk(chunk)
+                , mIndex(index)
+            {
+            }
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        ChunkedList() = default;
+
+        ChunkedList(const ChunkedList& other)
+        {
+            for (const T& value : other)
+                push_back(value);
+        }
+
+        ChunkedList(ChunkedList&& other) noexcept
+            : mChunks(std::move(other.mChunks))
+            , mLast(std::exchange(other.mLast, nullptr))
+            , mSize(std::exchange(other.mSize, 0))
+        {
+            other.mChunks.clear();
+        }
+
+        ChunkedList& operator=(const ChunkedList& other)
+        {
+            if (this != &other)
+            {
+                ChunkedList copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        ChunkedList& operator=(ChunkedList&& other) noexcept
+        {
+            ChunkedList moved(std::move(other));
+            swap(moved);
+            return *this;
+        }
+
+        void swap(ChunkedList& other) noexcept
+        {
+            std::swap(mChunks, other.mChunks);
+            std::swap(mLast, other.mLast);
+            std::swap(mSize, other.mSize);
+        }
+
+        std::size_t size() const { return mSize; }
+
+        bool empty() const { return mSize == 0; }
+
+        iterator begin() { return makeBegin<iterator>(); }
+
+        const_iterator begin() const { return makeBegin<const_iterator>(); }
+
+        const_iterator cbegin() const { return begin(); }
+
+        iterator end() { return iterator(this, nullptr, 0); }
+
+        const_iterator end() const { return const_iterator(this, nullptr, 0); }
+
+        const_iterator cend() const { return end(); }
+
+        T& front() { return *begin(); }
+
+        const T& front() const { return *begin(); }
+
+        T& back() { return *--end(); }
+
+        const T& back() const { return *--end(); }
+
+        template <class... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (mLast != nullptr && mLast->mSize < mLast->mCapacity)
+            {
+                std::construct_at(mLast->mValues + mLast->mSize, std::forward<Args>(args)...);
+                ++mLast->mSize;
+            }
+            else
+                addChunk(std::forward<Args>(args)...);
+            ++mSize;
+            return mLast->mValues[mLast->mSize - 1];
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        /// Destroys the value without moving any other.
+        /// \return Iterator to the value following the erased one.
+        iterator erase(const_iterator position)
+        {
+            assert(position.mChunk != nullptr);
+            Chunk& chunk = *position.mChunk;
+            if (chunk.mErased == nullptr)
+                chunk.mErased = std::make_unique<bool[]>(chunk.mCapacity);
+            iterator next(this, position.mChunk, position.mIndex);
+            ++next;
+            std::destroy_at(chunk.mValues + position.mIndex);
+            chunk.mErased[position.mIndex] = true;
+            --mSize;
+            return next;
+        }
+
+        void clear()
+        {
+            mChunks.clear();
+            mLast = nullptr;
+            mSize = 0;
+        }
+
+    private:
+        std::vector<std::unique_ptr<Chunk>> mChunks;
+        Chunk* mLast = nullptr;
+        std::size_t mSize = 0;
+
+        static std::size_t getMaxChunkCapacity() { return std::max<std::size_t>(16 * 1024 / sizeof(T), 1); }
+
+        // Chunks are linked only when the first value is constructed so there are no empty chunks
+        template <class... Args>
+        void addChunk(Args&&... args)
+        {
+            const std::size_t capacity = mLast == nullptr ? 1 : std::min(mLast->mCapacity * 2, getMaxChunkCapacity());
+            std::unique_ptr<Chunk> chunk = std::make_unique<Chunk>(capacity);
+            std::construct_at(chunk->mValues, std::forward<Args>(args)...);
+            chunk->mSize = 1;
+            mChunks.push_back(std::move(chunk));
+            Chunk* const last = mChunks.back().get();
+            last->mPrev = mLast;
+            if (mLast != nullptr)
+                mLast->mNext = last;
+            mLast = last;
+        }
+
+        template <class It>
+        It makeBegin() const
+        {
+            if (mChunks.empty())
+                return It(this, nullptr, 0);
+            Chunk* const first = mChunks.front().get();
+            It result(this, first, 0);
+            if (first->isErased(0))
+                ++result;
+            return result;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,289 @@
+#ifndef OPENMW_COMPONENTS_MISC_SPATIALGRID_H
+#define OPENMW_COMPONENTS_MISC_SPATIALGRID_H
+
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Misc
+{
+    /// \class SpatialGrid
+    /// Uniform grid over the XY plane storing values together with their positions. Allows to find values near a
+    /// point without iterating over all of them. A value is moved to another grid cell only when its position crosses
+    /// a cell border so updating positions of all values every frame is cheap.
+    template <typename T, typename Hash = std::hash<T>>
+    class SpatialGrid
+    {
+    public:
+        explicit SpatialGrid(float cellSize)
+            : mCellSize(cellSize)
+        {
+            assert(cellSize > 0);
+        }
+
+        float getCellSize() const { return mCellSize; }
+
+        std::size_t size() const { return mLocations.size(); }
+
+        /// Adds the value or updates its position.
+        void update(const T& value, const osg::Vec3f& position)
+        {
+            const std::uint64_t cell = getCell(position);
+            const auto it = mLocations.find(value);
+            if (it != mLocations.end())
+            {
+                if (it->second.mCell == cell)
+                {
+                    mCells.find(cell)->second[it->second.mIndex].mPosition = position;
+                    return;
+                }
+                erase(it->second);
+                mLocations.erase(it);
+            }
+            std::vector<Item>& items = mCells[cell];
+            mLocations.emplace(value, Location{ cell, items.size() });
+            items.push_back(Item{ value, position });
+        }
+
+        /// \return Was the value present?
+        bool remove(const T& value)
+        {
+            const auto it = mLocations.find(value);
+            if (it == mLocations.end())
+                return false;
+            erase(it->second);
+            mLocations.erase(it);
+            return true;
+        }
+
+        void clear()
+        {
+            mCells.clear();
+            mLocations.clear();
+        }
+
+        /// Sets the position of each value to f(value, position). Cheaper than calling update for each value.
+        template <class F>
+        void updatePositions(F&& f)
+        {
+            std::vector<Item> moved;
+            for (auto& [cell, items] : mCells)
+            {
+                for (Item& item : items)
+                {
+                    item.mPosition = f(item.mValue, std::as_const(item.mPosition));
+                    if (getCell(item.mPosition) != cell)
+                        moved.push_back(item);
+                }
+            }
+            for (const Item& item : moved)
+                update(item.mValue, item.mPosition);
+        }
+
+        /// Calls f(value, position) for each value with the stored position within the radius around the given
+        /// position. Iteration stops when f returns false.
+        /// \return Was iteration completed?
+        template <class F>
+        bool forEachInRange(const osg::Vec3f& position, float radius, F&& f) const
+        {
+            const float radius2 = radius * radius;
+            return forEachInArea(position.x() - radius, position.y() - radius, position.x() + radius,
+                position.y() + radius, [&](const Item& item) {
+                    return (item.mPosition - position).length2() > radius2 || f(item.mValue, item.mPosition);
+                });
+        }
+
+        /// Calls f(value, position) for each value with the stored position within the axis aligned box. Iteration
+        /// stops when f returns false.
+        /// \return Was iteration completed?
+        template <class F>
+        bool forEachInBox(const osg::Vec3f& min, const osg::Vec3f& max, F&& f) const
+        {
+            return forEachInArea(min.x(), min.y(), max.x(), max.y(), [&](const Item& item) {
+                const osg::Vec3f& p = item.mPosition;
+                return p.x() < min.x() || p.y() < min.y() || p.z() < min.z() || p.x() > max.x() || p.y() > max.y()
+                    || p.z() > max.z() || f(item.mValue, p);
+            });
+        }
+
+        /// Finds up to count values nearest to the given position within maxDistance for which predicate(value)
+        /// returns true. Visits grid cells in rings around the position until no closer value can be found.
+        /// \return Pairs of squared distance and value sorted by distance.
+        template <class Predicate>
+        std::vector<std::pair<float, T>> findNearest(const osg::Vec3f& position, std::size_t count,
+            float maxDistance, Predicate&& predicate) const
+        {
+            std::vector<std::pair<float, T>> result;
+            if (count == 0 || mLocations.empty())
+                return result;
+
+            const float maxDistance2 = maxDistance * maxDistance;
+            const auto closer = [](const std::pair<float, T>& l, const std::pair<float, T>& r) {
+                return l.first < r.first;
+            };
+            // result is kept as a max-heap by distance to replace the farthest value when a closer one is found
+            const auto visitItems = [&](const std::vector<Item>& items) {
+                for (const Item& item : items)
+                {
+                    const float distance2 = (item.mPosition - position).length2();
+                    if (distance2 > maxDistance2 || (result.size() == count && distance2 >= result.front().first)
+                        || !predicate(item.mValue))
+                        continue;
+                    if (result.size() == count)
+                    {
+                        std::pop_heap(result.begin(), result.end(), closer);
+                        result.pop_back();
+                    }
+                    result.emplace_back(distance2, item.mValue);
+                    std::push_heap(result.begin(), result.end(), closer);
+                }
+            };
+            const auto visitCell = [&](int x, int y) {
+                const auto it = mCells.find(makeCell(x, y));
+                if (it != mCells.end())
+                    visitItems(it->second);
+            };
+
+            const int centerX = static_cast<int>(std::floor(position.x() / mCellSize));
+            const int centerY = static_cast<int>(std::floor(position.y() / mCellSize));
+            for (int ring = 0;; ++ring)
+            {
+                // Any position in the ring is at least this far from the center cell
+                const float minDistance = static_cast<float>(std::max(ring - 1, 0)) * mCellSize;
+                if (minDistance > maxDistance
+                    || (result.size() == count && minDistance * minDistance >= result.front().first))
+                    break;
+
+                // Wide ring covers more grid cells than there are occupied ones, visiting occupied is cheaper
+                const float side = static_cast<float>(2 * ring + 1);
+                if (side * side > static_cast<float>(mCells.size()))
+                {
+                    for (const auto& [cell, items] : mCells)
+                    {
+                        const auto [x, y] = getCellCoordinates(cell);
+                        if (std::max(std::abs(x - centerX), std::abs(y - centerY)) >= ring)
+                            visitItems(items);
+                    }
+                    break;
+                }
+
+                if (ring == 0)
+                {
+                    visitCell(centerX, centerY);
+                    continue;
+                }
+                for (int x = centerX - ring; x <= centerX + ring; ++x)
+                {
+                    visitCell(x, centerY - ring);
+                    visitCell(x, centerY + ring);
+                }
+                for (int y = centerY - ring + 1; y < centerY + ring; ++y)
+                {
+                    visitCell(centerX - ring, y);
+                    visitCell(centerX + ring, y);
+                }
+            }
+
+            std::sort_heap(result.begin(), result.end(), closer);
+            return result;
+        }
+
+    private:
+        struct Item
+        {
+            T mValue;
+            osg::Vec3f mPosition;
+        };
+
+        struct Location
+        {
+            std::uint64_t mCell;
+            std::size_t mIndex;
+        };
+
+        float mCellSize;
+        std::unordered_map<std::uint64_t, std::vector<Item>> mCells;
+        std::unordered_map<T, Location, Hash> mLocations;
+
+        static std::uint64_t makeCell(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        static std::pair<int, int> getCellCoordinates(std::uint64_t cell)
+        {
+            return { static_cast<std::int32_t>(static_cast<std::uint32_t>(cell >> 32)),
+                static_cast<std::int32_t>(static_cast<std::uint32_t>(cell)) };
+        }
+
+        /// Calls f(item) for each item in the grid cells overlapping the area until f returns false.
+        template <class F>
+        bool forEachInArea(float minX, float minY, float maxX, float maxY, F&& f) const
+        {
+            const float minCellX = std::floor(minX / mCellSize);
+            const float maxCellX = std::floor(maxX / mCellSize);
+            const float minCellY = std::floor(minY / mCellSize);
+            const float maxCellY = std::floor(maxY / mCellSize);
+
+            const auto visitItems = [&](const std::vector<Item>& items) {
+                for (const Item& item : items)
+                    if (!f(item))
+                        return false;
+                return true;
+            };
+
+            // Large area covers more grid cells than there are occupied ones, visiting occupied is cheaper
+            if ((maxCellX - minCellX + 1) * (maxCellY - minCellY + 1) > static_cast<float>(mCells.size()))
+            {
+                for (const auto& [cell, items] : mCells)
+                {
+                    const auto [x, y] = getCellCoordinates(cell);
+                    if (x >= minCellX && x <= maxCellX && y >= minCellY && y <= maxCellY && !visitItems(items))
+                        return false;
+                }
+                return true;
+            }
+
+            for (int x = static_cast<int>(minCellX), endX = static_cast<int>(maxCellX); x <= endX; ++x)
+            {
+                for (int y = static_cast<int>(minCellY), endY = static_cast<int>(maxCellY); y <= endY; ++y)
+                {
+                    const auto it = mCells.find(makeCell(x, y));
+                    if (it != mCells.end() && !visitItems(it->second))
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        std::uint64_t getCell(const osg::Vec3f& position) const
+        {
+            return makeCell(static_cast<int>(std::floor(position.x() / mCellSize)),
+                static_cast<int>(std::floor(position.y() / mCellSize)));
+        }
+
+        void erase(const Location& location)
+        {
+            const auto cellIt = mCells.find(location.mCell);
+            std::vector<Item>& items = cellIt->second;
+            if (location.mIndex + 1 != items.size())
+            {
+                items[location.mIndex] = std::move(items.back());
+                mLocations.find(items[location.mIndex].mValue)->second.mIndex = location.mIndex;
+            }
+            items.pop_back();
+            if (items.empty())
+                mCells.erase(cellIt);
+        }
+    };
+}
+
+#endif
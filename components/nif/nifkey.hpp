@@ -3,7 +3,11 @@
 #ifndef OPENMW_COMPONENTS_NIF_NIFKEY_HPP
 #define OPENMW_COMPONENTS_NIF_NIFKEY_HPP
 
-#include <map>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <vector>
 
 #include "exception.hpp"
 #include "niffile.hpp"
@@ -44,13 +48,14 @@ namespace Nif
     template <typename T, T (NIFStream::*getValue)()>
     struct KeyMapT
     {
-        using MapType = std::map<float, KeyT<T>>;
-
         using ValueType = T;
         using KeyType = KeyT<T>;
 
         unsigned int mInterpolationType = InterpolationType_Unknown;
-        MapType mKeys;
+        // Key times and keys stored in separate arrays sorted by time without duplicates. Lookups only touch the
+        // contiguous times array.
+        std::vector<float> mTimes;
+        std::vector<KeyType> mKeys;
 
         // Read in a KeyGroup (see http://niftools.sourceforge.net/doc/nif/NiKeyframeData.html)
         void read(NIFStream* nif, bool morph = false)
@@ -79,27 +84,27 @@ namespace Nif
             {
                 for (size_t i = 0; i < count; i++)
                 {
-                    float time = nif->getFloat();
+                    mTimes.push_back(nif->getFloat());
                     readValue(*nif, key);
-                    mKeys[time] = key;
+                    mKeys.push_back(key);
                 }
             }
             else if (mInterpolationType == InterpolationType_Quadratic)
             {
                 for (size_t i = 0; i < count; i++)
                 {
-                    float time = nif->getFloat();
+                    mTimes.push_back(nif->getFloat());
                     readQuadratic(*nif, key);
-                    mKeys[time] = key;
+                    mKeys.push_back(key);
                 }
             }
             else if (mInterpolationType == InterpolationType_TBC)
             {
                 for (size_t i = 0; i < count; i++)
                 {
-                    float time = nif->getFloat();
+                    mTimes.push_back(nif->getFloat());
                     readTBC(*nif, key);
-                    mKeys[time] = key;
+                    mKeys.push_back(key);
                 }
             }
             else if (mInterpolationType == InterpolationType_XYZ)
@@ -116,9 +121,42 @@ namespace Nif
                 throw Nif::Exception("Unhandled interpolation type: " + std::to_string(mInterpolationType),
                     nif->getFile().getFilename());
             }
+
+            sort();
         }
 
     private:
+        // Keys are almost always stored in order. Otherwise sort them keeping the last one of the keys with the same
+        // time.
+        void sort()
+        {
+            if (std::adjacent_find(mTimes.begin(), mTimes.end(), std::greater_equal<float>()) == mTimes.end())
+                return;
+
+            std::vector<std::size_t> order(mTimes.size());
+            std::iota(order.begin(), order.end(), std::size_t(0));
+            std::stable_sort(
+                order.begin(), order.end(), [&](std::size_t l, std::size_t r) { return mTimes[l] < mTimes[r]; });
+
+            std::vector<float> times;
+            std::vector<KeyType> keys;
+            times.reserve(order.size());
+            keys.reserve(order.size());
+            for (const std::size_t i : order)
+            {
+                if (!times.empty() && times.back() == mTimes[i])
+                {
+                    keys.back() = mKeys[i];
+                    continue;
+                }
+                times.push_back(mTimes[i]);
+                keys.push_back(mKeys[i]);
+            }
+
+            mTimes = std::move(times);
+            mKeys = std::move(keys);
+        }
+
         static void readValue(NIFStream& nif, KeyT<T>& key) { key.mValue = (nif.*getValue)(); }
 
         template <typename U>
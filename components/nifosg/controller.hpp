@@ -9,8 +9,12 @@
 #include <components/sceneutil/nodecallback.hpp>
 #include <components/sceneutil/statesetupdater.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <set>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <osg/Texture2D>
 
@@ -39,23 +43,24 @@ namespace NifOsg
     template <typename MapT>
     class ValueInterpolator
     {
-        typename MapT::MapType::const_iterator retrieveKey(float time) const
+        // Returns index of the first key with time not less than the given one
+        std::size_t retrieveKey(float time) const
         {
-            // retrieve the current position in the map, optimized for the most common case
+            const std::vector<float>& times = mKeys->mTimes;
+            // retrieve the current position in the track, optimized for the most common case
             // where time moves linearly along the keyframe track
-            if (mLastHighKey != mKeys->mKeys.end())
+            if (mLastHighKey != 0 && mLastHighKey < times.size())
             {
-                if (time > mLastHighKey->first)
+                if (time > times[mLastHighKey])
                 {
                     // try if we're there by incrementing one
-                    ++mLastLowKey;
                     ++mLastHighKey;
                 }
-                if (mLastHighKey != mKeys->mKeys.end() && time >= mLastLowKey->first && time <= mLastHighKey->first)
+                if (mLastHighKey < times.size() && time >= times[mLastHighKey - 1] && time <= times[mLastHighKey])
                     return mLastHighKey;
             }
 
-            return mKeys->mKeys.lower_bound(time);
+            return static_cast<std::size_t>(std::lower_bound(times.begin(), times.end(), time) - times.begin());
         }
 
     public:
@@ -76,22 +81,12 @@ namespace NifOsg
             if (interpolator->data.empty())
                 return;
             mKeys = interpolator->data->mKeyList;
-            if (mKeys)
-            {
-                mLastLowKey = mKeys->mKeys.end();
-                mLastHighKey = mKeys->mKeys.end();
-            }
         }
 
         ValueInterpolator(std::shared_ptr<const MapT> keys, ValueT defaultVal = ValueT())
-            : mKeys(keys)
+            : mKeys(std::move(keys))
             , mDefaultVal(defaultVal)
         {
-            if (keys)
-            {
-                mLastLowKey = mKeys->mKeys.end();
-                mLastHighKey = mKeys->mKeys.end();
-            }
         }
 
         ValueT interpKey(float time) const
@@ -99,26 +94,27 @@ namespace NifOsg
             if (empty())
                 return mDefaultVal;
 
-            const typename MapT::MapType& keys = mKeys->mKeys;
+            const std::vector<float>& times = mKeys->mTimes;
+            const std::vector<typename MapT::KeyType>& keys = mKeys->mKeys;
 
-            if (time <= keys.begin()->first)
-                return keys.begin()->second.mValue;
+            if (time <= times.front())
+                return keys.front().mValue;
 
-            typename MapT::MapType::const_iterator it = retrieveKey(time);
+            const std::size_t high = retrieveKey(time);
 
             // now do the actual interpolation
-            if (it != keys.end())
+            if (high != times.size())
             {
                 // cache for next time
-                mLastHighKey = it;
-                mLastLowKey = --it;
+                mLastHighKey = high;
+                const std::size_t low = high - 1;
 
-                float a = (time - mLastLowKey->first) / (mLastHighKey->first - mLastLowKey->first);
+                float a = (time - times[low]) / (times[high] - times[low]);
 
-                return interpolate(mLastLowKey->second, mLastHighKey->second, a, mKeys->mInterpolationType);
+                return interpolate(keys[low], keys[high], a, mKeys->mInterpolationType);
             }
 
-            return keys.rbegin()->second.mValue;
+            return keys.back().mValue;
         }
 
         bool empty() const { return !mKeys || mKeys->mKeys.empty(); }
@@ -171,8 +167,8 @@ namespace NifOsg
             }
         }
 
-        mutable typename MapT::MapType::const_iterator mLastLowKey;
-        mutable typename MapT::MapType::const_iterator mLastHighKey;
+        // Index of the last used key interpolated with the previous one, 0 when there is none
+        mutable std::size_t mLastHighKey = 0;
 
         std::shared_ptr<const MapT> mKeys;
 
@@ -28,6 +28,10 @@ namespace NifOsg
     class Loader
     {
     public:
+        /// Version of the scene graphs created by load. Increment when the result for the same NIF file changes to
+        /// make scene graphs cached on disk by previous versions unused.
+        static constexpr unsigned sVersion = 1;
+
         /// Create a scene graph for the given NIF. Auto-detects when skinning is used and wraps the graph in a Skeleton
         /// if so.
         static osg::ref_ptr<osg::Node> load(Nif::FileView file, Resource::ImageManager* imageManager);
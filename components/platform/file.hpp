@@ -21,6 +21,9 @@ namespace Platform::File
 
     Handle open(const std::filesystem::path& filename);
 
+    /// Creates a new file or truncates the existing one and opens it for writing
+    Handle create(const std::filesystem::path& filename);
+
     void close(Handle handle);
 
     size_t size(Handle handle);
@@ -30,6 +33,12 @@ namespace Platform::File
 
     size_t read(Handle handle, void* data, size_t size);
 
+    /// Writes all of the data, throws on failure
+    void write(Handle handle, const void* data, size_t size);
+
+    /// Flushes written data to the storage device
+    void sync(Handle handle);
+
     class ScopedHandle
     {
         Handle mHandle{ Handle::Invalid };
@@ -49,6 +49,23 @@ namespace Platform::File
         return static_cast<Handle>(handle);
     }
 
+    Handle create(const std::filesystem::path& filename)
+    {
+#ifdef O_BINARY
+        static const int openFlags = O_WRONLY | O_CREAT | O_TRUNC | O_BINARY;
+#else
+        static const int openFlags = O_WRONLY | O_CREAT | O_TRUNC;
+#endif
+
+        auto handle = ::open(filename.c_str(), openFlags, 0644);
+        if (handle == -1)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                std::string("Failed to open '") + Files::pathToUnicodeString(filename) + "' for writing");
+        }
+        return static_cast<Handle>(handle);
+    }
+
     void close(Handle handle)
     {
         auto nativeHandle = getNativeHandle(handle);
@@ -103,4 +120,34 @@ namespace Platform::File
         return amount;
     }
 
+    void write(Handle handle, const void* data, size_t size)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        const char* ptr = static_cast<const char*>(data);
+        while (size > 0)
+        {
+            const auto amount = ::write(nativeHandle, ptr, size);
+            if (amount == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+                throw std::system_error(
+                    errno, std::generic_category(), "An attempt to write " + std::to_string(size) + " bytes failed");
+            }
+            ptr += amount;
+            size -= static_cast<size_t>(amount);
+        }
+    }
+
+    void sync(Handle handle)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        if (::fsync(nativeHandle) == -1)
+        {
+            throw std::system_error(errno, std::generic_category(), "An fsync() call failed");
+        }
+    }
+
 }
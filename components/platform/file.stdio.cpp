@@ -40,6 +40,17 @@ namespace Platform::File
         return static_cast<Handle>(reinterpret_cast<intptr_t>(handle));
     }
 
+    Handle create(const std::filesystem::path& filename)
+    {
+        FILE* handle = fopen(filename.c_str(), "wb");
+        if (handle == nullptr)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                std::string("Failed to open '") + Files::pathToUnicodeString(filename) + "' for writing");
+        }
+        return static_cast<Handle>(reinterpret_cast<intptr_t>(handle));
+    }
+
     void close(Handle handle)
     {
         auto nativeHandle = getNativeHandle(handle);
@@ -93,4 +104,26 @@ namespace Platform::File
         return static_cast<size_t>(amount);
     }
 
+    void write(Handle handle, const void* data, size_t size)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        if (fwrite(data, 1, size, nativeHandle) != size)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                std::string("An attempt to write ") + std::to_string(size) + " bytes failed");
+        }
+    }
+
+    void sync(Handle handle)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        // Standard C has no way to flush the OS buffers, so only the stream buffer is flushed
+        if (fflush(nativeHandle) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(), std::string("An fflush() call failed"));
+        }
+    }
+
 }
@@ -1,5 +1,6 @@
 #include "file.hpp"
 
+#include <algorithm>
 #include <boost/locale.hpp>
 #include <cassert>
 #include <components/windows.hpp>
@@ -40,6 +41,17 @@ namespace Platform::File
         return static_cast<Handle>(reinterpret_cast<intptr_t>(handle));
     }
 
+    Handle create(const std::filesystem::path& filename)
+    {
+        HANDLE handle = CreateFileW(filename.c_str(), GENERIC_WRITE, 0, 0, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, 0);
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error(std::string("Failed to open '") + Files::pathToUnicodeString(filename)
+                + "' for writing: " + std::to_string(GetLastError()));
+        }
+        return static_cast<Handle>(reinterpret_cast<intptr_t>(handle));
+    }
+
     void close(Handle handle)
     {
         auto nativeHandle = getNativeHandle(handle);
@@ -100,4 +112,32 @@ namespace Platform::File
 
         return bytesRead;
     }
+
+    void write(Handle handle, const void* data, size_t size)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        const char* ptr = static_cast<const char*>(data);
+        while (size > 0)
+        {
+            const DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, MAXDWORD));
+            DWORD bytesWritten{};
+
+            if (!WriteFile(nativeHandle, ptr, chunk, &bytesWritten, nullptr))
+                throw std::runtime_error(
+                    std::string("A write operation on a file failed: ") + std::to_string(GetLastError()));
+
+            ptr += bytesWritten;
+            size -= bytesWritten;
+        }
+    }
+
+    void sync(Handle handle)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        if (!FlushFileBuffers(nativeHandle))
+            throw std::runtime_error(
+                std::string("A flush operation on a file failed: ") + std::to_string(GetLastError()));
+    }
 }
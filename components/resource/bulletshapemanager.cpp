@@ -212,7 +212,7 @@ namespace Resource
 
     void BulletShapeManager::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Shape", mCache->getCacheSize());
+        Resource::reportStats("Shape", frameNumber, mCache->getStats(), *stats);
         stats->setAttribute(frameNumber, "Shape Instance", mInstanceCache->getCacheSize());
     }
 
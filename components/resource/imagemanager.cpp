@@ -199,7 +199,7 @@ namespace Resource
 
     void ImageManager::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Image", mCache->getCacheSize());
+        Resource::reportStats("Image", frameNumber, mCache->getStats(), *stats);
     }
 
 }
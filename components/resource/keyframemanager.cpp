@@ -247,7 +247,7 @@ namespace Resource
 
     void KeyframeManager::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Keyframe", mCache->getCacheSize());
+        Resource::reportStats("Keyframe", frameNumber, mCache->getStats(), *stats);
     }
 
 }
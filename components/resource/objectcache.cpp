@@ -0,0 +1,16 @@
+#include "objectcache.hpp"
+
+#include <osg/Stats>
+
+namespace Resource
+{
+    void reportStats(
+        std::string_view name, unsigned int frameNumber, const GenericObjectCacheStats& stats, osg::Stats& out)
+    {
+        const std::string prefix(name);
+        out.setAttribute(frameNumber, prefix, static_cast<double>(stats.mSize));
+        out.setAttribute(frameNumber, prefix + " Get", static_cast<double>(stats.mGetCount));
+        out.setAttribute(frameNumber, prefix + " Hit", static_cast<double>(stats.mHitCount));
+        out.setAttribute(frameNumber, prefix + " Contention", static_cast<double>(stats.mContentionCount));
+    }
+}
@@ -3,6 +3,9 @@
 // - removeExpiredObjectsInCache no longer keeps a lock while the unref happens.
 // - template allows customized KeyType.
 // - objects with uninitialized time stamp are not removed.
+// - objects are stored in hash maps split into independently locked shards.
+// - expiry visits only objects with outdated time stamps using per shard lists ordered by time stamp.
+// - external references are checked every quarter of expiry delay instead of every update.
 
 /* -*-c++-*- OpenSceneGraph - Copyright (C) 1998-2006 Robert Osfield
  *
@@ -20,25 +23,73 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_OBJECTCACHE
 #define OPENMW_COMPONENTS_RESOURCE_OBJECTCACHE
 
+#include <components/misc/hash.hpp>
+
 #include <osg/Node>
 #include <osg/Referenced>
+#include <osg/Vec2f>
 #include <osg/ref_ptr>
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
 
 namespace osg
 {
     class Object;
     class State;
     class NodeVisitor;
+    class Stats;
 }
 
 namespace Resource
 {
+    struct GenericObjectCacheStats
+    {
+        std::size_t mSize = 0;
+        std::size_t mGetCount = 0;
+        std::size_t mHitCount = 0;
+        std::size_t mContentionCount = 0;
+    };
+
+    /// Reports cache size as the name attribute and counters as attributes with "Get", "Hit" and "Contention" suffixes
+    void reportStats(std::string_view name, unsigned int frameNumber, const GenericObjectCacheStats& stats,
+        osg::Stats& out);
+
+    /// Hashes cache keys including tuples of osg vectors used as chunk ids
+    struct ObjectCacheKeyHash
+    {
+        template <class T>
+        std::size_t operator()(const T& value) const
+        {
+            return std::hash<T>()(value);
+        }
+
+        std::size_t operator()(const osg::Vec2f& value) const
+        {
+            std::size_t seed = 0;
+            Misc::hashCombine(seed, value.x());
+            Misc::hashCombine(seed, value.y());
+            return seed;
+        }
+
+        template <class... T>
+        std::size_t operator()(const std::tuple<T...>& value) const
+        {
+            std::size_t seed = 0;
+            std::apply([&](const auto&... v) { (Misc::hashCombine(seed, (*this)(v)), ...); }, value);
+            return seed;
+        }
+    };
 
-    template <typename KeyType>
+    template <typename KeyType, typename Hash = ObjectCacheKeyHash>
     class GenericObjectCache : public osg::Referenced
     {
     public:
@@ -47,123 +98,164 @@ namespace Resource
         {
         }
 
-        /** For each object in the cache which has an reference count greater than 1
-         * (and therefore referenced by elsewhere in the application) set the time stamp
-         * for that object in the cache to specified time.
-         * This would typically be called once per frame by applications which are doing database paging,
-         * and need to prune objects that are no longer required.
+        /** Remove objects which were not referenced outside of the cache and not requested for longer than
+         * expiryDelay. Only objects with time stamps at or before referenceTime - expiryDelay are visited, so the
+         * cost depends on the number of outdated objects rather than the cache size. Objects with uninitialized
+         * time stamp get referenceTime as a new time stamp when they are visited. Externally referenced objects are
+         * visited again after a quarter of expiryDelay, so an object is removed between 3/4 and 1 expiryDelay after
+         * its last external reference is gone instead of being kept for an extra expiryDelay until it is noticed.
+         * This would typically be called once per frame by applications which are doing database paging.
          * The time used should be taken from the FrameStamp::getReferenceTime().*/
-        void updateTimeStampOfObjectsInCacheWithExternalReferences(double referenceTime)
-        {
-            // look for objects with external references and update their time stamp.
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for (typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
-            {
-                // If ref count is greater than 1, the object has an external reference.
-                // If the timestamp is yet to be initialized, it needs to be updated too.
-                if ((itr->second.first != nullptr && itr->second.first->referenceCount() > 1)
-                    || itr->second.second == 0.0)
-                    itr->second.second = referenceTime;
-            }
-        }
-
-        /** Removed object in the cache which have a time stamp at or before the specified expiry time.
-         * This would typically be called once per frame by applications which are doing database paging,
-         * and need to prune objects that are no longer required, and called after the a called
-         * after the call to updateTimeStampOfObjectsInCacheWithExternalReferences(expirtyTime).*/
-        void removeExpiredObjectsInCache(double expiryTime)
+        void update(double referenceTime, double expiryDelay)
         {
-            std::vector<osg::ref_ptr<osg::Object>> objectsToRemove;
+            const double expiryTime = referenceTime - expiryDelay;
+            const double checkInterval = expiryDelay * sReferenceCheckFraction;
+            for (Shard& shard : mShards)
             {
-                std::lock_guard<std::mutex> lock(_objectCacheMutex);
-                // Remove expired entries from object cache
-                typename ObjectCacheMap::iterator oitr = _objectCache.begin();
-                while (oitr != _objectCache.end())
+                std::list<Item> removed;
                 {
-                    if (oitr->second.second <= expiryTime)
+                    const std::unique_lock<std::mutex> lock = lockShard(shard);
+                    std::list<Item> referenced;
+                    std::list<Item> released;
+                    std::list<Item> uninitialized;
+                    while (!shard.mItems.empty() && shard.mItems.front().mTimeStamp <= expiryTime)
                     {
-                        objectsToRemove.push_back(oitr->second.first);
-                        _objectCache.erase(oitr++);
+                        const auto it = shard.mItems.begin();
+                        // If ref count is greater than 1, the object has an external reference.
+                        if (it->mObject != nullptr && it->mObject->referenceCount() > 1)
+                        {
+                            it->mTimeStamp = expiryTime + checkInterval;
+                            it->mExternallyReferenced = true;
+                            referenced.splice(referenced.end(), shard.mItems, it);
+                        }
+                        else if (it->mExternallyReferenced)
+                        {
+                            // The reference was dropped within the last check interval
+                            it->mTimeStamp = referenceTime - checkInterval;
+                            it->mExternallyReferenced = false;
+                            released.splice(released.end(), shard.mItems, it);
+                        }
+                        else if (it->mTimeStamp == 0.0)
+                        {
+                            it->mTimeStamp = referenceTime;
+                            uninitialized.splice(uninitialized.end(), shard.mItems, it);
+                        }
+                        else
+                        {
+                            shard.mIndex.erase(it->mKey);
+                            removed.splice(removed.end(), shard.mItems, it);
+                        }
                     }
-                    else
-                        ++oitr;
+                    shard.mItems.splice(findInsertPosition(shard.mItems, expiryTime + checkInterval), referenced);
+                    shard.mItems.splice(findInsertPosition(shard.mItems, referenceTime - checkInterval), released);
+                    shard.mItems.splice(findInsertPosition(shard.mItems, referenceTime), uninitialized);
                 }
+                // note, actual unref happens outside of the lock
             }
-            // note, actual unref happens outside of the lock
-            objectsToRemove.clear();
         }
 
         /** Remove all objects in the cache regardless of having external references or expiry times.*/
         void clear()
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            _objectCache.clear();
+            for (Shard& shard : mShards)
+            {
+                std::list<Item> removed;
+                {
+                    const std::unique_lock<std::mutex> lock = lockShard(shard);
+                    shard.mIndex.clear();
+                    removed.swap(shard.mItems);
+                }
+            }
         }
 
         /** Add a key,object,timestamp triple to the Registry::ObjectCache.*/
         void addEntryToObjectCache(const KeyType& key, osg::Object* object, double timestamp = 0.0)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            _objectCache[key] = ObjectTimeStampPair(object, timestamp);
+            osg::ref_ptr<osg::Object> replaced;
+            Shard& shard = getShard(key);
+            const std::unique_lock<std::mutex> lock = lockShard(shard);
+            const auto it = shard.mIndex.find(key);
+            if (it != shard.mIndex.end())
+            {
+                replaced = std::move(it->second->mObject);
+                it->second->mObject = object;
+                it->second->mTimeStamp = timestamp;
+                it->second->mExternallyReferenced = false;
+                shard.mItems.splice(findInsertPosition(shard.mItems, timestamp), shard.mItems, it->second);
+                return;
+            }
+            const auto position = findInsertPosition(shard.mItems, timestamp);
+            const auto inserted = shard.mItems.insert(position, Item{ key, object, timestamp, false });
+            shard.mIndex.emplace(key, inserted);
         }
 
         /** Remove Object from cache.*/
         void removeFromObjectCache(const KeyType& key)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr != _objectCache.end())
-                _objectCache.erase(itr);
+            std::list<Item> removed;
+            Shard& shard = getShard(key);
+            const std::unique_lock<std::mutex> lock = lockShard(shard);
+            const auto it = shard.mIndex.find(key);
+            if (it == shard.mIndex.end())
+                return;
+            removed.splice(removed.end(), shard.mItems, it->second);
+            shard.mIndex.erase(it);
         }
 
         /** Get an ref_ptr<Object> from the object cache*/
         osg::ref_ptr<osg::Object> getRefFromObjectCache(const KeyType& key)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr != _objectCache.end())
-                return itr->second.first;
-            else
+            Shard& shard = getShard(key);
+            const std::unique_lock<std::mutex> lock = lockShard(shard);
+            mGetCount.fetch_add(1, std::memory_order_relaxed);
+            const auto it = shard.mIndex.find(key);
+            if (it == shard.mIndex.end())
                 return nullptr;
+            mHitCount.fetch_add(1, std::memory_order_relaxed);
+            return it->second->mObject;
         }
 
         /** Check if an object is in the cache, and if it is, update its usage time stamp. */
         bool checkInObjectCache(const KeyType& key, double timeStamp)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr != _objectCache.end())
-            {
-                itr->second.second = timeStamp;
-                return true;
-            }
-            else
+            Shard& shard = getShard(key);
+            const std::unique_lock<std::mutex> lock = lockShard(shard);
+            mGetCount.fetch_add(1, std::memory_order_relaxed);
+            const auto it = shard.mIndex.find(key);
+            if (it == shard.mIndex.end())
                 return false;
+            mHitCount.fetch_add(1, std::memory_order_relaxed);
+            it->second->mTimeStamp = timeStamp;
+            shard.mItems.splice(findInsertPosition(shard.mItems, timeStamp), shard.mItems, it->second);
+            return true;
         }
 
         /** call releaseGLObjects on all objects attached to the object cache.*/
         void releaseGLObjects(osg::State* state)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for (typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
+            for (Shard& shard : mShards)
             {
-                osg::Object* object = itr->second.first.get();
-                object->releaseGLObjects(state);
+                const std::unique_lock<std::mutex> lock = lockShard(shard);
+                for (const Item& item : shard.mItems)
+                    item.mObject->releaseGLObjects(state);
             }
         }
 
         /** call node->accept(nv); for all nodes in the objectCache. */
         void accept(osg::NodeVisitor& nv)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for (typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
+            for (Shard& shard : mShards)
             {
-                osg::Object* object = itr->second.first.get();
-                if (object)
+                const std::unique_lock<std::mutex> lock = lockShard(shard);
+                for (const Item& item : shard.mItems)
                 {
-                    osg::Node* node = dynamic_cast<osg::Node*>(object);
-                    if (node)
-                        node->accept(nv);
+                    osg::Object* object = item.mObject.get();
+                    if (object)
+                    {
+                        osg::Node* node = dynamic_cast<osg::Node*>(object);
+                        if (node)
+                            node->accept(nv);
+                    }
                 }
             }
         }
@@ -172,26 +264,93 @@ namespace Resource
         template <class Functor>
         void call(Functor& f)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for (typename ObjectCacheMap::iterator it = _objectCache.begin(); it != _objectCache.end(); ++it)
-                f(it->first, it->second.first.get());
+            for (Shard& shard : mShards)
+            {
+                const std::unique_lock<std::mutex> lock = lockShard(shard);
+                for (const Item& item : shard.mItems)
+                    f(item.mKey, item.mObject.get());
+            }
         }
 
         /** Get the number of objects in the cache. */
         unsigned int getCacheSize() const
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            return _objectCache.size();
+            std::size_t result = 0;
+            for (const Shard& shard : mShards)
+            {
+                const std::unique_lock<std::mutex> lock = lockShard(shard);
+                result += shard.mIndex.size();
+            }
+            return static_cast<unsigned int>(result);
+        }
+
+        GenericObjectCacheStats getStats() const
+        {
+            GenericObjectCacheStats result;
+            result.mSize = getCacheSize();
+            result.mGetCount = mGetCount.load(std::memory_order_relaxed);
+            result.mHitCount = mHitCount.load(std::memory_order_relaxed);
+            result.mContentionCount = mContentionCount.load(std::memory_order_relaxed);
+            return result;
         }
 
     protected:
         virtual ~GenericObjectCache() {}
 
-        typedef std::pair<osg::ref_ptr<osg::Object>, double> ObjectTimeStampPair;
-        typedef std::map<KeyType, ObjectTimeStampPair> ObjectCacheMap;
+    private:
+        static constexpr std::size_t sShardsCount = 16;
+        // Part of expiry delay after which externally referenced objects are checked again
+        static constexpr double sReferenceCheckFraction = 0.25;
+
+        struct Item
+        {
+            KeyType mKey;
+            osg::ref_ptr<osg::Object> mObject;
+            double mTimeStamp;
+            bool mExternallyReferenced;
+        };
+
+        struct Shard
+        {
+            mutable std::mutex mMutex;
+            // Ordered by time stamp, the oldest first. Uninitialized time stamps are 0 and go first.
+            std::list<Item> mItems;
+            std::unordered_map<KeyType, typename std::list<Item>::iterator, Hash> mIndex;
+        };
+
+        std::array<Shard, sShardsCount> mShards;
+        mutable std::atomic_size_t mGetCount{ 0 };
+        mutable std::atomic_size_t mHitCount{ 0 };
+        mutable std::atomic_size_t mContentionCount{ 0 };
 
-        ObjectCacheMap _objectCache;
-        mutable std::mutex _objectCacheMutex;
+        Shard& getShard(const KeyType& key)
+        {
+            // Mix in the high bits, the low bits also select a bucket inside the shard
+            const std::size_t hash = Hash()(key);
+            return mShards[(hash ^ (hash >> 17) ^ (hash >> 31)) % sShardsCount];
+        }
+
+        // Time stamps usually come from the current frame, so the search from the end is short
+        static typename std::list<Item>::iterator findInsertPosition(std::list<Item>& items, double timeStamp)
+        {
+            if (items.empty() || timeStamp <= items.front().mTimeStamp)
+                return items.begin();
+            auto it = items.end();
+            while (std::prev(it)->mTimeStamp > timeStamp)
+                --it;
+            return it;
+        }
+
+        std::unique_lock<std::mutex> lockShard(const Shard& shard) const
+        {
+            std::unique_lock<std::mutex> lock(shard.mMutex, std::try_to_lock);
+            if (!lock.owns_lock())
+            {
+                mContentionCount.fetch_add(1, std::memory_order_relaxed);
+                lock.lock();
+            }
+            return lock;
+        }
     };
 
     class ObjectCache : public GenericObjectCache<std::string>
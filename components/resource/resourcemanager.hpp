@@ -49,11 +49,7 @@ namespace Resource
         virtual ~GenericResourceManager() {}
 
         /// Clear cache entries that have not been referenced for longer than expiryDelay.
-        void updateCache(double referenceTime) override
-        {
-            mCache->updateTimeStampOfObjectsInCacheWithExternalReferences(referenceTime);
-            mCache->removeExpiredObjectsInCache(referenceTime - mExpiryDelay);
-        }
+        void updateCache(double referenceTime) override { mCache->update(referenceTime, mExpiryDelay); }
 
         /// Clear all cache entries.
         void clearCache() override { mCache->clear(); }
@@ -0,0 +1,223 @@
+#include "scenefilecache.hpp"
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <osg/Drawable>
+#include <osg/Geometry>
+#include <osg/Node>
+#include <osg/NodeVisitor>
+#include <osg/StateSet>
+#include <osg/Texture>
+#include <osg/UserDataContainer>
+
+#include <osgDB/Options>
+#include <osgDB/Registry>
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/strings/format.hpp>
+#include <components/nifosg/matrixtransform.hpp>
+#include <components/nifosg/nifloader.hpp>
+#include <components/sceneutil/serialize.hpp>
+
+namespace Resource
+{
+    namespace
+    {
+        bool isOsgObject(const osg::Object& object)
+        {
+            return object.libraryName() == std::string_view("osg");
+        }
+
+        bool canCacheUserData(const osg::Object& object)
+        {
+            const osg::UserDataContainer* const container = object.getUserDataContainer();
+            if (container == nullptr)
+                return true;
+            if (!isOsgObject(*container) || container->getUserData() != nullptr)
+                return false;
+            for (unsigned i = 0; i < container->getNumUserObjects(); ++i)
+                if (!isOsgObject(*container->getUserObject(i)))
+                    return false;
+            return true;
+        }
+
+        bool canCacheAttribute(const osg::StateAttribute& attribute)
+        {
+            if (!isOsgObject(attribute) || attribute.getUpdateCallback() != nullptr
+                || attribute.getEventCallback() != nullptr || !canCacheUserData(attribute))
+                return false;
+            if (const osg::Texture* const texture = attribute.asTexture())
+                for (unsigned i = 0; i < texture->getNumImages(); ++i)
+                    if (const osg::Image* const image = texture->getImage(i);
+                        image != nullptr && image->getFileName().empty())
+                        return false;
+            return true;
+        }
+
+        bool canCacheStateSet(const osg::StateSet* stateSet)
+        {
+            if (stateSet == nullptr)
+                return true;
+            if (stateSet->getUpdateCallback() != nullptr || stateSet->getEventCallback() != nullptr
+                || !canCacheUserData(*stateSet))
+                return false;
+            for (const auto& [type, attribute] : stateSet->getAttributeList())
+                if (!canCacheAttribute(*attribute.first))
+                    return false;
+            for (const osg::StateSet::AttributeList& attributes : stateSet->getTextureAttributeList())
+                for (const auto& [type, attribute] : attributes)
+                    if (!canCacheAttribute(*attribute.first))
+                        return false;
+            for (const auto& [name, uniform] : stateSet->getUniformList())
+                if (uniform.first->getUpdateCallback() != nullptr || uniform.first->getEventCallback() != nullptr)
+                    return false;
+            return true;
+        }
+
+        bool canCacheNode(const osg::Node& node)
+        {
+            return node.getUpdateCallback() == nullptr && node.getEventCallback() == nullptr
+                && node.getCullCallback() == nullptr && node.getComputeBoundingSphereCallback() == nullptr
+                && canCacheUserData(node) && canCacheStateSet(node.getStateSet());
+        }
+
+        class CanCacheVisitor : public osg::NodeVisitor
+        {
+        public:
+            bool mResult = true;
+
+            CanCacheVisitor()
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            {
+            }
+
+            void apply(osg::Node& node) override
+            {
+                if (!isOsgObject(node) && dynamic_cast<const NifOsg::MatrixTransform*>(&node) == nullptr)
+                    mResult = false;
+                else if (!canCacheNode(node))
+                    mResult = false;
+                else
+                    traverse(node);
+            }
+
+            void apply(osg::Drawable& drawable) override
+            {
+                // Subclasses like SceneUtil::RigGeometry or osgParticle::ParticleSystem have no complete serializers
+                if (!isOsgObject(drawable) || drawable.asGeometry() == nullptr
+                    || drawable.className() != std::string_view("Geometry"))
+                    mResult = false;
+                else if (!canCacheNode(drawable) || drawable.getDrawCallback() != nullptr
+                    || drawable.getComputeBoundingBoxCallback() != nullptr)
+                    mResult = false;
+            }
+        };
+
+        std::string toHex(const SceneFileCache::Hash& hash)
+        {
+            return Misc::StringUtils::format("%016llx%016llx", static_cast<unsigned long long>(hash[0]),
+                static_cast<unsigned long long>(hash[1]));
+        }
+    }
+
+    SceneFileCache::SceneFileCache(const std::filesystem::path& path, osg::ref_ptr<osgDB::Options> readOptions)
+        : mPath(path)
+        , mReadOptions(std::move(readOptions))
+        , mWriteOptions(new osgDB::Options)
+        , mReaderWriter(osgDB::Registry::instance()->getReaderWriterForExtension("osgb"))
+    {
+        SceneUtil::registerLosslessSerializers();
+
+        // Images are loaded from the VFS through the read options when the scene graph is read back
+        mWriteOptions->setPluginStringData("WriteImageHint", "UseExternal");
+
+        if (mReaderWriter == nullptr)
+            Log(Debug::Error) << "Scene file cache is disabled: no readerwriter for 'osgb' found";
+
+        std::error_code ec;
+        std::filesystem::create_directories(mPath, ec);
+        if (ec)
+            Log(Debug::Error) << "Failed to create scene file cache directory " << mPath << ": " << ec.message();
+    }
+
+    SceneFileCache::~SceneFileCache() = default;
+
+    osg::ref_ptr<osg::Node> SceneFileCache::read(const Hash& fileHash) const
+    {
+        if (mReaderWriter == nullptr || !SceneUtil::hasGeometrySerializer())
+            return nullptr;
+
+        const std::filesystem::path filePath = getFilePath(fileHash);
+        std::ifstream stream(filePath, std::ios::binary);
+        if (!stream.is_open())
+            return nullptr;
+
+        const osgDB::ReaderWriter::ReadResult result = mReaderWriter->readNode(stream, mReadOptions);
+        if (!result.success() || result.getNode() == nullptr)
+        {
+            Log(Debug::Warning) << "Failed to read cached scene " << filePath << ": " << result.message();
+            // Let the scene graph be written again
+            stream.close();
+            std::error_code ec;
+            std::filesystem::remove(filePath, ec);
+            return nullptr;
+        }
+
+        return result.getNode();
+    }
+
+    void SceneFileCache::write(const Hash& fileHash, const osg::Node& node)
+    {
+        if (mReaderWriter == nullptr || !SceneUtil::hasGeometrySerializer() || !canCache(node))
+            return;
+
+        // Write to a temporary file first so other threads and later runs never see a partially written file
+        const std::filesystem::path filePath = getFilePath(fileHash);
+        std::filesystem::path temporaryPath = filePath;
+        temporaryPath += Misc::StringUtils::format(".%llu.tmp", static_cast<unsigned long long>(++mNextTemporaryFile));
+
+        {
+            std::ofstream stream(temporaryPath, std::ios::binary);
+            if (!stream.is_open())
+                return;
+
+            const osgDB::ReaderWriter::WriteResult result = mReaderWriter->writeNode(node, stream, mWriteOptions);
+            stream.close();
+            if (!result.success() || !stream)
+            {
+                Log(Debug::Warning) << "Failed to write cached scene " << filePath << ": " << result.message();
+                std::error_code ec;
+                std::filesystem::remove(temporaryPath, ec);
+                return;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temporaryPath, filePath, ec);
+        if (ec)
+        {
+            // Another thread or process may have stored the same scene graph already
+            std::filesystem::remove(temporaryPath, ec);
+        }
+    }
+
+    bool SceneFileCache::canCache(const osg::Node& node)
+    {
+        CanCacheVisitor visitor;
+        // The visitor doesn't modify the scene graph
+        const_cast<osg::Node&>(node).accept(visitor);
+        return visitor.mResult;
+    }
+
+    std::filesystem::path SceneFileCache::getFilePath(const Hash& fileHash) const
+    {
+        const std::string fileName = Misc::StringUtils::format("%s-%u-%d-%08x-%08x.osgb", toHex(fileHash),
+            NifOsg::Loader::sVersion, NifOsg::Loader::getShowMarkers(), NifOsg::Loader::getHiddenNodeMask(),
+            NifOsg::Loader::getIntersectionDisabledNodeMask());
+        return mPath / fileName;
+    }
+
+}
@@ -0,0 +1,61 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_SCENEFILECACHE_H
+#define OPENMW_COMPONENTS_RESOURCE_SCENEFILECACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+
+#include <osg/ref_ptr>
+
+namespace osg
+{
+    class Node;
+}
+
+namespace osgDB
+{
+    class Options;
+    class ReaderWriter;
+}
+
+namespace Resource
+{
+
+    /// @brief Persistent cache of scene graphs converted from NIF files. Each scene graph is stored as an .osgb file
+    /// in the cache directory named after the hash of the NIF file content and the NifOsg::Loader version and
+    /// options, so changed files and converter updates produce new entries instead of using stale ones.
+    /// @par Only scene graphs that are restored completely by the osg serializers are stored: callbacks, controllers,
+    /// particles, skinning and embedded textures are not supported. Referenced images are stored by file name and
+    /// loaded through the given options when a scene graph is read.
+    /// @note May be used from any thread.
+    class SceneFileCache
+    {
+    public:
+        using Hash = std::array<std::uint64_t, 2>;
+
+        SceneFileCache(const std::filesystem::path& path, osg::ref_ptr<osgDB::Options> readOptions);
+        ~SceneFileCache();
+
+        /// @return The cached scene graph for the NIF file with the given content hash or nullptr if there is none.
+        osg::ref_ptr<osg::Node> read(const Hash& fileHash) const;
+
+        /// Store the scene graph converted from the NIF file with the given content hash if it can be cached.
+        void write(const Hash& fileHash, const osg::Node& node);
+
+        /// Can the scene graph be restored completely from an .osgb file?
+        static bool canCache(const osg::Node& node);
+
+    private:
+        const std::filesystem::path mPath;
+        const osg::ref_ptr<osgDB::Options> mReadOptions;
+        const osg::ref_ptr<osgDB::Options> mWriteOptions;
+        osgDB::ReaderWriter* const mReaderWriter;
+        std::atomic_uint64_t mNextTemporaryFile{ 0 };
+
+        std::filesystem::path getFilePath(const Hash& fileHash) const;
+    };
+
+}
+
+#endif
@@ -54,6 +54,7 @@
 #include "imagemanager.hpp"
 #include "niffilemanager.hpp"
 #include "objectcache.hpp"
+#include "scenefilecache.hpp"
 
 namespace
 {
@@ -719,12 +720,31 @@ namespace Resource
         }
     }
 
+    osg::ref_ptr<osg::Node> loadNif(const std::string& normalizedFilename, const VFS::Manager* vfs,
+        Resource::ImageManager* imageManager, Resource::NifFileManager* nifFileManager,
+        Resource::SceneFileCache* sceneFileCache)
+    {
+        if (sceneFileCache == nullptr)
+            return NifOsg::Loader::load(*nifFileManager->get(normalizedFilename), imageManager);
+
+        // Hashing the file is much cheaper than parsing and converting it
+        const Resource::SceneFileCache::Hash fileHash
+            = Files::getHash(normalizedFilename, *vfs->get(normalizedFilename));
+        if (osg::ref_ptr<osg::Node> cached = sceneFileCache->read(fileHash))
+            return cached;
+
+        osg::ref_ptr<osg::Node> loaded = NifOsg::Loader::load(*nifFileManager->get(normalizedFilename), imageManager);
+        sceneFileCache->write(fileHash, *loaded);
+        return loaded;
+    }
+
     osg::ref_ptr<osg::Node> load(const std::string& normalizedFilename, const VFS::Manager* vfs,
-        Resource::ImageManager* imageManager, Resource::NifFileManager* nifFileManager)
+        Resource::ImageManager* imageManager, Resource::NifFileManager* nifFileManager,
+        Resource::SceneFileCache* sceneFileCache)
     {
         auto ext = Misc::getFileExtension(normalizedFilename);
         if (ext == "nif")
-            return NifOsg::Loader::load(*nifFileManager->get(normalizedFilename), imageManager);
+            return loadNif(normalizedFilename, vfs, imageManager, nifFileManager, sceneFileCache);
         else
             return loadNonNif(normalizedFilename, *vfs->get(normalizedFilename), imageManager);
     }
@@ -840,7 +860,7 @@ namespace Resource
             {
                 const std::string normalized = "meshes/marker_error." + std::string(meshType);
                 if (mVFS->exists(normalized))
-                    return load(normalized, mVFS, mImageManager, mNifFileManager);
+                    return load(normalized, mVFS, mImageManager, mNifFileManager, mSceneFileCache.get());
             }
         }
         catch (const std::exception& e)
@@ -872,7 +892,7 @@ namespace Resource
             osg::ref_ptr<osg::Node> loaded;
             try
             {
-                loaded = load(normalized, mVFS, mImageManager, mNifFileManager);
+                loaded = load(normalized, mVFS, mImageManager, mNifFileManager, mSceneFileCache.get());
 
                 SceneUtil::ProcessExtraDataVisitor extraDataVisitor(this);
                 loaded->accept(extraDataVisitor);
@@ -983,6 +1003,13 @@ namespace Resource
         mSharedStateManager->releaseGLObjects(state);
     }
 
+    void SceneManager::setSceneFileCachePath(const std::filesystem::path& path)
+    {
+        osg::ref_ptr<osgDB::Options> options(new osgDB::Options);
+        options->setReadFileCallback(new ImageReadCallback(mImageManager));
+        mSceneFileCache = std::make_unique<SceneFileCache>(path, std::move(options));
+    }
+
     void SceneManager::setIncrementalCompileOperation(osgUtil::IncrementalCompileOperation* ico)
     {
         mIncrementalCompileOperation = ico;
@@ -1109,7 +1136,7 @@ namespace Resource
             stats->setAttribute(frameNumber, "StateSet", mSharedStateManager->getNumSharedStateSets());
         }
 
-        stats->setAttribute(frameNumber, "Node", mCache->getCacheSize());
+        Resource::reportStats("Node", frameNumber, mCache->getStats(), *stats);
     }
 
     Shader::ShaderVisitor* SceneManager::createShaderVisitor(const std::string& shaderPrefix)
@@ -31,6 +31,7 @@ namespace Resource
 {
     class ImageManager;
     class NifFileManager;
+    class SceneFileCache;
     class SharedStateManager;
 }
 
@@ -189,6 +190,10 @@ namespace Resource
         /// in cases where multiple contexts are used over the lifetime of the application.
         void releaseGLObjects(osg::State* state) override;
 
+        /// Keep scene graphs converted from NIF files in the given directory to load them faster in later runs.
+        /// @note Not thread safe, call before loading any scene.
+        void setSceneFileCachePath(const std::filesystem::path& path);
+
         /// Set up an IncrementalCompileOperation for background compiling of loaded scenes.
         void setIncrementalCompileOperation(osgUtil::IncrementalCompileOperation* ico);
 
@@ -253,6 +258,7 @@ namespace Resource
 
         Resource::ImageManager* mImageManager;
         Resource::NifFileManager* mNifFileManager;
+        std::unique_ptr<Resource::SceneFileCache> mSceneFileCache;
 
         osg::Texture::FilterMode mMinFilter;
         osg::Texture::FilterMode mMagFilter;
@@ -368,7 +368,7 @@ namespace Resource
 
             unsigned int frameNumber = renderInfo.getState()->getFrameStamp()->getFrameNumber() - 1;
 
-            for (const auto& statName : mStatNames.get())
+            for (const auto& statName : mStatNames)
             {
                 if (statName.empty())
                     viewStr << std::endl;
@@ -388,7 +388,7 @@ namespace Resource
         }
 
         osg::ref_ptr<osg::Stats> mStats;
-        std::reference_wrapper<const std::vector<std::string>> mStatNames;
+        std::vector<std::string> mStatNames;
     };
 
     void StatsHandler::setUpScene(osgViewer::ViewerBase* viewer)
@@ -424,22 +424,67 @@ namespace Resource
                 "Compiling",
                 "WorkQueue",
                 "WorkThread",
+                "WorkQueue Preload",
+                "WorkQueue Preload Latency",
+                "WorkQueue Terrain",
+                "WorkQueue Terrain Latency",
+                "WorkQueue GlobalMap",
+                "WorkQueue GlobalMap Latency",
+                "WorkQueue Unref",
+                "WorkQueue Unref Latency",
+                "WorkQueue NavMesh",
+                "WorkQueue NavMesh Latency",
+                "WorkQueue Other",
+                "WorkQueue Other Latency",
                 "UnrefQueue",
                 "",
                 "Texture",
                 "StateSet",
                 "Node",
+                "Node Get",
+                "Node Hit",
+                "Node Contention",
                 "Shape",
+                "Shape Get",
+                "Shape Hit",
+                "Shape Contention",
                 "Shape Instance",
                 "Image",
+                "Image Get",
+                "Image Hit",
+                "Image Contention",
                 "Nif",
+                "Nif Get",
+                "Nif Hit",
+                "Nif Contention",
                 "Keyframe",
+                "Keyframe Get",
+                "Keyframe Hit",
+                "Keyframe Contention",
                 "",
                 "Groundcover Chunk",
+                "Groundcover Chunk Get",
+                "Groundcover Chunk Hit",
+                "Groundcover Chunk Contention",
                 "Object Chunk",
+                "Object Chunk Get",
+                "Object Chunk Hit",
+                "Object Chunk Contention",
+                "Object Paging Cells",
+                "Object Paging Cells Get",
+                "Object Paging Cells Hit",
                 "Terrain Chunk",
+                "Terrain Chunk Get",
+                "Terrain Chunk Hit",
+                "Terrain Chunk Contention",
                 "Terrain Texture",
+                "Terrain Texture Get",
+                "Terrain Texture Hit",
+                "Terrain Texture Contention",
                 "Land",
+                "Land Get",
+                "Land Hit",
+                "Land Contention",
                 "Composite",
                 "",
                 "NavMesh Jobs",
@@ -455,6 +500,9 @@ namespace Resource
                 "NavMesh CachedTiles",
                 "NavMesh Cache Get",
                 "NavMesh Cache Hit",
+                "NavMesh Path Waiting",
+                "NavMesh Path Processing",
+                "NavMesh Path Done",
                 "",
                 "Mechanics Actors",
                 "Mechanics Objects",
@@ -467,53 +515,66 @@ namespace Resource
                 "Lua UsedMemory",
             });
 
-            static const auto longest = std::max_element(statNames.begin(), statNames.end(),
-                [](const std::string& lhs, const std::string& rhs) { return lhs.size() < rhs.size(); });
-            const float statNamesWidth = 13 * _characterSize + 2 * backgroundMargin;
+            const float statNamesWidth = 15 * _characterSize + 2 * backgroundMargin;
             const float statTextWidth = 7 * _characterSize + 2 * backgroundMargin;
-            const float statHeight = statNames.size() * _characterSize + 2 * backgroundMargin;
-            osg::Vec3 pos(_statsWidth - statNamesWidth - backgroundSpacing - statTextWidth, statHeight, 0.0f);
-
-            group->addChild(
-                createBackgroundRectangle(pos + osg::Vec3(-backgroundMargin, _characterSize + backgroundMargin, 0),
-                    statNamesWidth, statHeight, backgroundColor));
-
-            osg::ref_ptr<osgText::Text> staticText = new osgText::Text;
-            group->addChild(staticText.get());
-            staticText->setColor(staticTextColor);
-            staticText->setCharacterSize(_characterSize);
-            staticText->setPosition(pos);
-
-            std::ostringstream viewStr;
-            viewStr.clear();
-            viewStr.setf(std::ios::left, std::ios::adjustfield);
-            viewStr.width(longest->size());
-            for (const auto& statName : statNames)
+            const float columnWidth = statNamesWidth + backgroundSpacing + statTextWidth + backgroundSpacing;
+            // Split into columns placed from right to left when the names don't fit the screen height
+            const std::size_t maxRows
+                = std::max(static_cast<std::size_t>((_statsHeight - 2 * backgroundMargin) / _characterSize) - 1,
+                    std::size_t(1));
+            const float top = std::min(statNames.size(), maxRows) * _characterSize + 2 * backgroundMargin;
+
+            for (std::size_t begin = 0, column = 0; begin < statNames.size(); begin += maxRows, ++column)
             {
-                viewStr << statName << std::endl;
-            }
+                const std::vector<std::string> columnStatNames(statNames.begin() + begin,
+                    statNames.begin() + std::min(begin + maxRows, statNames.size()));
+                const auto longest = std::max_element(columnStatNames.begin(), columnStatNames.end(),
+                    [](const std::string& lhs, const std::string& rhs) { return lhs.size() < rhs.size(); });
+                const float statHeight = columnStatNames.size() * _characterSize + 2 * backgroundMargin;
+                osg::Vec3 pos(_statsWidth - (column + 1) * columnWidth + backgroundSpacing, top, 0.0f);
+
+                group->addChild(
+                    createBackgroundRectangle(pos + osg::Vec3(-backgroundMargin, _characterSize + backgroundMargin, 0),
+                        statNamesWidth, statHeight, backgroundColor));
+
+                osg::ref_ptr<osgText::Text> staticText = new osgText::Text;
+                group->addChild(staticText.get());
+                staticText->setColor(staticTextColor);
+                staticText->setCharacterSize(_characterSize);
+                staticText->setPosition(pos);
+
+                std::ostringstream viewStr;
+                viewStr.clear();
+                viewStr.setf(std::ios::left, std::ios::adjustfield);
+                viewStr.width(longest->size());
+                for (const auto& statName : columnStatNames)
+                {
+                    viewStr << statName << std::endl;
+                }
 
-            staticText->setText(viewStr.str());
+                staticText->setText(viewStr.str());
 
-            pos.x() += statNamesWidth + backgroundSpacing;
+                pos.x() += statNamesWidth + backgroundSpacing;
 
-            group->addChild(
-                createBackgroundRectangle(pos + osg::Vec3(-backgroundMargin, _characterSize + backgroundMargin, 0),
-                    statTextWidth, statHeight, backgroundColor));
+                group->addChild(
+                    createBackgroundRectangle(pos + osg::Vec3(-backgroundMargin, _characterSize + backgroundMargin, 0),
+                        statTextWidth, statHeight, backgroundColor));
 
-            osg::ref_ptr<osgText::Text> statsText = new osgText::Text;
-            group->addChild(statsText.get());
+                osg::ref_ptr<osgText::Text> statsText = new osgText::Text;
+                group->addChild(statsText.get());
 
-            statsText->setColor(dynamicTextColor);
-            statsText->setCharacterSize(_characterSize);
-            statsText->setPosition(pos);
-            statsText->setText("");
-            statsText->setDrawCallback(new ResourceStatsTextDrawCallback(viewer->getViewerStats(), statNames));
+                statsText->setColor(dynamicTextColor);
+                statsText->setCharacterSize(_characterSize);
+                statsText->setPosition(pos);
+                statsText->setText("");
+                statsText->setDrawCallback(
+                    new ResourceStatsTextDrawCallback(viewer->getViewerStats(), columnStatNames));
 
-            if (_textFont)
-            {
-                staticText->setFont(_textFont);
-                statsText->setFont(_textFont);
+                if (_textFont)
+                {
+                    staticText->setFont(_textFont);
+                    statsText->setFont(_textFont);
+                }
             }
         }
     }
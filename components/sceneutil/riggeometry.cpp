@@ -8,33 +8,10 @@
 #include <components/resource/scenemanager.hpp>
 
 #include "skeleton.hpp"
+#include "skinningbatch.hpp"
 #include "util.hpp"
 
-namespace
-{
-    inline void accumulateMatrix(
-        const osg::Matrixf& invBindMatrix, const osg::Matrixf& matrix, const float weight, osg::Matrixf& result)
-    {
-        osg::Matrixf m = invBindMatrix * matrix;
-        float* ptr = m.ptr();
-        float* ptrresult = result.ptr();
-        ptrresult[0] += ptr[0] * weight;
-        ptrresult[1] += ptr[1] * weight;
-        ptrresult[2] += ptr[2] * weight;
-
-        ptrresult[4] += ptr[4] * weight;
-        ptrresult[5] += ptr[5] * weight;
-        ptrresult[6] += ptr[6] * weight;
-
-        ptrresult[8] += ptr[8] * weight;
-        ptrresult[9] += ptr[9] * weight;
-        ptrresult[10] += ptr[10] * weight;
-
-        ptrresult[12] += ptr[12] * weight;
-        ptrresult[13] += ptr[13] * weight;
-        ptrresult[14] += ptr[14] * weight;
-    }
-}
+#include <map>
 
 namespace SceneUtil
 {
@@ -42,6 +19,7 @@ namespace SceneUtil
     RigGeometry::RigGeometry()
         : mSkeleton(nullptr)
         , mLastFrameNumber(0)
+        , mLastCullFrameNumber(0)
         , mBoundsFirstFrame(true)
     {
         setNumChildrenRequiringUpdateTraversal(1);
@@ -52,9 +30,10 @@ namespace SceneUtil
         : Drawable(copy, copyop)
         , mSkeleton(nullptr)
         , mInfluenceMap(copy.mInfluenceMap)
-        , mBone2VertexVector(copy.mBone2VertexVector)
+        , mSkinningData(copy.mSkinningData)
         , mBoneSphereVector(copy.mBoneSphereVector)
         , mLastFrameNumber(0)
+        , mLastCullFrameNumber(0)
         , mBoundsFirstFrame(true)
     {
         setSourceGeometry(copy.mSourceGeometry);
@@ -158,66 +137,56 @@ namespace SceneUtil
         }
 
         mBoneNodesVector.clear();
+        mBoneNodesVector.reserve(mBoneSphereVector->mData.size());
         for (auto& bonePair : mBoneSphereVector->mData)
         {
             const std::string& boneName = bonePair.first;
             Bone* bone = mSkeleton->getBone(boneName);
             if (!bone)
-            {
-                mBoneNodesVector.push_back(nullptr);
                 Log(Debug::Error) << "Error: RigGeometry did not find bone " << boneName;
-                continue;
-            }
-
             mBoneNodesVector.push_back(bone);
         }
 
-        for (auto& pair : mBone2VertexVector->mData)
-        {
-            for (auto& weight : pair.first)
-            {
-                const std::string& boneName = weight.first.first;
-                Bone* bone = mSkeleton->getBone(boneName);
-                if (!bone)
-                {
-                    mBoneNodesVector.push_back(nullptr);
-                    Log(Debug::Error) << "Error: RigGeometry did not find bone " << boneName;
-                    continue;
-                }
-
-                mBoneNodesVector.push_back(bone);
-            }
-        }
+        mBoneTransforms.resize(mBoneNodesVector.size());
+        mGroupTransforms.resize(mSkinningData->mInfluences.getGroupsCount());
 
         return true;
     }
 
-    void RigGeometry::cull(osg::NodeVisitor* nv)
+    bool RigGeometry::needSkinning(unsigned int traversalNumber) const
     {
-        if (!mSkeleton)
+        return mLastFrameNumber != traversalNumber && (mLastFrameNumber == 0 || mSkeleton->getActive());
+    }
+
+    bool RigGeometry::wasVisibleInPreviousFrame(unsigned int traversalNumber) const
+    {
+        return mLastCullFrameNumber != 0 && traversalNumber - mLastCullFrameNumber <= 1;
+    }
+
+    void RigGeometry::skin(unsigned int traversalNumber)
+    {
+        osg::Geometry& geom = *getGeometry(traversalNumber);
+
+        const std::vector<SkinTransform>& invBindMatrices = mSkinningData->mInvBindMatrices;
+        for (std::size_t i = 0; i < mBoneNodesVector.size(); ++i)
         {
-            Log(Debug::Error)
-                << "Error: RigGeometry rendering with no skeleton, should have been initialized by UpdateVisitor";
-            // try to recover anyway, though rendering is likely to be incorrect.
-            if (!initFromParentSkeleton(nv))
-                return;
+            const Bone* bone = mBoneNodesVector[i];
+            if (bone == nullptr)
+                mBoneTransforms[i] = SkinTransform{};
+            else
+                mBoneTransforms[i] = multiply(invBindMatrices[i], makeSkinTransform(bone->mMatrixInSkeletonSpace));
         }
 
-        unsigned int traversalNumber = nv->getTraversalNumber();
-        if (mLastFrameNumber == traversalNumber || (mLastFrameNumber != 0 && !mSkeleton->getActive()))
+        const SkinInfluences& influences = mSkinningData->mInfluences;
+        blendSkinTransforms(influences, mBoneTransforms, mGroupTransforms);
+
+        if (mGeomToSkelMatrix)
         {
-            osg::Geometry& geom = *getGeometry(mLastFrameNumber);
-            nv->pushOntoNodePath(&geom);
-            nv->apply(geom);
-            nv->popFromNodePath();
-            return;
+            const SkinTransform geomToSkel = makeSkinTransform(*mGeomToSkelMatrix);
+            for (SkinTransform& transform : mGroupTransforms)
+                transform = multiply(transform, geomToSkel);
         }
-        mLastFrameNumber = traversalNumber;
-        osg::Geometry& geom = *getGeometry(mLastFrameNumber);
 
-        mSkeleton->updateBoneMatrices(traversalNumber);
-
-        // skinning
         const osg::Vec3Array* positionSrc = static_cast<osg::Vec3Array*>(mSourceGeometry->getVertexArray());
         const osg::Vec3Array* normalSrc = static_cast<osg::Vec3Array*>(mSourceGeometry->getNormalArray());
         const osg::Vec4Array* tangentSrc = mSourceTangents;
@@ -226,39 +195,21 @@ namespace SceneUtil
         osg::Vec3Array* normalDst = static_cast<osg::Vec3Array*>(geom.getNormalArray());
         osg::Vec4Array* tangentDst = static_cast<osg::Vec4Array*>(geom.getTexCoordArray(7));
 
-        int index = mBoneSphereVector->mData.size();
-        for (auto& pair : mBone2VertexVector->mData)
+        SkinVertices vertices;
+        vertices.mSourcePositions = static_cast<const osg::Vec3f*>(positionSrc->getDataPointer());
+        vertices.mPositions = static_cast<osg::Vec3f*>(positionDst->getDataPointer());
+        if (normalDst)
         {
-            osg::Matrixf resultMat(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1);
-
-            for (auto& weight : pair.first)
-            {
-                Bone* bone = mBoneNodesVector[index];
-                if (bone == nullptr)
-                    continue;
-
-                accumulateMatrix(weight.first.second, bone->mMatrixInSkeletonSpace, weight.second, resultMat);
-                index++;
-            }
-
-            if (mGeomToSkelMatrix)
-                resultMat *= (*mGeomToSkelMatrix);
-
-            for (auto& vertex : pair.second)
-            {
-                (*positionDst)[vertex] = resultMat.preMult((*positionSrc)[vertex]);
-                if (normalDst)
-                    (*normalDst)[vertex] = osg::Matrixf::transform3x3((*normalSrc)[vertex], resultMat);
-
-                if (tangentDst)
-                {
-                    const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
-                    osg::Vec3f transformedTangent = osg::Matrixf::transform3x3(
-                        osg::Vec3f(srcTangent.x(), srcTangent.y(), srcTangent.z()), resultMat);
-                    (*tangentDst)[vertex] = osg::Vec4f(transformedTangent, srcTangent.w());
-                }
-            }
+            vertices.mSourceNormals = static_cast<const osg::Vec3f*>(normalSrc->getDataPointer());
+            vertices.mNormals = static_cast<osg::Vec3f*>(normalDst->getDataPointer());
         }
+        if (tangentDst)
+        {
+            vertices.mSourceTangents = static_cast<const osg::Vec4f*>(tangentSrc->getDataPointer());
+            vertices.mTangents = static_cast<osg::Vec4f*>(tangentDst->getDataPointer());
+        }
+
+        skinVertices(influences, mGroupTransforms, vertices);
 
         positionDst->dirty();
         if (normalDst)
@@ -267,7 +218,29 @@ namespace SceneUtil
             tangentDst->dirty();
 
         geom.osg::Drawable::dirtyGLObjects();
+    }
 
+    void RigGeometry::cull(osg::NodeVisitor* nv)
+    {
+        if (!mSkeleton)
+        {
+            Log(Debug::Error)
+                << "Error: RigGeometry rendering with no skeleton, should have been initialized by UpdateVisitor";
+            // try to recover anyway, though rendering is likely to be incorrect.
+            if (!initFromParentSkeleton(nv))
+                return;
+        }
+
+        const unsigned int traversalNumber = nv->getTraversalNumber();
+        mLastCullFrameNumber = traversalNumber;
+        if (needSkinning(traversalNumber))
+        {
+            mLastFrameNumber = traversalNumber;
+            mSkeleton->updateBoneMatrices(traversalNumber);
+            skin(traversalNumber);
+        }
+
+        osg::Geometry& geom = *getGeometry(mLastFrameNumber);
         nv->pushOntoNodePath(&geom);
         nv->apply(geom);
         nv->popFromNodePath();
@@ -289,17 +262,27 @@ namespace SceneUtil
 
         updateGeomToSkelMatrix(nv->getNodePath());
 
+        // Skinning can be done before cull for all RigGeometries in parallel. Only those that passed cull in the
+        // previous frame are added, others are skinned in cull if they become visible.
+        const unsigned int traversalNumber = nv->getTraversalNumber();
+        if (SkinningBatch* batch = dynamic_cast<SkinningBatch*>(nv->getUserData()))
+        {
+            if (wasVisibleInPreviousFrame(traversalNumber) && needSkinning(traversalNumber))
+            {
+                mLastFrameNumber = traversalNumber;
+                batch->add(*this, traversalNumber);
+            }
+        }
+
         osg::BoundingBox box;
 
-        int index = 0;
-        for (auto& boundPair : mBoneSphereVector->mData)
+        for (std::size_t i = 0; i < mBoneSphereVector->mData.size(); ++i)
         {
-            Bone* bone = mBoneNodesVector[index];
+            const Bone* bone = mBoneNodesVector[i];
             if (bone == nullptr)
                 continue;
 
-            index++;
-            osg::BoundingSpheref bs = boundPair.second;
+            osg::BoundingSpheref bs = mBoneSphereVector->mData[i].second;
             if (mGeomToSkelMatrix)
                 transformBoundingSphere(bone->mMatrixInSkeletonSpace * (*mGeomToSkelMatrix), bs);
             else
@@ -359,33 +342,43 @@ namespace SceneUtil
     {
         mInfluenceMap = influenceMap;
 
-        typedef std::map<unsigned short, std::vector<BoneWeight>> Vertex2BoneMap;
-        Vertex2BoneMap vertex2BoneMap;
+        // <influence index, weight>
+        using BoneWeights = std::vector<std::pair<std::uint16_t, float>>;
+        std::map<unsigned short, BoneWeights> vertex2BoneMap;
         mBoneSphereVector = new BoneSphereVector;
         mBoneSphereVector->mData.reserve(mInfluenceMap->mData.size());
-        mBone2VertexVector = new Bone2VertexVector;
-        for (auto& influencePair : mInfluenceMap->mData)
+        mSkinningData = new SkinningData;
+        mSkinningData->mInvBindMatrices.reserve(mInfluenceMap->mData.size());
+        for (std::size_t i = 0; i < mInfluenceMap->mData.size(); ++i)
         {
-            const std::string& boneName = influencePair.first;
-            const BoneInfluence& bi = influencePair.second;
+            const std::string& boneName = mInfluenceMap->mData[i].first;
+            const BoneInfluence& bi = mInfluenceMap->mData[i].second;
             mBoneSphereVector->mData.emplace_back(boneName, bi.mBoundSphere);
+            mSkinningData->mInvBindMatrices.push_back(makeSkinTransform(bi.mInvBindMatrix));
 
             for (auto& weightPair : bi.mWeights)
-            {
-                std::vector<BoneWeight>& vec = vertex2BoneMap[weightPair.first];
-
-                vec.emplace_back(std::make_pair(boneName, bi.mInvBindMatrix), weightPair.second);
-            }
+                vertex2BoneMap[weightPair.first].emplace_back(static_cast<std::uint16_t>(i), weightPair.second);
         }
 
-        Bone2VertexMap bone2VertexMap;
+        std::map<BoneWeights, std::vector<unsigned short>> bone2VertexMap;
         for (auto& vertexPair : vertex2BoneMap)
-        {
             bone2VertexMap[vertexPair.second].emplace_back(vertexPair.first);
-        }
 
-        mBone2VertexVector->mData.reserve(bone2VertexMap.size());
-        mBone2VertexVector->mData.assign(bone2VertexMap.begin(), bone2VertexMap.end());
+        SkinInfluences& influences = mSkinningData->mInfluences;
+        influences.mWeightOffsets.reserve(bone2VertexMap.size() + 1);
+        influences.mVertexOffsets.reserve(bone2VertexMap.size() + 1);
+        influences.mVertices.reserve(vertex2BoneMap.size());
+        for (const auto& [weights, vertices] : bone2VertexMap)
+        {
+            for (const auto& [bone, weight] : weights)
+            {
+                influences.mBones.push_back(bone);
+                influences.mWeights.push_back(weight);
+            }
+            influences.mWeightOffsets.push_back(static_cast<std::uint32_t>(influences.mBones.size()));
+            influences.mVertices.insert(influences.mVertices.end(), vertices.begin(), vertices.end());
+            influences.mVertexOffsets.push_back(static_cast<std::uint32_t>(influences.mVertices.size()));
+        }
     }
 
     void RigGeometry::accept(osg::NodeVisitor& nv)
@@ -4,6 +4,8 @@
 #include <osg/Geometry>
 #include <osg/Matrixf>
 
+#include "skinning.hpp"
+
 namespace SceneUtil
 {
     class Skeleton;
@@ -58,6 +60,11 @@ namespace SceneUtil
         osg::ref_ptr<osg::Geometry> getSourceGeometry() const;
 
         void accept(osg::NodeVisitor& nv) override;
+
+        /// Skins geometry to be rendered in the given frame. Bone matrices of the skeleton have to be updated.
+        /// @note Modifies only own data so different RigGeometries can be skinned in parallel.
+        void skin(unsigned int traversalNumber);
+
         bool supports(const osg::PrimitiveFunctor&) const override { return true; }
         void accept(osg::PrimitiveFunctor&) const override;
 
@@ -90,19 +97,13 @@ namespace SceneUtil
 
         osg::ref_ptr<InfluenceMap> mInfluenceMap;
 
-        typedef std::pair<std::string, osg::Matrixf> BoneBindMatrixPair;
-
-        typedef std::pair<BoneBindMatrixPair, float> BoneWeight;
-
-        typedef std::vector<unsigned short> VertexList;
-
-        typedef std::map<std::vector<BoneWeight>, VertexList> Bone2VertexMap;
-
-        struct Bone2VertexVector : public osg::Referenced
+        struct SkinningData : public osg::Referenced
         {
-            std::vector<std::pair<std::vector<BoneWeight>, VertexList>> mData;
+            // Per influence in the order of InfluenceMap
+            std::vector<SkinTransform> mInvBindMatrices;
+            SkinInfluences mInfluences;
         };
-        osg::ref_ptr<Bone2VertexVector> mBone2VertexVector;
+        osg::ref_ptr<SkinningData> mSkinningData;
 
         struct BoneSphereVector : public osg::Referenced
         {
@@ -110,12 +111,19 @@ namespace SceneUtil
         };
         osg::ref_ptr<BoneSphereVector> mBoneSphereVector;
         std::vector<Bone*> mBoneNodesVector;
+        std::vector<SkinTransform> mBoneTransforms;
+        std::vector<SkinTransform> mGroupTransforms;
 
         unsigned int mLastFrameNumber;
+        unsigned int mLastCullFrameNumber;
         bool mBoundsFirstFrame;
 
         bool initFromParentSkeleton(osg::NodeVisitor* nv);
 
+        bool needSkinning(unsigned int traversalNumber) const;
+
+        bool wasVisibleInPreviousFrame(unsigned int traversalNumber) const;
+
         void updateGeomToSkelMatrix(const osg::NodePath& nodePath);
     };
 
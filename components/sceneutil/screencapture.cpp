@@ -147,7 +147,7 @@ namespace SceneUtil
     void AsyncScreenCaptureOperation::stop()
     {
         for (const osg::ref_ptr<SceneUtil::WorkItem>& item : *mWorkItems.lockConst())
-            item->abort();
+            item->cancel();
 
         for (const osg::ref_ptr<SceneUtil::WorkItem>& item : *mWorkItems.lockConst())
             item->waitTillDone();
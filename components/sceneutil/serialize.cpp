@@ -1,6 +1,8 @@
 #include "serialize.hpp"
 
+#include <osgDB/InputStream>
 #include <osgDB/ObjectWrapper>
+#include <osgDB/OutputStream>
 #include <osgDB/Registry>
 
 #include <components/nifosg/matrixtransform.hpp>
@@ -11,6 +13,8 @@
 #include <components/sceneutil/riggeometryosgaextension.hpp>
 #include <components/sceneutil/skeleton.hpp>
 
+#include <mutex>
+
 namespace SceneUtil
 {
 
@@ -120,6 +124,31 @@ namespace SceneUtil
             : osgDB::ObjectWrapper(createInstanceFunc<NifOsg::MatrixTransform>, "NifOsg::MatrixTransform",
                 "osg::Object osg::Node osg::Group osg::Transform osg::MatrixTransform NifOsg::MatrixTransform")
         {
+            // Components are assigned directly because the setters would update the already read matrix
+            addSerializer(new osgDB::UserSerializer<NifOsg::MatrixTransform>(
+                              "ScaleRotation", &hasScaleRotation, &readScaleRotation, &writeScaleRotation),
+                osgDB::BaseSerializer::RW_USER);
+        }
+
+    private:
+        static bool hasScaleRotation(const NifOsg::MatrixTransform& /*node*/) { return true; }
+
+        static bool readScaleRotation(osgDB::InputStream& stream, NifOsg::MatrixTransform& node)
+        {
+            stream >> node.mScale >> stream.BEGIN_BRACKET;
+            for (auto& row : node.mRotationScale.mValues)
+                stream >> row[0] >> row[1] >> row[2];
+            stream >> stream.END_BRACKET;
+            return true;
+        }
+
+        static bool writeScaleRotation(osgDB::OutputStream& stream, const NifOsg::MatrixTransform& node)
+        {
+            stream << node.mScale << stream.BEGIN_BRACKET << std::endl;
+            for (const auto& row : node.mRotationScale.mValues)
+                stream << row[0] << row[1] << row[2] << std::endl;
+            stream << stream.END_BRACKET << std::endl;
+            return true;
         }
     };
 
@@ -138,13 +167,31 @@ namespace SceneUtil
         }
     };
 
+    void registerLosslessSerializers()
+    {
+        static std::once_flag flag;
+        std::call_once(flag, [] {
+            osgDB::ObjectWrapperManager* mgr = osgDB::Registry::instance()->getObjectWrapperManager();
+            mgr->addWrapper(new PositionAttitudeTransformSerializer);
+            mgr->addWrapper(new MatrixTransformSerializer);
+        });
+    }
+
+    bool hasGeometrySerializer()
+    {
+        osgDB::ObjectWrapper* wrapper
+            = osgDB::Registry::instance()->getObjectWrapperManager()->findWrapper("osg::Geometry");
+        return wrapper != nullptr && wrapper->getSerializer("VertexArray") != nullptr;
+    }
+
     void registerSerializers()
     {
         static bool done = false;
         if (!done)
         {
+            registerLosslessSerializers();
+
             osgDB::ObjectWrapperManager* mgr = osgDB::Registry::instance()->getObjectWrapperManager();
-            mgr->addWrapper(new PositionAttitudeTransformSerializer);
             mgr->addWrapper(new SkeletonSerializer);
             mgr->addWrapper(new RigGeometrySerializer);
             mgr->addWrapper(new RigGeometryHolderSerializer);
@@ -152,7 +199,6 @@ namespace SceneUtil
             mgr->addWrapper(new MorphGeometrySerializer);
             mgr->addWrapper(new LightManagerSerializer);
             mgr->addWrapper(new CameraRelativeTransformSerializer);
-            mgr->addWrapper(new MatrixTransformSerializer);
 
             // Don't serialize Geometry data as we are more interested in the overall structure rather than tons of
             // vertex data that would make the file large and hard to read.
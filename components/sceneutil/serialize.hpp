@@ -5,8 +5,16 @@ namespace SceneUtil
 {
 
     /// Register osg node serializers for certain SceneUtil classes if not already done so
+    /// @note Replaces the osg::Geometry serializer with one skipping the data, only use to inspect scene structure.
     void registerSerializers();
 
+    /// Register serializers for SceneUtil and NifOsg classes that restore the objects completely when read back.
+    /// Thread safe.
+    void registerLosslessSerializers();
+
+    /// Is the osg::Geometry data written, i.e. registerSerializers was not called?
+    bool hasGeometrySerializer();
+
 }
 
 #endif
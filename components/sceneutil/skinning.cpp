@@ -0,0 +1,129 @@
+#include "skinning.hpp"
+
+#include <cassert>
+
+namespace SceneUtil
+{
+    namespace
+    {
+        // Affine transformation coefficients kept in local variables for the whole group of vertices
+        struct Affine
+        {
+            float m00, m01, m02, m10, m11, m12, m20, m21, m22, m30, m31, m32;
+
+            explicit Affine(const SkinTransform& transform)
+                : m00(transform.mValues[0])
+                , m01(transform.mValues[1])
+                , m02(transform.mValues[2])
+                , m10(transform.mValues[3])
+                , m11(transform.mValues[4])
+                , m12(transform.mValues[5])
+                , m20(transform.mValues[6])
+                , m21(transform.mValues[7])
+                , m22(transform.mValues[8])
+                , m30(transform.mValues[9])
+                , m31(transform.mValues[10])
+                , m32(transform.mValues[11])
+            {
+            }
+
+            template <class T>
+            void transformPoint(const T& src, T& dst) const
+            {
+                const float x = src.x();
+                const float y = src.y();
+                const float z = src.z();
+                dst.x() = x * m00 + y * m10 + z * m20 + m30;
+                dst.y() = x * m01 + y * m11 + z * m21 + m31;
+                dst.z() = x * m02 + y * m12 + z * m22 + m32;
+            }
+
+            template <class T>
+            void transformVector(const T& src, T& dst) const
+            {
+                const float x = src.x();
+                const float y = src.y();
+                const float z = src.z();
+                dst.x() = x * m00 + y * m10 + z * m20;
+                dst.y() = x * m01 + y * m11 + z * m21;
+                dst.z() = x * m02 + y * m12 + z * m22;
+            }
+        };
+
+        // Separate loops for each set of arrays to avoid branches per vertex
+        void transformPoints(const Affine& transform, std::span<const std::uint16_t> vertices,
+            const osg::Vec3f* src, osg::Vec3f* dst)
+        {
+            for (const std::uint16_t vertex : vertices)
+                transform.transformPoint(src[vertex], dst[vertex]);
+        }
+
+        template <class T>
+        void transformVectors(const Affine& transform, std::span<const std::uint16_t> vertices, const T* src, T* dst)
+        {
+            for (const std::uint16_t vertex : vertices)
+                transform.transformVector(src[vertex], dst[vertex]);
+        }
+    }
+
+    SkinTransform makeSkinTransform(const osg::Matrixf& matrix)
+    {
+        const float* const m = matrix.ptr();
+        return SkinTransform{ { m[0], m[1], m[2], m[4], m[5], m[6], m[8], m[9], m[10], m[12], m[13], m[14] } };
+    }
+
+    SkinTransform multiply(const SkinTransform& lhs, const SkinTransform& rhs)
+    {
+        const float* const a = lhs.mValues.data();
+        const float* const b = rhs.mValues.data();
+        SkinTransform result;
+        float* const r = result.mValues.data();
+        for (std::size_t row = 0; row < 4; ++row)
+            for (std::size_t column = 0; column < 3; ++column)
+                r[row * 3 + column] = a[row * 3] * b[column] + a[row * 3 + 1] * b[3 + column]
+                    + a[row * 3 + 2] * b[6 + column] + (row == 3 ? b[9 + column] : 0);
+        return result;
+    }
+
+    void blendSkinTransforms(
+        const SkinInfluences& influences, std::span<const SkinTransform> bones, std::span<SkinTransform> groups)
+    {
+        assert(groups.size() >= influences.getGroupsCount());
+        for (std::size_t group = 0, n = influences.getGroupsCount(); group < n; ++group)
+        {
+            std::array<float, 12> result{};
+            for (std::uint32_t i = influences.mWeightOffsets[group], end = influences.mWeightOffsets[group + 1];
+                 i < end; ++i)
+            {
+                const float* const bone = bones[influences.mBones[i]].mValues.data();
+                const float weight = influences.mWeights[i];
+                for (std::size_t j = 0; j < result.size(); ++j)
+                    result[j] += bone[j] * weight;
+            }
+            groups[group].mValues = result;
+        }
+    }
+
+    void skinVertices(
+        const SkinInfluences& influences, std::span<const SkinTransform> groups, const SkinVertices& vertices)
+    {
+        assert(groups.size() >= influences.getGroupsCount());
+        for (std::size_t group = 0, n = influences.getGroupsCount(); group < n; ++group)
+        {
+            const Affine transform(groups[group]);
+            const std::uint16_t* const begin = influences.mVertices.data();
+            const std::span<const std::uint16_t> groupVertices(
+                begin + influences.mVertexOffsets[group], begin + influences.mVertexOffsets[group + 1]);
+            transformPoints(transform, groupVertices, vertices.mSourcePositions, vertices.mPositions);
+            if (vertices.mNormals != nullptr)
+                transformVectors(transform, groupVertices, vertices.mSourceNormals, vertices.mNormals);
+            if (vertices.mTangents != nullptr)
+            {
+                // w component of tangent is left as is
+                transformVectors(transform, groupVertices, vertices.mSourceTangents, vertices.mTangents);
+                for (const std::uint16_t vertex : groupVertices)
+                    vertices.mTangents[vertex].w() = vertices.mSourceTangents[vertex].w();
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_SKINNING_H
+#define OPENMW_COMPONENTS_SCENEUTIL_SKINNING_H
+
+#include <osg/Matrixf>
+#include <osg/Vec3f>
+#include <osg/Vec4f>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace SceneUtil
+{
+    /// Affine transformation used for skinning. Uses the same row vector convention as osg::Matrixf and stores only
+    /// the 4x3 part: three rows of linear transformation followed by the translation.
+    struct SkinTransform
+    {
+        std::array<float, 12> mValues;
+    };
+
+    SkinTransform makeSkinTransform(const osg::Matrixf& matrix);
+
+    /// Returns transformation equal to applying lhs and then rhs
+    SkinTransform multiply(const SkinTransform& lhs, const SkinTransform& rhs);
+
+    /// Vertex weights packed into flat arrays. Vertices influenced by the same bones with the same weights form a
+    /// group and share a blended transformation.
+    struct SkinInfluences
+    {
+        // Range of weights of group i is [mWeightOffsets[i], mWeightOffsets[i + 1])
+        std::vector<std::uint32_t> mWeightOffsets{ 0 };
+        std::vector<std::uint16_t> mBones;
+        std::vector<float> mWeights;
+        // Range of vertices of group i is [mVertexOffsets[i], mVertexOffsets[i + 1])
+        std::vector<std::uint32_t> mVertexOffsets{ 0 };
+        std::vector<std::uint16_t> mVertices;
+
+        std::size_t getGroupsCount() const { return mWeightOffsets.size() - 1; }
+    };
+
+    /// Computes transformation for each group as a weighted sum of bone transformations
+    void blendSkinTransforms(
+        const SkinInfluences& influences, std::span<const SkinTransform> bones, std::span<SkinTransform> groups);
+
+    struct SkinVertices
+    {
+        const osg::Vec3f* mSourcePositions = nullptr;
+        osg::Vec3f* mPositions = nullptr;
+        const osg::Vec3f* mSourceNormals = nullptr;
+        osg::Vec3f* mNormals = nullptr;
+        const osg::Vec4f* mSourceTangents = nullptr;
+        osg::Vec4f* mTangents = nullptr;
+    };
+
+    /// Transforms positions, normals and tangents of each group. Normals and tangents are optional.
+    void skinVertices(
+        const SkinInfluences& influences, std::span<const SkinTransform> groups, const SkinVertices& vertices);
+}
+
+#endif
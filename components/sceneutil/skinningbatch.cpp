@@ -0,0 +1,100 @@
+#include "skinningbatch.hpp"
+
+#include "riggeometry.hpp"
+
+namespace SceneUtil
+{
+    SkinningBatch::SkinningBatch(std::size_t workerThreads)
+        : osg::Operation("SkinningBatch", true)
+    {
+        mThreads.reserve(workerThreads);
+        for (std::size_t i = 0; i < workerThreads; ++i)
+            mThreads.emplace_back([this] { run(); });
+    }
+
+    SkinningBatch::~SkinningBatch()
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mShouldStop = true;
+        }
+        mHasBatch.notify_all();
+        for (std::thread& thread : mThreads)
+            thread.join();
+    }
+
+    void SkinningBatch::add(RigGeometry& rigGeometry, unsigned int traversalNumber)
+    {
+        mItems.push_back(Item{ &rigGeometry, traversalNumber });
+    }
+
+    void SkinningBatch::process()
+    {
+        mLastBatchSize = mItems.size();
+        if (mItems.empty())
+            return;
+
+        if (mThreads.empty() || mItems.size() == 1)
+        {
+            for (const Item& item : mItems)
+                item.mRigGeometry->skin(item.mTraversalNumber);
+            mItems.clear();
+            return;
+        }
+
+        mNextItem = 0;
+        {
+            const std::lock_guard lock(mMutex);
+            mProcessing = true;
+            mRemaining = mItems.size();
+            ++mBatch;
+        }
+        mHasBatch.notify_all();
+
+        const std::size_t done = skinItems();
+
+        std::unique_lock lock(mMutex);
+        mRemaining -= done;
+        // Workers may still read mItems until they leave skinItems
+        mBatchDone.wait(lock, [&] { return mRemaining == 0 && mActiveThreads == 0; });
+        mProcessing = false;
+        lock.unlock();
+
+        mItems.clear();
+    }
+
+    void SkinningBatch::run() noexcept
+    {
+        std::size_t lastBatch = 0;
+        std::unique_lock lock(mMutex);
+        while (true)
+        {
+            mHasBatch.wait(lock, [&] { return mShouldStop || (mProcessing && mBatch != lastBatch); });
+            if (mShouldStop)
+                return;
+            lastBatch = mBatch;
+            ++mActiveThreads;
+            lock.unlock();
+            const std::size_t done = skinItems();
+            lock.lock();
+            mRemaining -= done;
+            --mActiveThreads;
+            if (mRemaining == 0 && mActiveThreads == 0)
+                mBatchDone.notify_all();
+        }
+    }
+
+    std::size_t SkinningBatch::skinItems()
+    {
+        std::size_t done = 0;
+        while (true)
+        {
+            const std::size_t index = mNextItem.fetch_add(1, std::memory_order_relaxed);
+            if (index >= mItems.size())
+                return done;
+            const Item& item = mItems[index];
+            item.mRigGeometry->skin(item.mTraversalNumber);
+            ++done;
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_SKINNINGBATCH_H
+#define OPENMW_COMPONENTS_SCENEUTIL_SKINNINGBATCH_H
+
+#include <osg/OperationThread>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SceneUtil
+{
+    class RigGeometry;
+
+    /// @brief Skins all RigGeometries visited by the update traversal in parallel before cull.
+    /// @note Set as user data of the update visitor to be used. RigGeometries add themselves during the update
+    /// traversal and process() has to be called after it and before rendering traversals. Adding the batch as a
+    /// viewer update operation does it for each frame.
+    class SkinningBatch : public osg::Operation
+    {
+    public:
+        /// @param workerThreads number of threads skinning together with the thread calling process().
+        explicit SkinningBatch(std::size_t workerThreads);
+
+        ~SkinningBatch();
+
+        void add(RigGeometry& rigGeometry, unsigned int traversalNumber);
+
+        /// Skins added RigGeometries and waits until all of them are done.
+        void process();
+
+        void operator()(osg::Object* /*object*/) override { process(); }
+
+        std::size_t getLastBatchSize() const { return mLastBatchSize; }
+
+    private:
+        struct Item
+        {
+            RigGeometry* mRigGeometry;
+            unsigned int mTraversalNumber;
+        };
+
+        std::vector<Item> mItems;
+        std::atomic_size_t mNextItem{ 0 };
+        std::size_t mLastBatchSize = 0;
+
+        std::mutex mMutex;
+        std::condition_variable mHasBatch;
+        std::condition_variable mBatchDone;
+        bool mShouldStop = false;
+        bool mProcessing = false;
+        std::size_t mBatch = 0;
+        std::size_t mRemaining = 0;
+        std::size_t mActiveThreads = 0;
+        std::vector<std::thread> mThreads;
+
+        void run() noexcept;
+
+        std::size_t skinItems();
+    };
+}
+
+#endif
@@ -25,8 +25,9 @@ namespace SceneUtil
             return;
 
         // Move only objects to keep allocated storage in mObjects
-        workQueue.addWorkItem(new ClearVector(std::vector<osg::ref_ptr<osg::Referenced>>(
-            std::move_iterator(mObjects.begin()), std::move_iterator(mObjects.end()))));
+        osg::ref_ptr<WorkItem> item = new ClearVector(std::vector<osg::ref_ptr<osg::Referenced>>(
+            std::move_iterator(mObjects.begin()), std::move_iterator(mObjects.end())));
+        workQueue.addWorkItem(std::move(item), WorkCategory::Unref, WorkPriority::Low);
         mObjects.clear();
     }
 }
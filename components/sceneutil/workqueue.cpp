@@ -2,7 +2,9 @@
 
 #include <components/debug/debuglog.hpp>
 
-#include <numeric>
+#include <osg/Stats>
+
+#include <string>
 
 namespace SceneUtil
 {
@@ -33,41 +35,28 @@ namespace SceneUtil
         return mDone;
     }
 
-    WorkQueue::WorkQueue(std::size_t workerThreads)
-        : mIsReleased(false)
+    void WorkItem::cancel()
     {
-        start(workerThreads);
+        mCancelled = true;
+        abort();
     }
 
-    WorkQueue::~WorkQueue()
+    WorkQueue::WorkQueue(std::size_t workerThreads, std::chrono::steady_clock::duration agingTime)
+        : mPool(workerThreads, agingTime)
     {
-        stop();
     }
 
-    void WorkQueue::start(std::size_t workerThreads)
+    WorkQueue::~WorkQueue()
     {
-        {
-            const std::lock_guard lock(mMutex);
-            mIsReleased = false;
-        }
-        while (mThreads.size() < workerThreads)
-            mThreads.emplace_back(std::make_unique<WorkThread>(*this));
+        stop();
     }
 
     void WorkQueue::stop()
     {
-        {
-            std::unique_lock<std::mutex> lock(mMutex);
-            while (!mQueue.empty())
-                mQueue.pop_back();
-            mIsReleased = true;
-            mCondition.notify_all();
-        }
-
-        mThreads.clear();
+        mPool.stop();
     }
 
-    void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, bool front)
+    void WorkQueue::addWorkItem(osg::ref_ptr<WorkItem> item, WorkCategory category, int priority)
     {
         if (item->isDone())
         {
@@ -75,71 +64,39 @@ namespace SceneUtil
             return;
         }
 
-        std::unique_lock<std::mutex> lock(mMutex);
-        if (front)
-            mQueue.push_front(std::move(item));
-        else
-            mQueue.push_back(std::move(item));
-        mCondition.notify_one();
-    }
-
-    osg::ref_ptr<WorkItem> WorkQueue::removeWorkItem()
-    {
-        std::unique_lock<std::mutex> lock(mMutex);
-        while (mQueue.empty() && !mIsReleased)
-        {
-            mCondition.wait(lock);
-        }
-        if (!mQueue.empty())
-        {
-            osg::ref_ptr<WorkItem> item = std::move(mQueue.front());
-            mQueue.pop_front();
-            return item;
-        }
-        return nullptr;
+        mPool.push(std::move(item), category, priority);
     }
 
     unsigned int WorkQueue::getNumItems() const
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        return mQueue.size();
+        return mPool.getNumItems();
     }
 
     unsigned int WorkQueue::getNumActiveThreads() const
     {
-        return std::accumulate(
-            mThreads.begin(), mThreads.end(), 0u, [](auto r, const auto& t) { return r + t->isActive(); });
-    }
-
-    WorkThread::WorkThread(WorkQueue& workQueue)
-        : mWorkQueue(&workQueue)
-        , mActive(false)
-        , mThread([this] { run(); })
-    {
+        return mPool.getNumActiveThreads();
     }
 
-    WorkThread::~WorkThread()
+    WorkStats WorkQueue::getStats() const
     {
-        mThread.join();
+        return mPool.getStats();
     }
 
-    void WorkThread::run()
+    void WorkQueue::reportStats(unsigned int frameNumber, osg::Stats& stats)
     {
-        while (true)
+        const WorkStats current = mPool.getStats();
+        for (std::size_t i = 0; i < workCategoriesCount; ++i)
         {
-            osg::ref_ptr<WorkItem> item = mWorkQueue->removeWorkItem();
-            if (!item)
-                return;
-            mActive = true;
-            item->doWork();
-            item->signalDone();
-            mActive = false;
+            const std::string name = "WorkQueue " + std::string(getWorkCategoryName(static_cast<WorkCategory>(i)));
+            stats.setAttribute(frameNumber, name, current[i].mQueued);
+            const std::size_t started = current[i].mStarted - mReportedStats[i].mStarted;
+            const auto waitTime = current[i].mWaitTime - mReportedStats[i].mWaitTime;
+            const double latency = started == 0
+                ? 0.0
+                : std::chrono::duration<double, std::milli>(waitTime).count() / static_cast<double>(started);
+            stats.setAttribute(frameNumber, name + " Latency", latency);
         }
-    }
-
-    bool WorkThread::isActive() const
-    {
-        return mActive;
+        mReportedStats = current;
     }
 
 }
@@ -1,15 +1,19 @@
 #ifndef OPENMW_COMPONENTS_SCENEUTIL_WORKQUEUE_H
 #define OPENMW_COMPONENTS_SCENEUTIL_WORKQUEUE_H
 
+#include "workstealingpool.hpp"
+
 #include <osg/Referenced>
 #include <osg/ref_ptr>
 
 #include <atomic>
 #include <condition_variable>
-#include <deque>
 #include <mutex>
-#include <thread>
-#include <vector>
+
+namespace osg
+{
+    class Stats;
+}
 
 namespace SceneUtil
 {
@@ -31,67 +35,51 @@ namespace SceneUtil
         /// Set abort flag in order to return from doWork() as soon as possible. May not be respected by all WorkItems.
         virtual void abort() {}
 
+        /// Cancel the work item. Item that is not started yet is marked as done without calling doWork(), started one
+        /// is aborted.
+        void cancel();
+
+        bool isCancelled() const { return mCancelled; }
+
     private:
         std::atomic_bool mDone{ false };
+        std::atomic_bool mCancelled{ false };
         std::mutex mMutex;
         std::condition_variable mCondition;
     };
 
-    class WorkThread;
-
     /// @brief A work queue that users can push work items onto, to be completed by one or more background threads.
-    /// @note Work items will be processed in the order that they were given in, however
-    /// if multiple work threads are involved then it is possible for a later item to complete before earlier items.
+    /// @note Work items with higher priority are started first, items with the same priority are started in the order
+    /// they were given in. Items waiting longer than agingTime are started before others. If multiple work threads
+    /// are involved then it is possible for a later item to complete before earlier items.
     class WorkQueue : public osg::Referenced
     {
     public:
-        WorkQueue(std::size_t workerThreads);
+        WorkQueue(std::size_t workerThreads, std::chrono::steady_clock::duration agingTime = defaultWorkAgingTime);
         ~WorkQueue();
 
-        void start(std::size_t workerThreads);
-
         void stop();
 
-        /// Add a new work item to the back of the queue.
+        /// Add a new work item to the queue.
         /// @par The work item's waitTillDone() method may be used by the caller to wait until the work is complete.
-        /// @param front If true, add item to the front of the queue. If false (default), add to the back.
-        void addWorkItem(osg::ref_ptr<WorkItem> item, bool front = false);
-
-        /// Get the next work item from the front of the queue. If the queue is empty, waits until a new item is added.
-        /// If the workqueue is in the process of being destroyed, may return nullptr.
-        /// @par Used internally by the WorkThread.
-        osg::ref_ptr<WorkItem> removeWorkItem();
+        /// @param category is used to collect statistics.
+        /// @param priority defines the order of processing, see WorkPriority.
+        void addWorkItem(osg::ref_ptr<WorkItem> item, WorkCategory category = WorkCategory::Other,
+            int priority = WorkPriority::Normal);
 
         unsigned int getNumItems() const;
 
         unsigned int getNumActiveThreads() const;
 
-    private:
-        bool mIsReleased;
-        std::deque<osg::ref_ptr<WorkItem>> mQueue;
+        WorkStats getStats() const;
 
-        mutable std::mutex mMutex;
-        std::condition_variable mCondition;
-
-        std::vector<std::unique_ptr<WorkThread>> mThreads;
-    };
-
-    /// Internally used by WorkQueue.
-    class WorkThread
-    {
-    public:
-        WorkThread(WorkQueue& workQueue);
-
-        ~WorkThread();
-
-        bool isActive() const;
+        /// Reports number of waiting items and average waiting time in milliseconds of items started since the
+        /// previous call per category.
+        void reportStats(unsigned int frameNumber, osg::Stats& stats);
 
     private:
-        WorkQueue* mWorkQueue;
-        std::atomic<bool> mActive;
-        std::thread mThread;
-
-        void run();
+        WorkStealingPool mPool;
+        WorkStats mReportedStats;
     };
 
 }
@@ -0,0 +1,223 @@
+#include "workstealingpool.hpp"
+#include "workqueue.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace SceneUtil
+{
+    namespace
+    {
+        // Pool and index of the worker running on the current thread to push nested items into own queue
+        thread_local const WorkStealingPool* currentPool = nullptr;
+        thread_local std::size_t currentWorker = 0;
+    }
+
+    std::string_view getWorkCategoryName(WorkCategory category)
+    {
+        switch (category)
+        {
+            case WorkCategory::Other:
+                return "Other";
+            case WorkCategory::CellPreload:
+                return "Preload";
+            case WorkCategory::TerrainPreload:
+                return "Terrain";
+            case WorkCategory::GlobalMap:
+                return "GlobalMap";
+            case WorkCategory::Unref:
+                return "Unref";
+            case WorkCategory::NavMesh:
+                return "NavMesh";
+        }
+        return {};
+    }
+
+    WorkStealingPool::WorkStealingPool(std::size_t workerThreads, Clock::duration agingTime)
+        : mAgingTime(agingTime)
+    {
+        // Keep at least one queue to hold items even when there are no threads to process them
+        mWorkers.reserve(std::max<std::size_t>(workerThreads, 1));
+        while (mWorkers.size() < std::max<std::size_t>(workerThreads, 1))
+            mWorkers.push_back(std::make_unique<Worker>());
+        for (std::size_t i = 0; i < workerThreads; ++i)
+            mWorkers[i]->mThread = std::thread([this, i] { run(i); });
+    }
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        stop();
+    }
+
+    void WorkStealingPool::stop()
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mIsReleased = true;
+        }
+        for (const std::unique_ptr<Worker>& worker : mWorkers)
+        {
+            const std::lock_guard lock(worker->mMutex);
+            for (const auto& [sequence, job] : worker->mJobs)
+                --mCounters[static_cast<std::size_t>(job.mCategory)].mQueued;
+            mNumItems -= worker->mJobs.size();
+            worker->mJobs.clear();
+            worker->mOrder.clear();
+            updateFront(*worker);
+        }
+        mHasJob.notify_all();
+        for (const std::unique_ptr<Worker>& worker : mWorkers)
+            if (worker->mThread.joinable())
+                worker->mThread.join();
+    }
+
+    void WorkStealingPool::push(osg::ref_ptr<WorkItem> item, WorkCategory category, int priority)
+    {
+        const std::size_t index = currentPool == this
+            ? currentWorker
+            : mNextWorker.fetch_add(1, std::memory_order_relaxed) % mWorkers.size();
+        Worker& worker = *mWorkers[index];
+        {
+            const std::lock_guard lock(worker.mMutex);
+            const std::uint64_t sequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+            worker.mJobs.emplace(sequence, Job{ priority, sequence, category, Clock::now(), std::move(item) });
+            worker.mOrder.emplace(priority, sequence);
+            updateFront(worker);
+            ++mCounters[static_cast<std::size_t>(category)].mQueued;
+            ++mNumItems;
+        }
+        // Waiting thread either has seen the new number of items or is already waiting for notification
+        {
+            const std::lock_guard lock(mMutex);
+        }
+        mHasJob.notify_one();
+    }
+
+    std::size_t WorkStealingPool::getNumItems() const
+    {
+        return mNumItems;
+    }
+
+    std::size_t WorkStealingPool::getNumActiveThreads() const
+    {
+        return std::accumulate(mWorkers.begin(), mWorkers.end(), std::size_t(0),
+            [](std::size_t r, const std::unique_ptr<Worker>& v) { return r + v->mActive; });
+    }
+
+    WorkStats WorkStealingPool::getStats() const
+    {
+        WorkStats result;
+        for (std::size_t i = 0; i < workCategoriesCount; ++i)
+        {
+            result[i].mQueued = mCounters[i].mQueued;
+            result[i].mStarted = mCounters[i].mStarted;
+            result[i].mCancelled = mCounters[i].mCancelled;
+            result[i].mWaitTime = Clock::duration(mCounters[i].mWaitTime);
+        }
+        return result;
+    }
+
+    void WorkStealingPool::run(std::size_t workerIndex)
+    {
+        currentPool = this;
+        currentWorker = workerIndex;
+        Worker& worker = *mWorkers[workerIndex];
+        while (true)
+        {
+            Job job;
+            if (takeJob(workerIndex, job))
+            {
+                runJob(worker, job);
+                continue;
+            }
+            std::unique_lock lock(mMutex);
+            mHasJob.wait(lock, [&] { return mIsReleased || mNumItems > 0; });
+            if (mIsReleased)
+                return;
+        }
+    }
+
+    bool WorkStealingPool::takeJob(std::size_t workerIndex, Job& job)
+    {
+        const Clock::rep agedQueuedAt = (Clock::now() - mAgingTime).time_since_epoch().count();
+        std::size_t best = mWorkers.size();
+        int bestPriority = noPriority;
+        std::uint64_t bestSequence = noSequence;
+        bool aged = false;
+        for (std::size_t i = 0; i < mWorkers.size(); ++i)
+        {
+            const std::size_t index = (workerIndex + i) % mWorkers.size();
+            const Worker& worker = *mWorkers[index];
+            if (worker.mOldestQueuedAt.load(std::memory_order_relaxed) <= agedQueuedAt)
+            {
+                const std::uint64_t sequence = worker.mOldestSequence.load(std::memory_order_relaxed);
+                if (!aged || sequence < bestSequence)
+                {
+                    best = index;
+                    bestSequence = sequence;
+                    aged = true;
+                }
+                continue;
+            }
+            if (aged)
+                continue;
+            const int priority = worker.mTopPriority.load(std::memory_order_relaxed);
+            if (priority == noPriority)
+                continue;
+            const std::uint64_t sequence = worker.mTopSequence.load(std::memory_order_relaxed);
+            if (priority > bestPriority || (priority == bestPriority && sequence < bestSequence))
+            {
+                best = index;
+                bestPriority = priority;
+                bestSequence = sequence;
+            }
+        }
+        if (best == mWorkers.size())
+            return false;
+        Worker& worker = *mWorkers[best];
+        const std::lock_guard lock(worker.mMutex);
+        if (worker.mJobs.empty())
+            return false;
+        const auto it = aged ? worker.mJobs.begin() : worker.mJobs.find(worker.mOrder.begin()->second);
+        worker.mOrder.erase(std::pair(it->second.mPriority, it->first));
+        job = std::move(it->second);
+        worker.mJobs.erase(it);
+        updateFront(worker);
+        --mNumItems;
+        return true;
+    }
+
+    void WorkStealingPool::runJob(Worker& worker, Job& job)
+    {
+        CategoryCounters& counters = mCounters[static_cast<std::size_t>(job.mCategory)];
+        --counters.mQueued;
+        if (job.mItem->isCancelled())
+        {
+            ++counters.mCancelled;
+            job.mItem->signalDone();
+            return;
+        }
+        ++counters.mStarted;
+        counters.mWaitTime += (Clock::now() - job.mQueuedAt).count();
+        worker.mActive = true;
+        job.mItem->doWork();
+        job.mItem->signalDone();
+        worker.mActive = false;
+    }
+
+    void WorkStealingPool::updateFront(Worker& worker)
+    {
+        if (worker.mJobs.empty())
+        {
+            worker.mTopPriority = noPriority;
+            worker.mTopSequence = noSequence;
+            worker.mOldestSequence = noSequence;
+            worker.mOldestQueuedAt = noTime;
+            return;
+        }
+        worker.mTopPriority = worker.mOrder.begin()->first;
+        worker.mTopSequence = worker.mOrder.begin()->second;
+        worker.mOldestSequence = worker.mJobs.begin()->first;
+        worker.mOldestQueuedAt = worker.mJobs.begin()->second.mQueuedAt.time_since_epoch().count();
+    }
+}
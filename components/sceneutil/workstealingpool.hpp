@@ -0,0 +1,160 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_WORKSTEALINGPOOL_H
+#define OPENMW_COMPONENTS_SCENEUTIL_WORKSTEALINGPOOL_H
+
+#include <osg/ref_ptr>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace SceneUtil
+{
+    class WorkItem;
+
+    enum class WorkCategory
+    {
+        Other,
+        CellPreload,
+        TerrainPreload,
+        GlobalMap,
+        Unref,
+        NavMesh,
+    };
+
+    constexpr std::size_t workCategoriesCount = static_cast<std::size_t>(WorkCategory::NavMesh) + 1;
+
+    std::string_view getWorkCategoryName(WorkCategory category);
+
+    /// Work items with higher priority are started earlier. Any other value can be used as well.
+    namespace WorkPriority
+    {
+        constexpr int Low = -100;
+        constexpr int Normal = 0;
+        constexpr int High = 100;
+    }
+
+    /// Items waiting longer than this are started before any other items regardless of priority, so a stream of
+    /// higher priority items can't starve lower priority ones.
+    constexpr std::chrono::milliseconds defaultWorkAgingTime{ 1000 };
+
+    struct WorkCategoryStats
+    {
+        // Number of items waiting to be started
+        std::size_t mQueued = 0;
+        // Total number of started items
+        std::size_t mStarted = 0;
+        // Total number of items skipped because they were cancelled before being started
+        std::size_t mCancelled = 0;
+        // Total time started items spent waiting in a queue
+        std::chrono::steady_clock::duration mWaitTime{};
+    };
+
+    using WorkStats = std::array<WorkCategoryStats, workCategoriesCount>;
+
+    /// @brief Thread pool with a separate queue for each worker thread.
+    /// Items added by a worker thread go to its own queue, other items are distributed over all queues. A thread
+    /// takes the item with the highest priority from all queues, so idle threads steal work from busy ones. Items with
+    /// the same priority are started in the order they were added to the pool. Items waiting for longer than aging
+    /// time are started first, the oldest one first.
+    class WorkStealingPool
+    {
+    public:
+        explicit WorkStealingPool(
+            std::size_t workerThreads, std::chrono::steady_clock::duration agingTime = defaultWorkAgingTime);
+
+        ~WorkStealingPool();
+
+        /// Removes all waiting items without marking them as done and waits for running items to finish.
+        void stop();
+
+        void push(osg::ref_ptr<WorkItem> item, WorkCategory category, int priority);
+
+        std::size_t getNumItems() const;
+
+        std::size_t getNumActiveThreads() const;
+
+        WorkStats getStats() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr int noPriority = INT_MIN;
+        static constexpr std::uint64_t noSequence = std::numeric_limits<std::uint64_t>::max();
+        static constexpr Clock::rep noTime = std::numeric_limits<Clock::rep>::max();
+
+        struct Job
+        {
+            int mPriority;
+            std::uint64_t mSequence;
+            WorkCategory mCategory;
+            Clock::time_point mQueuedAt;
+            osg::ref_ptr<WorkItem> mItem;
+        };
+
+        struct IsStartedEarlier
+        {
+            bool operator()(const std::pair<int, std::uint64_t>& lhs, const std::pair<int, std::uint64_t>& rhs) const
+            {
+                if (lhs.first != rhs.first)
+                    return lhs.first > rhs.first;
+                return lhs.second < rhs.second;
+            }
+        };
+
+        struct Worker
+        {
+            std::mutex mMutex;
+            // Jobs by sequence number, the oldest first
+            std::map<std::uint64_t, Job> mJobs;
+            // Priorities and sequence numbers of the jobs, the one to be started first at the front
+            std::set<std::pair<int, std::uint64_t>, IsStartedEarlier> mOrder;
+            // Copies of the front values to choose the queue without locking all of them
+            std::atomic_int mTopPriority{ noPriority };
+            std::atomic_uint64_t mTopSequence{ noSequence };
+            std::atomic_uint64_t mOldestSequence{ noSequence };
+            std::atomic<Clock::rep> mOldestQueuedAt{ noTime };
+            std::atomic_bool mActive{ false };
+            std::thread mThread;
+        };
+
+        struct CategoryCounters
+        {
+            std::atomic_size_t mQueued{ 0 };
+            std::atomic_size_t mStarted{ 0 };
+            std::atomic_size_t mCancelled{ 0 };
+            std::atomic<Clock::rep> mWaitTime{ 0 };
+        };
+
+        const Clock::duration mAgingTime;
+        std::vector<std::unique_ptr<Worker>> mWorkers;
+        std::atomic_size_t mNextWorker{ 0 };
+        std::atomic_uint64_t mNextSequence{ 0 };
+        std::atomic_size_t mNumItems{ 0 };
+        std::array<CategoryCounters, workCategoriesCount> mCounters;
+        std::mutex mMutex;
+        std::condition_variable mHasJob;
+        bool mIsReleased = false;
+
+        void run(std::size_t workerIndex);
+
+        bool takeJob(std::size_t workerIndex, Job& job);
+
+        void runJob(Worker& worker, Job& job);
+
+        static void updateFront(Worker& worker);
+    };
+}
+
+#endif
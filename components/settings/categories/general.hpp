@@ -31,6 +31,10 @@ namespace Settings
         SettingValue<std::string> mPreferredLocales{ mIndex, "General", "preferred locales" };
         SettingValue<std::size_t> mLogBufferSize{ mIndex, "General", "log buffer size" };
         SettingValue<std::size_t> mConsoleHistoryBufferSize{ mIndex, "General", "console history buffer size" };
+        SettingValue<bool> mMemoryMapArchives{ mIndex, "General", "memory map archives" };
+        SettingValue<std::size_t> mSkinningThreads{ mIndex, "General", "skinning threads" };
+        SettingValue<int> mContentDecodingThreads{ mIndex, "General", "content decoding threads",
+            makeMaxSanitizerInt(-1) };
     };
 }
 
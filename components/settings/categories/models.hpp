@@ -43,6 +43,7 @@ namespace Settings
         SettingValue<std::string> mWeathersnow{ mIndex, "Models", "weathersnow" };
         SettingValue<std::string> mWeatherblizzard{ mIndex, "Models", "weatherblizzard" };
         SettingValue<bool> mWriteNifDebugLog{ mIndex, "Models", "write nif debug log" };
+        SettingValue<bool> mSceneFileCache{ mIndex, "Models", "scene file cache" };
     };
 }
 
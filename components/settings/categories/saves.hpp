@@ -22,6 +22,7 @@ namespace Settings
         SettingValue<bool> mAutosave{ mIndex, "Saves", "autosave" };
         SettingValue<bool> mTimeplayed{ mIndex, "Saves", "timeplayed" };
         SettingValue<int> mMaxQuicksaves{ mIndex, "Saves", "max quicksaves", makeMaxSanitizerInt(1) };
+        SettingValue<bool> mCompress{ mIndex, "Saves", "compress" };
     };
 }
 
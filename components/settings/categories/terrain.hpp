@@ -37,6 +37,9 @@ namespace Settings
             makeMaxStrictSanitizerFloat(0) };
         SettingValue<float> mObjectPagingMinSizeCostMultiplier{ mIndex, "Terrain",
             "object paging min size cost multiplier", makeMaxStrictSanitizerFloat(0) };
+        SettingValue<int> mObjectPagingReferenceCacheSize{ mIndex, "Terrain", "object paging reference cache size",
+            makeMaxSanitizerInt(0) };
+        SettingValue<int> mChunkCacheSize{ mIndex, "Terrain", "chunk cache size", makeMaxSanitizerInt(0) };
     };
 }
 
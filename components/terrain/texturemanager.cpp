@@ -56,7 +56,7 @@ namespace Terrain
 
     void TextureManager::reportStats(unsigned int frameNumber, osg::Stats* stats) const
     {
-        stats->setAttribute(frameNumber, "Terrain Texture", mCache->getCacheSize());
+        Resource::reportStats("Terrain Texture", frameNumber, mCache->getStats(), *stats);
     }
 
 }
@@ -348,6 +348,12 @@ Utf8Encoder::Utf8Encoder(FromType sourceEncoding)
 {
 }
 
+Utf8Encoder::Utf8Encoder(const StatelessUtf8Encoder& impl)
+    : mBuffer(50 * 1024, '\0')
+    , mImpl(impl)
+{
+}
+
 std::string_view Utf8Encoder::getUtf8(std::string_view input)
 {
     return mImpl.getUtf8(input, BufferAllocationPolicy::UseGrowFactor, mBuffer);
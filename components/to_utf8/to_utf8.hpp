@@ -58,6 +58,8 @@ namespace ToUTF8
     public:
         explicit Utf8Encoder(FromType sourceEncoding);
 
+        explicit Utf8Encoder(const StatelessUtf8Encoder& impl);
+
         /// Convert to UTF8 from the previously given code page.
         /// Returns a view to internal buffer invalidate by next getUtf8 or getLegacyEnc call if input is not
         /// ASCII-only string. Otherwise returns a view to the input.
@@ -32,10 +32,11 @@ namespace VFS
     class BsaArchive : public Archive
     {
     public:
-        BsaArchive(const std::filesystem::path& filename)
+        BsaArchive(const std::filesystem::path& filename, bool useMemoryMapping = false)
             : Archive()
         {
             mFile = std::make_unique<BSAFileType>();
+            mFile->setUseMemoryMapping(useMemoryMapping);
             mFile->open(filename);
 
             const Bsa::BSAFile::FileList& filelist = mFile->getList();
@@ -32,8 +32,39 @@ namespace
 namespace VFS
 {
 
+    std::size_t Manager::PathHash::operator()(std::string_view path) const
+    {
+        const auto hash = [&](auto normalize_char) {
+            // FNV-1a
+            std::size_t result{ 0xcbf29ce484222325ull };
+            constexpr std::size_t prime{ 0x00000100000001B3ull };
+            for (char c : path)
+            {
+                result ^= static_cast<unsigned char>(normalize_char(c));
+                result *= prime;
+            }
+            return result;
+        };
+        if (mStrict)
+            return hash([](char c) { return strict_normalize_char(c); });
+        return hash([](char c) { return nonstrict_normalize_char(c); });
+    }
+
+    bool Manager::PathEqual::operator()(std::string_view left, std::string_view right) const
+    {
+        const auto equal = [&](auto normalize_char) {
+            return std::equal(left.begin(), left.end(), right.begin(), right.end(),
+                [&](char l, char r) { return normalize_char(l) == normalize_char(r); });
+        };
+        if (mStrict)
+            return equal([](char c) { return strict_normalize_char(c); });
+        return equal([](char c) { return nonstrict_normalize_char(c); });
+    }
+
     Manager::Manager(bool strict)
         : mStrict(strict)
+        , mIndex(0, PathHash{ strict }, PathEqual{ strict })
+        , mDirectories(1)
     {
     }
 
@@ -42,6 +73,8 @@ namespace VFS
     void Manager::reset()
     {
         mIndex.clear();
+        mSortedNames.clear();
+        mDirectories.assign(1, Directory{});
         mArchives.clear();
     }
 
@@ -52,34 +85,69 @@ namespace VFS
 
     void Manager::buildIndex()
     {
-        mIndex.clear();
+        std::map<std::string, File*> index;
 
         for (const auto& archive : mArchives)
-            archive->listResources(mIndex, mStrict ? &strict_normalize_char : &nonstrict_normalize_char);
+            archive->listResources(index, mStrict ? &strict_normalize_char : &nonstrict_normalize_char);
+
+        mIndex.clear();
+        mIndex.reserve(index.size());
+        mSortedNames.clear();
+        mSortedNames.reserve(index.size());
+        mDirectories.assign(1, Directory{});
+
+        while (!index.empty())
+        {
+            auto node = index.extract(index.begin());
+            const std::string& name = mIndex.emplace(std::move(node.key()), node.mapped()).first->first;
+            const std::size_t position = mSortedNames.size();
+            mSortedNames.push_back(&name);
+
+            // Files of a directory are next to each other in the sorted list because they have a common prefix
+            std::size_t directory = 0;
+            mDirectories[directory].mEnd = position + 1;
+            for (std::size_t start = 0, slash; (slash = name.find('/', start)) != std::string::npos; start = slash + 1)
+            {
+                auto& subdirectories = mDirectories[directory].mSubdirectories;
+                const std::string_view subdirectory = std::string_view(name).substr(start, slash - start);
+                if (const auto it = subdirectories.find(subdirectory); it != subdirectories.end())
+                    directory = it->second;
+                else
+                {
+                    directory = mDirectories.size();
+                    subdirectories.emplace(subdirectory, directory);
+                    mDirectories.emplace_back().mBegin = position;
+                }
+                mDirectories[directory].mEnd = position + 1;
+            }
+        }
     }
 
-    Files::IStreamPtr Manager::get(std::string_view name) const
+    File* Manager::find(std::string_view name) const
     {
-        std::string normalized(name);
-        normalize_path(normalized, mStrict);
+        const auto found = mIndex.find(name);
+        if (found == mIndex.end())
+            return nullptr;
+        return found->second;
+    }
 
-        return getNormalized(normalized);
+    Files::IStreamPtr Manager::get(std::string_view name) const
+    {
+        if (File* const file = find(name))
+            return file->open();
+        throw std::runtime_error("Resource '" + normalizeFilename(name) + "' not found");
     }
 
     Files::IStreamPtr Manager::getNormalized(const std::string& normalizedName) const
     {
-        std::map<std::string, File*>::const_iterator found = mIndex.find(normalizedName);
-        if (found == mIndex.end())
-            throw std::runtime_error("Resource '" + normalizedName + "' not found");
-        return found->second->open();
+        if (File* const file = find(normalizedName))
+            return file->open();
+        throw std::runtime_error("Resource '" + normalizedName + "' not found");
     }
 
     bool Manager::exists(std::string_view name) const
     {
-        std::string normalized(name);
-        normalize_path(normalized, mStrict);
-
-        return mIndex.find(normalized) != mIndex.end();
+        return find(name) != nullptr;
     }
 
     std::string Manager::normalizeFilename(std::string_view name) const
@@ -103,13 +171,10 @@ namespace VFS
 
     std::filesystem::path Manager::getAbsoluteFileName(const std::filesystem::path& name) const
     {
-        std::string normalized = Files::pathToUnicodeString(name);
-        normalize_path(normalized, mStrict);
-
-        const auto found = mIndex.find(normalized);
-        if (found == mIndex.end())
-            throw std::runtime_error("Resource '" + normalized + "' not found");
-        return found->second->getPath();
+        const std::string path = Files::pathToUnicodeString(name);
+        if (File* const file = find(path))
+            return file->getPath();
+        throw std::runtime_error("Resource '" + normalizeFilename(path) + "' not found");
     }
 
     namespace
@@ -123,12 +188,29 @@ namespace VFS
     Manager::RecursiveDirectoryRange Manager::getRecursiveDirectoryIterator(std::string_view path) const
     {
         if (path.empty())
-            return { mIndex.begin(), mIndex.end() };
-        auto normalized = normalizeFilename(path);
-        const auto it = mIndex.lower_bound(normalized);
-        if (it == mIndex.end() || !startsWith(it->first, normalized))
-            return { it, it };
-        ++normalized.back();
-        return { it, mIndex.lower_bound(normalized) };
+            return { mSortedNames.begin(), mSortedNames.end() };
+        const std::string normalized = normalizeFilename(path);
+        const std::string_view normalizedView = normalized;
+
+        // Find the deepest directory containing all matching files, the rest of the path is a prefix of a name
+        const Directory* directory = &mDirectories.front();
+        std::size_t start = 0;
+        for (std::size_t slash; (slash = normalizedView.find('/', start)) != std::string_view::npos; start = slash + 1)
+        {
+            const auto it = directory->mSubdirectories.find(normalizedView.substr(start, slash - start));
+            if (it == directory->mSubdirectories.end())
+                return { mSortedNames.end(), mSortedNames.end() };
+            directory = &mDirectories[it->second];
+        }
+
+        auto begin = mSortedNames.begin() + static_cast<std::ptrdiff_t>(directory->mBegin);
+        auto end = mSortedNames.begin() + static_cast<std::ptrdiff_t>(directory->mEnd);
+        if (start == normalizedView.size())
+            return { begin, end };
+        begin = std::lower_bound(
+            begin, end, normalizedView, [](const std::string* name, std::string_view value) { return *name < value; });
+        end = std::partition_point(
+            begin, end, [&](const std::string* name) { return startsWith(*name, normalizedView); });
+        return { begin, end };
     }
 }
@@ -4,9 +4,13 @@
 #include <components/files/istreamptr.hpp>
 
 #include <filesystem>
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace VFS
@@ -42,12 +46,12 @@ namespace VFS
         class RecursiveDirectoryIterator
         {
         public:
-            RecursiveDirectoryIterator(std::map<std::string, File*>::const_iterator it)
+            RecursiveDirectoryIterator(std::vector<const std::string*>::const_iterator it)
                 : mIt(it)
             {
             }
-            const std::string& operator*() const { return mIt->first; }
-            const std::string* operator->() const { return &mIt->first; }
+            const std::string& operator*() const { return **mIt; }
+            const std::string* operator->() const { return *mIt; }
             bool operator!=(const RecursiveDirectoryIterator& other) { return mIt != other.mIt; }
             RecursiveDirectoryIterator& operator++()
             {
@@ -56,7 +60,7 @@ namespace VFS
             }
 
         private:
-            std::map<std::string, File*>::const_iterator mIt;
+            std::vector<const std::string*>::const_iterator mIt;
         };
 
         using RecursiveDirectoryRange = IteratorPair<RecursiveDirectoryIterator>;
@@ -110,11 +114,48 @@ namespace VFS
         std::filesystem::path getAbsoluteFileName(const std::filesystem::path& name) const;
 
     private:
+        // Hash and comparison of normalized paths. Names are normalized on the fly, so lookups don't allocate.
+        struct PathHash
+        {
+            using is_transparent = void;
+
+            bool mStrict;
+
+            std::size_t operator()(std::string_view path) const;
+        };
+
+        struct PathEqual
+        {
+            using is_transparent = void;
+
+            bool mStrict;
+
+            bool operator()(std::string_view left, std::string_view right) const;
+        };
+
+        // Node of the directory tree, contains the range of mSortedNames with all files in the directory and its
+        // subdirectories
+        struct Directory
+        {
+            std::size_t mBegin = 0;
+            std::size_t mEnd = 0;
+            // Indices in mDirectories
+            std::map<std::string, std::size_t, std::less<>> mSubdirectories;
+        };
+
         bool mStrict;
 
         std::vector<std::unique_ptr<Archive>> mArchives;
 
-        std::map<std::string, File*> mIndex;
+        std::unordered_map<std::string, File*, PathHash, PathEqual> mIndex;
+
+        // Keys of mIndex in lexicographical order
+        std::vector<const std::string*> mSortedNames;
+
+        // The first one is the root directory
+        std::vector<Directory> mDirectories;
+
+        File* find(std::string_view name) const;
     };
 
 }
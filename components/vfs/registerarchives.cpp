@@ -14,7 +14,7 @@ namespace VFS
 {
 
     void registerArchives(VFS::Manager* vfs, const Files::Collections& collections,
-        const std::vector<std::string>& archives, bool useLooseFiles)
+        const std::vector<std::string>& archives, bool useLooseFiles, bool useMemoryMapping)
     {
         const Files::PathContainer& dataDirs = collections.getPaths();
 
@@ -28,13 +28,17 @@ namespace VFS
                 Bsa::BsaVersion bsaVersion = Bsa::BSAFile::detectVersion(archivePath);
 
                 if (bsaVersion == Bsa::BSAVER_COMPRESSED)
-                    vfs->addArchive(std::make_unique<ArchiveSelector<Bsa::BSAVER_COMPRESSED>::type>(archivePath));
+                    vfs->addArchive(
+                        std::make_unique<ArchiveSelector<Bsa::BSAVER_COMPRESSED>::type>(archivePath, useMemoryMapping));
                 else if (bsaVersion == Bsa::BSAVER_BA2_GNRL)
-                    vfs->addArchive(std::make_unique<ArchiveSelector<Bsa::BSAVER_BA2_GNRL>::type>(archivePath));
+                    vfs->addArchive(
+                        std::make_unique<ArchiveSelector<Bsa::BSAVER_BA2_GNRL>::type>(archivePath, useMemoryMapping));
                 else if (bsaVersion == Bsa::BSAVER_BA2_DX10)
-                    vfs->addArchive(std::make_unique<ArchiveSelector<Bsa::BSAVER_BA2_DX10>::type>(archivePath));
+                    vfs->addArchive(
+                        std::make_unique<ArchiveSelector<Bsa::BSAVER_BA2_DX10>::type>(archivePath, useMemoryMapping));
                 else if (bsaVersion == Bsa::BSAVER_UNCOMPRESSED)
-                    vfs->addArchive(std::make_unique<ArchiveSelector<Bsa::BSAVER_UNCOMPRESSED>::type>(archivePath));
+                    vfs->addArchive(std::make_unique<ArchiveSelector<Bsa::BSAVER_UNCOMPRESSED>::type>(
+                        archivePath, useMemoryMapping));
                 else
                     throw std::runtime_error("Unknown archive type '" + *archive + "'");
             }
@@ -30,6 +30,42 @@
 -- List of nearby players. Currently (since multiplayer is not yet implemented) always has one element.
 -- @field [parent=#nearby] openmw.core#ObjectList players
 
+---
+-- A table of parameters for @{#nearby.findInRadius}, @{#nearby.findInBox} and @{#nearby.findNearest}
+-- @type FindOptions
+-- @field #any type Return only objects of this type, e.g. `types.NPC` or `types.Item` (see @{openmw.types}).
+-- @field openmw.core#GameObject ignore An object to exclude from the results (e.g. `self`).
+-- @field #number maxDistance Maximal distance to the found objects (only for @{#nearby.findNearest}).
+
+---
+-- Find objects from the nearby lists within the radius around the position.
+-- Uses a spatial index, so it is much faster than checking the position of every object in Lua.
+-- @function [parent=#nearby] findInRadius
+-- @param openmw.util#Vector3 position
+-- @param #number radius
+-- @param #FindOptions options An optional table with additional optional arguments
+-- @return openmw.core#ObjectList In no particular order.
+-- @usage for _, actor in ipairs(nearby.findInRadius(self.position, 1000, {type = types.Actor, ignore = self})) do
+--     print(actor)
+-- end
+
+---
+-- Find objects from the nearby lists within the axis aligned box.
+-- @function [parent=#nearby] findInBox
+-- @param openmw.util#Vector3 min Minimal corner of the box.
+-- @param openmw.util#Vector3 max Maximal corner of the box.
+-- @param #FindOptions options An optional table with additional optional arguments
+-- @return openmw.core#ObjectList In no particular order.
+
+---
+-- Find up to `count` objects from the nearby lists nearest to the position.
+-- @function [parent=#nearby] findNearest
+-- @param openmw.util#Vector3 position
+-- @param #number count
+-- @param #FindOptions options An optional table with additional optional arguments
+-- @return openmw.core#ObjectList Sorted by distance, the nearest first.
+-- @usage local door = nearby.findNearest(self.position, 1, {type = types.Door, maxDistance = 500})[1]
+
 ---
 -- Return an object by RefNum/FormId.
 -- Note: the function always returns @{openmw.core#GameObject} and doesn't validate that
@@ -89,6 +125,38 @@
 --     radius = 10,
 -- })
 
+---
+-- Asynchronously cast ray from one point to another and find the first collision.
+-- The ray is cast along with the next physics simulation step. The callback is usually called during the next frame
+-- when physics runs on the main thread (`async num threads` is 0) and one frame later with async physics threads.
+-- @function [parent=#nearby] asyncCastRay
+-- @param openmw.async#Callback callback The callback to pass the result to (should accept a single argument @{openmw.nearby#RayCastingResult}).
+-- @param openmw.util#Vector3 from Start point of the ray.
+-- @param openmw.util#Vector3 to End point of the ray.
+-- @param #CastRayOptions options An optional table with additional optional arguments
+
+---
+-- A ray for @{#nearby.asyncCastRays}. Also accepts all fields of @{#CastRayOptions}.
+-- @type AsyncCastRaysRay
+-- @field openmw.util#Vector3 from Start point of the ray.
+-- @field openmw.util#Vector3 to End point of the ray.
+
+---
+-- Asynchronously cast a batch of rays and find the first collision of each one.
+-- With async physics threads the rays are cast in parallel, so it is cheaper than calling `castRay` for each of them.
+-- The callback is called with the same delay as for @{#nearby.asyncCastRay}.
+-- @function [parent=#nearby] asyncCastRays
+-- @param openmw.async#Callback callback The callback to pass the results to (should accept a single argument, a list of @{openmw.nearby#RayCastingResult} in the order of the rays).
+-- @param #list<#AsyncCastRaysRay> rays
+-- @usage nearby.asyncCastRays(async:callback(function(results)
+--     for i, res in ipairs(results) do
+--         if res.hit then print('ray ' .. i .. ' is blocked') end
+--     end
+-- end), {
+--     {from = self.position, to = pointA, ignore = self},
+--     {from = self.position, to = pointB, radius = 10},
+-- })
+
 ---
 -- Cast ray from one point to another and find the first visual intersection with anything in the scene.
 -- As opposite to `castRay` can find an intersection with an object without collisions.